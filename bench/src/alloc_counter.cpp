@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "alloc_counter.h"
+
+#ifdef NOVA_TRACK_MEMORY
+#include <nova/core/memory_tracker.h>
+
+// The engine already replaces operator new and counts per thread
+Nova::Bench::AllocStats Nova::Bench::get_thread_alloc_stats() {
+	const Nova::AllocationCount count = Nova::MemoryTracker::get_thread_count();
+	return {.count = count.count, .bytes = count.bytes};
+}
+#else
+#include <cstdlib>
+#include <new>
+
+namespace {
+	thread_local Nova::Bench::AllocStats t_stats;
+
+	void* counted_alloc(const std::size_t p_size) {
+		t_stats.count++;
+		t_stats.bytes += p_size;
+		return std::malloc(p_size ? p_size : 1);
+	}
+
+	void* counted_aligned_alloc(const std::size_t p_size, const std::align_val_t p_align) {
+		t_stats.count++;
+		t_stats.bytes += p_size;
+		const std::size_t align = static_cast<std::size_t>(p_align);
+#ifdef NOVA_WINDOWS
+		return _aligned_malloc(p_size ? p_size : 1, align);
+#else
+		return std::aligned_alloc(align, (p_size + align - 1) / align * align);
+#endif
+	}
+
+	void aligned_free(void* p_ptr) {
+#ifdef NOVA_WINDOWS
+		_aligned_free(p_ptr);
+#else
+		std::free(p_ptr);
+#endif
+	}
+} // namespace
+
+Nova::Bench::AllocStats Nova::Bench::get_thread_alloc_stats() {
+	return t_stats;
+}
+
+void* operator new(const std::size_t p_size) {
+	if (void* ptr = counted_alloc(p_size)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t p_size) {
+	return ::operator new(p_size);
+}
+
+void* operator new(const std::size_t p_size, const std::nothrow_t&) noexcept {
+	return counted_alloc(p_size);
+}
+
+void* operator new[](const std::size_t p_size, const std::nothrow_t&) noexcept {
+	return counted_alloc(p_size);
+}
+
+void* operator new(const std::size_t p_size, const std::align_val_t p_align) {
+	if (void* ptr = counted_aligned_alloc(p_size, p_align)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t p_size, const std::align_val_t p_align) {
+	return ::operator new(p_size, p_align);
+}
+
+void operator delete(void* p_ptr) noexcept {
+	std::free(p_ptr);
+}
+
+void operator delete[](void* p_ptr) noexcept {
+	std::free(p_ptr);
+}
+
+void operator delete(void* p_ptr, std::size_t) noexcept {
+	std::free(p_ptr);
+}
+
+void operator delete[](void* p_ptr, std::size_t) noexcept {
+	std::free(p_ptr);
+}
+
+void operator delete(void* p_ptr, std::align_val_t) noexcept {
+	aligned_free(p_ptr);
+}
+
+void operator delete[](void* p_ptr, std::align_val_t) noexcept {
+	aligned_free(p_ptr);
+}
+
+void operator delete(void* p_ptr, std::size_t, std::align_val_t) noexcept {
+	aligned_free(p_ptr);
+}
+
+void operator delete[](void* p_ptr, std::size_t, std::align_val_t) noexcept {
+	aligned_free(p_ptr);
+}
+#endif
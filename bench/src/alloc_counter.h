@@ -0,0 +1,21 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/types.h>
+
+namespace Nova::Bench {
+	struct AllocStats {
+		u64 count = 0;
+		u64 bytes = 0;
+	};
+
+	/**
+	 * @brief Returns the number of heap allocations made by the calling thread so far.
+	 */
+	AllocStats get_thread_alloc_stats();
+} // namespace Nova::Bench
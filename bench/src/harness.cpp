@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "harness.h"
+
+#include <nova/version.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+	std::string escape_json(const std::string_view p_str) {
+		std::string out;
+		out.reserve(p_str.size());
+		for (const char c : p_str) {
+			switch (c) {
+				case '"':
+					out += "\\\"";
+					break;
+				case '\\':
+					out += "\\\\";
+					break;
+				case '\n':
+					out += "\\n";
+					break;
+				case '\t':
+					out += "\\t";
+					break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20) {
+						char buf[8];
+						std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+						out += buf;
+					} else {
+						out += c;
+					}
+					break;
+			}
+		}
+		return out;
+	}
+} // namespace
+
+using namespace Nova::Bench;
+
+Harness::Harness(Options p_options) : m_options(std::move(p_options)) {}
+
+bool Harness::should_run(const std::string_view p_name) const {
+	return m_options.filter.empty() || p_name.find(m_options.filter) != std::string_view::npos;
+}
+
+u32 Harness::get_iterations() const {
+	return m_options.iterations;
+}
+
+u32 Harness::get_macro_iterations() const {
+	return std::max(1u, m_options.iterations / 10);
+}
+
+void Harness::set_context(const std::string_view p_key, const std::string_view p_value) {
+	m_context.emplace_back(p_key, p_value);
+}
+
+void Harness::skip(const std::string_view p_name, const std::string_view p_reason) {
+	if (!should_run(p_name)) {
+		return;
+	}
+	m_skipped.emplace_back(p_name, p_reason);
+}
+
+void Harness::report() const {
+	std::fprintf(stderr, "%-28s %8s %14s %14s %12s %14s\n", "benchmark", "iters", "median (ns)", "p99 (ns)", "allocs/op", "bytes/op");
+	for (const Result& result : m_results) {
+		std::fprintf(
+			stderr,
+			"%-28s %8u %14.0f %14.0f %12.2f %14.1f\n",
+			result.name.c_str(),
+			result.iterations,
+			result.median_ns,
+			result.p99_ns,
+			result.allocs_per_op,
+			result.bytes_per_op
+		);
+	}
+	for (const auto& [name, reason] : m_skipped) {
+		std::fprintf(stderr, "%-28s skipped: %s\n", name.c_str(), reason.c_str());
+	}
+
+	if (m_options.json_path.empty() || m_options.json_path == "-") {
+		_write_json(stdout);
+		return;
+	}
+
+	std::FILE* file = std::fopen(m_options.json_path.c_str(), "w");
+	if (!file) {
+		throw std::runtime_error("Failed to open " + m_options.json_path);
+	}
+	_write_json(file);
+	std::fclose(file);
+}
+
+void Harness::_record(const std::string_view p_name, std::vector<Sample>& p_samples) {
+	if (p_samples.empty()) {
+		return;
+	}
+
+	std::sort(p_samples.begin(), p_samples.end(), [](const Sample& a, const Sample& b) {
+		return a.nanoseconds < b.nanoseconds;
+	});
+
+	const usize count = p_samples.size();
+	const usize p99_index = static_cast<usize>(std::ceil(0.99 * static_cast<f64>(count))) - 1;
+
+	Result result;
+	result.name = p_name;
+	result.iterations = static_cast<u32>(count);
+	result.median_ns = count % 2 ? p_samples[count / 2].nanoseconds
+								 : (p_samples[count / 2 - 1].nanoseconds + p_samples[count / 2].nanoseconds) / 2.0;
+	result.p99_ns = p_samples[std::min(p99_index, count - 1)].nanoseconds;
+	result.min_ns = p_samples.front().nanoseconds;
+	result.max_ns = p_samples.back().nanoseconds;
+
+	f64 total_ns = 0.0;
+	u64 total_allocs = 0;
+	u64 total_bytes = 0;
+	for (const Sample& sample : p_samples) {
+		total_ns += sample.nanoseconds;
+		total_allocs += sample.allocations;
+		total_bytes += sample.bytes;
+	}
+
+	result.mean_ns = total_ns / static_cast<f64>(count);
+	result.allocs_per_op = static_cast<f64>(total_allocs) / static_cast<f64>(count);
+	result.bytes_per_op = static_cast<f64>(total_bytes) / static_cast<f64>(count);
+
+	m_results.push_back(std::move(result));
+}
+
+void Harness::_write_json(std::FILE* p_file) const {
+	std::fprintf(p_file, "{\n");
+	std::fprintf(
+		p_file,
+		"  \"nova_version\": \"%d.%d.%d\",\n",
+		NOVA_VERSION_MAJOR,
+		NOVA_VERSION_MINOR,
+		NOVA_VERSION_PATCH
+	);
+
+	std::fprintf(p_file, "  \"context\": {");
+	for (usize i = 0; i < m_context.size(); i++) {
+		std::fprintf(
+			p_file,
+			"%s\n    \"%s\": \"%s\"",
+			i ? "," : "",
+			escape_json(m_context[i].first).c_str(),
+			escape_json(m_context[i].second).c_str()
+		);
+	}
+	std::fprintf(p_file, "%s},\n", m_context.empty() ? "" : "\n  ");
+
+	std::fprintf(p_file, "  \"results\": [");
+	for (usize i = 0; i < m_results.size(); i++) {
+		const Result& result = m_results[i];
+		std::fprintf(
+			p_file,
+			"%s\n    {\"name\": \"%s\", \"iterations\": %u, \"median_ns\": %.1f, \"p99_ns\": %.1f, \"mean_ns\": %.1f, "
+			"\"min_ns\": %.1f, \"max_ns\": %.1f, \"allocs_per_op\": %.3f, \"bytes_per_op\": %.1f}",
+			i ? "," : "",
+			escape_json(result.name).c_str(),
+			result.iterations,
+			result.median_ns,
+			result.p99_ns,
+			result.mean_ns,
+			result.min_ns,
+			result.max_ns,
+			result.allocs_per_op,
+			result.bytes_per_op
+		);
+	}
+	std::fprintf(p_file, "%s],\n", m_results.empty() ? "" : "\n  ");
+
+	std::fprintf(p_file, "  \"skipped\": [");
+	for (usize i = 0; i < m_skipped.size(); i++) {
+		std::fprintf(
+			p_file,
+			"%s\n    {\"name\": \"%s\", \"reason\": \"%s\"}",
+			i ? "," : "",
+			escape_json(m_skipped[i].first).c_str(),
+			escape_json(m_skipped[i].second).c_str()
+		);
+	}
+	std::fprintf(p_file, "%s]\n", m_skipped.empty() ? "" : "\n  ");
+	std::fprintf(p_file, "}\n");
+}
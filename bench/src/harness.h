@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "alloc_counter.h"
+
+#include <nova/types.h>
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Nova::Bench {
+	struct Options {
+		u32 iterations = 100;
+		u32 warmup = 2;
+		std::string filter;
+		std::string json_path;
+	};
+
+	struct Sample {
+		f64 nanoseconds = 0.0;
+		u64 allocations = 0;
+		u64 bytes = 0;
+	};
+
+	struct Result {
+		std::string name;
+		u32 iterations = 0;
+		f64 median_ns = 0.0;
+		f64 p99_ns = 0.0;
+		f64 mean_ns = 0.0;
+		f64 min_ns = 0.0;
+		f64 max_ns = 0.0;
+		f64 allocs_per_op = 0.0;
+		f64 bytes_per_op = 0.0;
+	};
+
+	class Harness {
+	  public:
+		explicit Harness(Options options);
+
+		bool should_run(std::string_view name) const;
+		u32 get_iterations() const;
+		u32 get_macro_iterations() const;
+
+		void set_context(std::string_view key, std::string_view value);
+		void skip(std::string_view name, std::string_view reason);
+
+		/**
+		 * @brief Times op() on its own, once per iteration.
+		 */
+		template<typename Op>
+		void run(const std::string_view p_name, Op&& p_op, const u32 p_iterations = 0) {
+			run(
+				p_name,
+				[] { return 0; },
+				[&](int) { p_op(); },
+				[](int) {},
+				p_iterations
+			);
+		}
+
+		/**
+		 * @brief Times op(state) per iteration, excluding the setup() and teardown(state) calls around it.
+		 *
+		 * teardown(state) runs at the end of every iteration, after the sample is recorded.
+		 */
+		template<typename Setup, typename Op, typename Teardown>
+		void run(const std::string_view p_name, Setup&& p_setup, Op&& p_op, Teardown&& p_teardown, u32 p_iterations = 0) {
+			if (!should_run(p_name)) {
+				return;
+			}
+			if (p_iterations == 0) {
+				p_iterations = m_options.iterations;
+			}
+
+			using State = decltype(p_setup());
+
+			// Tears the state down even when op() throws, so a failed benchmark does not leak into the next one
+			struct TeardownGuard {
+				Teardown& teardown;
+				State& state;
+
+				~TeardownGuard() {
+					teardown(state);
+				}
+			};
+
+			std::vector<Sample> samples;
+			samples.reserve(p_iterations);
+
+			try {
+				for (u32 i = 0; i < m_options.warmup + p_iterations; i++) {
+					State state = p_setup();
+					const TeardownGuard guard {p_teardown, state};
+
+					const AllocStats before = get_thread_alloc_stats();
+					const auto start = std::chrono::steady_clock::now();
+					p_op(state);
+					const auto end = std::chrono::steady_clock::now();
+					const AllocStats after = get_thread_alloc_stats();
+
+					if (i >= m_options.warmup) {
+						samples.push_back({
+							.nanoseconds = std::chrono::duration<f64, std::nano>(end - start).count(),
+							.allocations = after.count - before.count,
+							.bytes = after.bytes - before.bytes,
+						});
+					}
+				}
+			} catch (const std::exception& e) {
+				skip(p_name, e.what());
+				return;
+			}
+
+			_record(p_name, samples);
+		}
+
+		void report() const;
+
+	  private:
+		Options m_options;
+		std::vector<std::pair<std::string, std::string>> m_context;
+		std::vector<std::pair<std::string, std::string>> m_skipped;
+		std::vector<Result> m_results;
+
+		void _record(std::string_view name, std::vector<Sample>& samples);
+		void _write_json(std::FILE* file) const;
+	};
+} // namespace Nova::Bench
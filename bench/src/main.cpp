@@ -0,0 +1,277 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "harness.h"
+#include "shaders.h"
+
+#include <nova/core/debug.h>
+#include <nova/platform/window_driver.h>
+#include <nova/render/render_device.h>
+#include <nova/render/render_driver.h>
+#include <nova/types.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace Nova;
+using namespace Nova::Bench;
+
+namespace {
+	static constexpr u32 TARGET_WIDTH = 256;
+	static constexpr u32 TARGET_HEIGHT = 256;
+
+	static constexpr std::string_view HEADLESS_BENCHMARKS[] = {
+		"shader_create",
+		"pipeline_create",
+		"command_buffer_allocate",
+		"command_buffer_begin_end",
+		"headless_frame",
+	};
+	static constexpr std::string_view WINDOW_BENCHMARKS[] = {"swapchain_recreate", "window_poll_events"};
+
+	void print_usage(const char* p_program) {
+		std::fprintf(
+			stderr,
+			"Usage: %s [--iterations N] [--warmup N] [--filter NAME] [--json PATH]\n"
+			"  --iterations N  Samples per micro benchmark, macro benchmarks use N/10 (default 100)\n"
+			"  --warmup N      Unrecorded iterations before sampling (default 2)\n"
+			"  --filter NAME   Only run benchmarks whose name contains NAME\n"
+			"  --json PATH     Write results to PATH instead of stdout\n",
+			p_program
+		);
+	}
+
+	bool parse_args(const int p_argc, char** p_argv, Options& p_options) {
+		for (int i = 1; i < p_argc; i++) {
+			const std::string_view arg = p_argv[i];
+			if (arg == "--help" || arg == "-h") {
+				return false;
+			}
+			if (i + 1 >= p_argc) {
+				std::fprintf(stderr, "Missing value for %s\n", p_argv[i]);
+				return false;
+			}
+			const char* value = p_argv[++i];
+			if (arg == "--iterations") {
+				p_options.iterations = static_cast<u32>(std::strtoul(value, nullptr, 10));
+			} else if (arg == "--warmup") {
+				p_options.warmup = static_cast<u32>(std::strtoul(value, nullptr, 10));
+			} else if (arg == "--filter") {
+				p_options.filter = value;
+			} else if (arg == "--json") {
+				p_options.json_path = value;
+			} else {
+				std::fprintf(stderr, "Unknown option %s\n", p_argv[i - 1]);
+				return false;
+			}
+		}
+		if (p_options.iterations == 0) {
+			std::fprintf(stderr, "--iterations must be greater than zero\n");
+			return false;
+		}
+		return true;
+	}
+
+	const char* get_device_type_name(const DeviceType p_type) {
+		switch (p_type) {
+			case DeviceType::INTEGRATED:
+				return "integrated";
+			case DeviceType::DISCRETE:
+				return "discrete";
+			case DeviceType::VIRTUAL:
+				return "virtual";
+			case DeviceType::CPU:
+				return "cpu";
+			default:
+				return "other";
+		}
+	}
+
+	/**
+	 * @brief Runs a group of benchmarks that share setup, skipping all of them if the setup fails.
+	 */
+	template<usize N>
+	void run_group(Harness& p_harness, const std::string_view (&p_names)[N], void (*p_group)(Harness&)) {
+		bool wanted = false;
+		for (const std::string_view name : p_names) {
+			wanted |= p_harness.should_run(name);
+		}
+		if (!wanted) {
+			return;
+		}
+
+		try {
+			p_group(p_harness);
+		} catch (const std::exception& e) {
+			for (const std::string_view name : p_names) {
+				p_harness.skip(name, e.what());
+			}
+		}
+	}
+
+	void bench_driver(Harness& p_harness) {
+		const u32 iterations = p_harness.get_macro_iterations();
+
+		p_harness.run(
+			"driver_create",
+			[] { return static_cast<RenderDriver*>(nullptr); },
+			[](RenderDriver*& p_rd) { p_rd = RenderDriver::create(RenderAPI::VULKAN); },
+			[](RenderDriver* p_rd) { delete p_rd; },
+			iterations
+		);
+
+		p_harness.run(
+			"device_select",
+			[] { return RenderDriver::create(RenderAPI::VULKAN); },
+			[](RenderDriver* p_rd) { p_rd->select_device(RenderDevice::choose_device(p_rd)); },
+			[](RenderDriver* p_rd) { delete p_rd; },
+			iterations
+		);
+	}
+
+	void bench_headless(Harness& p_harness) {
+		RenderDriver* rd = RenderDriver::create(RenderAPI::VULKAN);
+		const u32 device_idx = RenderDevice::choose_device(rd);
+		rd->select_device(device_idx);
+
+		const RenderDevice& device = rd->get_device(device_idx);
+		p_harness.set_context("api", rd->get_api_name() + " " + rd->get_api_version_string());
+		p_harness.set_context("device", device.name);
+		p_harness.set_context("device_type", get_device_type_name(device.type));
+
+		const u32 graphics_idx = rd->choose_queue_family(QueueType::GRAPHICS, nullptr);
+		if (graphics_idx == std::numeric_limits<u32>::max()) {
+			delete rd;
+			throw std::runtime_error("No graphics queue family");
+		}
+
+		QueueID queue = rd->get_queue(graphics_idx);
+		RenderTargetID target = rd->create_render_target(TARGET_WIDTH, TARGET_HEIGHT, DataFormat::R8G8B8A8_UNORM);
+		ShaderID frag = rd->create_shader(frag_bytes, ShaderStage::FRAGMENT);
+		ShaderID vert = rd->create_shader(vert_bytes, ShaderStage::VERTEX);
+
+		GraphicsPipelineParams params;
+		params.shaders = {vert, frag};
+		params.topology = PrimitiveTopology::TRIANGLE_LIST;
+		params.render_pass = rd->get_render_target_render_pass(target);
+
+		PipelineID pipeline = rd->create_pipeline(params);
+		CommandPoolID pool = rd->create_command_pool(queue);
+		CommandBufferID cmd = rd->create_command_buffer(pool);
+		FenceID fence = rd->create_fence();
+
+		p_harness.run(
+			"shader_create",
+			[] { return static_cast<ShaderID>(nullptr); },
+			[&](ShaderID& p_shader) { p_shader = rd->create_shader(vert_bytes, ShaderStage::VERTEX); },
+			[&](ShaderID p_shader) { rd->destroy_shader(p_shader); }
+		);
+
+		p_harness.run(
+			"pipeline_create",
+			[] { return static_cast<PipelineID>(nullptr); },
+			[&](PipelineID& p_pipeline) { p_pipeline = rd->create_pipeline(params); },
+			[&](PipelineID p_pipeline) { rd->destroy_pipeline(p_pipeline); }
+		);
+
+		// Command buffers are only released with their pool, so each sample gets a fresh one
+		p_harness.run(
+			"command_buffer_allocate",
+			[&] { return rd->create_command_pool(queue); },
+			[&](CommandPoolID p_pool) { static_cast<void>(rd->create_command_buffer(p_pool)); },
+			[&](CommandPoolID p_pool) { rd->destroy_command_pool(p_pool); }
+		);
+
+		p_harness.run("command_buffer_begin_end", [&] {
+			rd->begin_command_buffer(cmd);
+			rd->end_command_buffer(cmd);
+		});
+
+		p_harness.run(
+			"headless_frame",
+			[&] {
+				rd->begin_command_buffer(cmd);
+				rd->cmd_begin_render_pass(cmd, target, {0.0f, 0.0f, 0.0f, 1.0f});
+				rd->cmd_bind_pipeline(cmd, pipeline);
+				rd->cmd_set_viewport(cmd, 0.0f, 0.0f, TARGET_WIDTH, TARGET_HEIGHT);
+				rd->cmd_set_scissor(cmd, 0, 0, TARGET_WIDTH, TARGET_HEIGHT);
+				rd->cmd_draw(cmd, 3);
+				rd->cmd_end_render_pass(cmd);
+				rd->cmd_copy_render_target(cmd, target);
+				rd->end_command_buffer(cmd);
+				rd->submit(queue, cmd, fence);
+				rd->wait_for_fence(fence);
+				rd->reset_fence(fence);
+			},
+			p_harness.get_macro_iterations()
+		);
+
+		rd->wait_idle();
+		rd->destroy_fence(fence);
+		rd->destroy_command_pool(pool);
+		rd->destroy_pipeline(pipeline);
+		rd->destroy_shader(vert);
+		rd->destroy_shader(frag);
+		rd->destroy_render_target(target);
+		rd->free_queue(queue);
+		delete rd;
+	}
+
+	void bench_window(Harness& p_harness) {
+		WindowDriver* wd = WindowDriver::create();
+		RenderDriver* rd = RenderDriver::create(RenderAPI::VULKAN, wd);
+		WindowID window = wd->create_window("Nova Bench", 640, 480);
+		SurfaceID surface = rd->create_surface(window);
+
+		rd->select_device(RenderDevice::choose_device(rd, surface));
+		SwapchainID swapchain = rd->create_swapchain(surface);
+
+		p_harness.run(
+			"swapchain_recreate",
+			[&] { rd->resize_swapchain(swapchain); },
+			p_harness.get_macro_iterations()
+		);
+
+		p_harness.run("window_poll_events", [&] { wd->poll_events(); });
+
+		rd->wait_idle();
+		rd->destroy_swapchain(swapchain);
+		rd->destroy_surface(surface);
+		delete rd;
+		if (wd->get_window_count() > 0) {
+			wd->destroy_window(window);
+		}
+		delete wd;
+	}
+} // namespace
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!parse_args(argc, argv, options)) {
+		print_usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	// Keep driver logging out of the measurements
+	Debug::get_logger()->set_level(spdlog::level::warn);
+
+	Harness harness(options);
+
+	try {
+		bench_driver(harness);
+		run_group(harness, HEADLESS_BENCHMARKS, bench_headless);
+		run_group(harness, WINDOW_BENCHMARKS, bench_window);
+		harness.report();
+		return EXIT_SUCCESS;
+	} catch (const std::exception& e) {
+		NOVA_CRITICAL("Unhandled exception: {}", e.what());
+		return EXIT_FAILURE;
+	}
+}
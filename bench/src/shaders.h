@@ -0,0 +1,16 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/types.h>
+
+#include <vector>
+
+namespace Nova::Bench {
+	extern std::vector<u8> frag_bytes;
+	extern std::vector<u8> vert_bytes;
+} // namespace Nova::Bench
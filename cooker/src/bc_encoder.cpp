@@ -0,0 +1,914 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "bc_encoder.h"
+
+#include <nova/core/cpu.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <utility>
+
+#ifdef NOVA_ARCH_X86_64
+	#include <emmintrin.h>
+#endif
+
+using namespace Nova;
+using namespace Nova::Cooker;
+
+namespace {
+	static constexpr u32 BLOCK_TEXELS = 16;
+	static constexpr u32 POWER_ITERATIONS = 8;
+	static constexpr f32 MIN_DETERMINANT = 1e-6f;
+
+	// Fraction of the way from the first endpoint to the second that each index selects
+	static constexpr f32 BC1_WEIGHTS[] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+	static constexpr f32 BC4_WEIGHTS[] = {0.0f, 1.0f, 1.0f / 7, 2.0f / 7, 3.0f / 7, 4.0f / 7, 5.0f / 7, 6.0f / 7};
+	static constexpr f32 BC4_ALT_WEIGHTS[] = {0.0f, 1.0f, 1.0f / 5, 2.0f / 5, 3.0f / 5, 4.0f / 5};
+	static constexpr u32 BC7_WEIGHTS[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+	static constexpr std::array<f32, 16> BC7_FRACTIONS = [] {
+		std::array<f32, 16> fractions {};
+		for (u32 i = 0; i < 16; i++) {
+			fractions[i] = BC7_WEIGHTS[i] / 64.0f;
+		}
+		return fractions;
+	}();
+
+	static constexpr u32 BC7_WEIGHTS_2[] = {0, 21, 43, 64};
+	static constexpr u32 BC7_WEIGHTS_3[] = {0, 9, 18, 27, 37, 46, 55, 64};
+	static constexpr std::array<f32, 4> BC7_FRACTIONS_2 = {0.0f, 21.0f / 64, 43.0f / 64, 1.0f};
+	static constexpr std::array<f32, 8> BC7_FRACTIONS_3 = {
+		0.0f, 9.0f / 64, 18.0f / 64, 27.0f / 64, 37.0f / 64, 46.0f / 64, 55.0f / 64, 1.0f,
+	};
+
+	static constexpr u32 BC7_MODE_6 = 1 << 6;
+
+	/// Partitions shortlisted by a quick fit before the full search, high quality only
+	static constexpr u32 BC7_PARTITION_CANDIDATES = 4;
+
+	/// Subset of every texel for the 64 two subset partitions, bit i is texel i
+	static constexpr u16 BC7_PARTITIONS_2[64] = {
+		0xcccc, 0x8888, 0xeeee, 0xecc8, 0xc880, 0xfeec, 0xfec8, 0xec80, 0xc800, 0xffec, 0xfe80, 0xe800, 0xffe8,
+		0xff00, 0xfff0, 0xf000, 0xf710, 0x008e, 0x7100, 0x08ce, 0x008c, 0x7310, 0x3100, 0x8cce, 0x088c, 0x3110,
+		0x6666, 0x366c, 0x17e8, 0x0ff0, 0x718e, 0x399c, 0xaaaa, 0xf0f0, 0x5a5a, 0x33cc, 0x3c3c, 0x55aa, 0x9696,
+		0xa55a, 0x73ce, 0x13c8, 0x324c, 0x3bdc, 0x6996, 0xc33c, 0x9966, 0x0660, 0x0272, 0x04e4, 0x4e40, 0x2720,
+		0xc936, 0x936c, 0x39c6, 0x639c, 0x9336, 0x9cc6, 0x817e, 0xe718, 0xccf0, 0x0fcc, 0x7744, 0xee22,
+	};
+
+	/// Texel whose index drops its top bit in the second subset, the first subset always anchors at texel 0
+	static constexpr u8 BC7_ANCHORS_2[64] = {
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2,
+		8,  8,  2,  2,  15, 15, 6,  8,  2,  8,  15, 15, 2,  8,  2,  2,  2,  15, 15, 6,  6,  2,  6,  8,  15, 15,
+		2,  2,  15, 15, 15, 15, 15, 2,  2,  15,
+	};
+
+	/// Channel major copy of a block, so four texels of one channel fill a SIMD register
+	struct Texels {
+		alignas(16) f32 values[4][BLOCK_TEXELS];
+	};
+
+	struct Palette {
+		f32 entries[16][4];
+		u32 count = 0;
+	};
+
+	struct BitWriter {
+		u64 words[2] = {};
+		u32 position = 0;
+
+		void write(const u32 p_value, const u32 p_bits) {
+			for (u32 i = 0; i < p_bits; i++, position++) {
+				words[position / 64] |= u64((p_value >> i) & 1) << (position % 64);
+			}
+		}
+
+		void store(u8* p_out) const {
+			for (u32 i = 0; i < 16; i++) {
+				p_out[i] = static_cast<u8>(words[i / 8] >> (i % 8 * 8));
+			}
+		}
+	};
+
+	Texels to_texels(const ColorBlock& p_block, const u32 p_first_channel, const u32 p_channel_count) {
+		Texels texels {};
+		for (u32 c = 0; c < p_channel_count; c++) {
+			for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+				texels.values[c][i] = p_block.texels[i][p_first_channel + c];
+			}
+		}
+		return texels;
+	}
+
+	u32 get_refinements(const CompressionQuality p_quality) {
+		switch (p_quality) {
+			case CompressionQuality::FAST:
+				return 0;
+			case CompressionQuality::NORMAL:
+				return 2;
+			default:
+				return 8;
+		}
+	}
+
+	/**
+	 * @brief Picks the closest palette entry for every texel and returns the summed squared error.
+	 *
+	 * This is where encoding spends its time, so four texels are compared against each entry at once.
+	 */
+	f32 select_indices(const Texels& p_texels, const u32 p_channels, const Palette& p_palette, u8 (&p_indices)[16]) {
+#ifdef NOVA_ARCH_X86_64
+		__m128 total = _mm_setzero_ps();
+		for (u32 i = 0; i < BLOCK_TEXELS; i += 4) {
+			__m128 best = _mm_set1_ps(std::numeric_limits<f32>::max());
+			__m128i best_index = _mm_setzero_si128();
+			for (u32 k = 0; k < p_palette.count; k++) {
+				__m128 distance = _mm_setzero_ps();
+				for (u32 c = 0; c < p_channels; c++) {
+					const __m128 value = _mm_load_ps(&p_texels.values[c][i]);
+					const __m128 d = _mm_sub_ps(value, _mm_set1_ps(p_palette.entries[k][c]));
+					distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+				}
+				const __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+				best = _mm_min_ps(distance, best);
+				best_index = _mm_or_si128(
+					_mm_and_si128(closer, _mm_set1_epi32(static_cast<i32>(k))),
+					_mm_andnot_si128(closer, best_index)
+				);
+			}
+			alignas(16) i32 indices[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(indices), best_index);
+			for (u32 j = 0; j < 4; j++) {
+				p_indices[i + j] = static_cast<u8>(indices[j]);
+			}
+			total = _mm_add_ps(total, best);
+		}
+		alignas(16) f32 sums[4];
+		_mm_store_ps(sums, total);
+		return sums[0] + sums[1] + sums[2] + sums[3];
+#else
+		f32 total = 0.0f;
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			f32 best = std::numeric_limits<f32>::max();
+			for (u32 k = 0; k < p_palette.count; k++) {
+				f32 distance = 0.0f;
+				for (u32 c = 0; c < p_channels; c++) {
+					const f32 d = p_texels.values[c][i] - p_palette.entries[k][c];
+					distance += d * d;
+				}
+				if (distance < best) {
+					best = distance;
+					p_indices[i] = static_cast<u8>(k);
+				}
+			}
+			total += best;
+		}
+		return total;
+#endif
+	}
+
+	/// Endpoints at the extremes of the texels in the mask projected onto their principal axis
+	void get_principal_endpoints(
+		const Texels& p_texels,
+		const u32 p_channels,
+		f32 (&p_e0)[4],
+		f32 (&p_e1)[4],
+		const u16 p_mask = 0xffff
+	) {
+		const u32 count = static_cast<u32>(std::popcount(p_mask));
+		const auto selected = [p_mask](const u32 p_texel) { return (p_mask >> p_texel) & 1; };
+
+		f32 mean[4] = {};
+		for (u32 c = 0; c < p_channels; c++) {
+			for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+				if (selected(i)) {
+					mean[c] += p_texels.values[c][i];
+				}
+			}
+			mean[c] /= count;
+		}
+
+		f32 covariance[4][4] = {};
+		for (u32 a = 0; a < p_channels; a++) {
+			for (u32 b = a; b < p_channels; b++) {
+				f32 sum = 0.0f;
+				for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+					if (selected(i)) {
+						sum += (p_texels.values[a][i] - mean[a]) * (p_texels.values[b][i] - mean[b]);
+					}
+				}
+				covariance[a][b] = sum;
+				covariance[b][a] = sum;
+			}
+		}
+
+		// Power iteration converges on the dominant eigenvector
+		f32 axis[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+		for (u32 iteration = 0; iteration < POWER_ITERATIONS; iteration++) {
+			f32 next[4] = {};
+			f32 largest = 0.0f;
+			for (u32 a = 0; a < p_channels; a++) {
+				for (u32 b = 0; b < p_channels; b++) {
+					next[a] += covariance[a][b] * axis[b];
+				}
+				largest = std::max(largest, std::abs(next[a]));
+			}
+			if (largest <= 0.0f) {
+				break;
+			}
+			for (u32 c = 0; c < p_channels; c++) {
+				axis[c] = next[c] / largest;
+			}
+		}
+
+		f32 length = 0.0f;
+		for (u32 c = 0; c < p_channels; c++) {
+			length += axis[c] * axis[c];
+		}
+		length = std::sqrt(length);
+
+		f32 low = 0.0f;
+		f32 high = 0.0f;
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			if (!selected(i)) {
+				continue;
+			}
+			f32 t = 0.0f;
+			for (u32 c = 0; c < p_channels; c++) {
+				t += (p_texels.values[c][i] - mean[c]) * axis[c] / length;
+			}
+			low = std::min(low, t);
+			high = std::max(high, t);
+		}
+
+		for (u32 c = 0; c < 4; c++) {
+			const f32 direction = c < p_channels ? axis[c] / length : 0.0f;
+			p_e0[c] = std::clamp(mean[c] + low * direction, 0.0f, 255.0f);
+			p_e1[c] = std::clamp(mean[c] + high * direction, 0.0f, 255.0f);
+		}
+	}
+
+	/**
+	 * @brief Solves for the endpoints that minimize the error of the chosen indices.
+	 *
+	 * Indices at or past the weight count select constants rather than interpolated values and are ignored, as are
+	 * texels outside the mask. Returns false when the indices do not constrain both endpoints.
+	 */
+	bool refit_endpoints(
+		const Texels& p_texels,
+		const u32 p_channels,
+		const u8 (&p_indices)[16],
+		const std::span<const f32> p_weights,
+		f32 (&p_e0)[4],
+		f32 (&p_e1)[4],
+		const u16 p_mask = 0xffff
+	) {
+		f32 aa = 0.0f;
+		f32 ab = 0.0f;
+		f32 bb = 0.0f;
+		f32 ax[4] = {};
+		f32 bx[4] = {};
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			if (p_indices[i] >= p_weights.size() || !((p_mask >> i) & 1)) {
+				continue;
+			}
+			const f32 b = p_weights[p_indices[i]];
+			const f32 a = 1.0f - b;
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (u32 c = 0; c < p_channels; c++) {
+				ax[c] += a * p_texels.values[c][i];
+				bx[c] += b * p_texels.values[c][i];
+			}
+		}
+
+		const f32 determinant = aa * bb - ab * ab;
+		if (std::abs(determinant) < MIN_DETERMINANT) {
+			return false;
+		}
+		for (u32 c = 0; c < p_channels; c++) {
+			p_e0[c] = std::clamp((bb * ax[c] - ab * bx[c]) / determinant, 0.0f, 255.0f);
+			p_e1[c] = std::clamp((aa * bx[c] - ab * ax[c]) / determinant, 0.0f, 255.0f);
+		}
+		return true;
+	}
+
+	u16 pack_565(const f32 (&p_color)[4]) {
+		const u32 r = static_cast<u32>(p_color[0] * (31.0f / 255.0f) + 0.5f);
+		const u32 g = static_cast<u32>(p_color[1] * (63.0f / 255.0f) + 0.5f);
+		const u32 b = static_cast<u32>(p_color[2] * (31.0f / 255.0f) + 0.5f);
+		return static_cast<u16>((r << 11) | (g << 5) | b);
+	}
+
+	void unpack_565(const u16 p_color, f32 (&p_out)[4]) {
+		const u32 r = p_color >> 11;
+		const u32 g = (p_color >> 5) & 0x3f;
+		const u32 b = p_color & 0x1f;
+		p_out[0] = static_cast<f32>((r << 3) | (r >> 2));
+		p_out[1] = static_cast<f32>((g << 2) | (g >> 4));
+		p_out[2] = static_cast<f32>((b << 3) | (b >> 2));
+		p_out[3] = 0.0f;
+	}
+
+	void encode_color(const ColorBlock& p_block, u8* p_out, const CompressionQuality p_quality) {
+		const Texels texels = to_texels(p_block, 0, 3);
+		const u32 refinements = get_refinements(p_quality);
+
+		f32 e0[4];
+		f32 e1[4];
+		get_principal_endpoints(texels, 3, e0, e1);
+
+		u16 best_colors[2] = {};
+		u8 best_indices[16] = {};
+		f32 best_error = std::numeric_limits<f32>::max();
+
+		for (u32 pass = 0; pass <= refinements; pass++) {
+			u16 c0 = pack_565(e0);
+			u16 c1 = pack_565(e1);
+
+			// Four color mode needs the larger endpoint first, the refit below follows the swap
+			if (c0 < c1) {
+				std::swap(c0, c1);
+			}
+
+			Palette palette;
+			unpack_565(c0, palette.entries[0]);
+			unpack_565(c1, palette.entries[1]);
+			for (u32 c = 0; c < 3; c++) {
+				palette.entries[2][c] = (2.0f * palette.entries[0][c] + palette.entries[1][c]) / 3.0f;
+				palette.entries[3][c] = (palette.entries[0][c] + 2.0f * palette.entries[1][c]) / 3.0f;
+			}
+
+			// Equal endpoints select three color mode, where the last index is black
+			palette.count = c0 == c1 ? 1 : 4;
+
+			u8 indices[16];
+			const f32 error = select_indices(texels, 3, palette, indices);
+			if (error < best_error) {
+				best_error = error;
+				best_colors[0] = c0;
+				best_colors[1] = c1;
+				std::copy(std::begin(indices), std::end(indices), best_indices);
+			}
+
+			if (pass == refinements || !refit_endpoints(texels, 3, indices, BC1_WEIGHTS, e0, e1)) {
+				break;
+			}
+		}
+
+		u32 bits = 0;
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			bits |= u32(best_indices[i]) << (i * 2);
+		}
+		p_out[0] = static_cast<u8>(best_colors[0]);
+		p_out[1] = static_cast<u8>(best_colors[0] >> 8);
+		p_out[2] = static_cast<u8>(best_colors[1]);
+		p_out[3] = static_cast<u8>(best_colors[1] >> 8);
+		for (u32 i = 0; i < 4; i++) {
+			p_out[4 + i] = static_cast<u8>(bits >> (i * 8));
+		}
+	}
+
+	struct ChannelFit {
+		u8 endpoints[2] = {};
+		u8 indices[16] = {};
+		f32 error = std::numeric_limits<f32>::max();
+	};
+
+	/**
+	 * @brief Fits one BC4 mode, eight interpolated values when alternate is false, six plus 0 and 255 otherwise.
+	 */
+	void fit_channel(
+		const Texels& p_texels,
+		const bool p_alternate,
+		const f32 p_low,
+		const f32 p_high,
+		const u32 p_refinements,
+		ChannelFit& p_best
+	) {
+		f32 e0[4] = {p_alternate ? p_low : p_high};
+		f32 e1[4] = {p_alternate ? p_high : p_low};
+		const std::span<const f32> weights = p_alternate ? std::span<const f32>(BC4_ALT_WEIGHTS) : BC4_WEIGHTS;
+
+		for (u32 pass = 0; pass <= p_refinements; pass++) {
+			u8 a0 = static_cast<u8>(e0[0] + 0.5f);
+			u8 a1 = static_cast<u8>(e1[0] + 0.5f);
+
+			// The endpoint order selects the mode
+			if (p_alternate ? a0 > a1 : a0 < a1) {
+				std::swap(a0, a1);
+			}
+
+			Palette palette;
+			palette.count = 8;
+			palette.entries[0][0] = a0;
+			palette.entries[1][0] = a1;
+			if (p_alternate) {
+				for (u32 i = 2; i < 6; i++) {
+					palette.entries[i][0] = ((6 - i) * a0 + (i - 1) * a1) / 5.0f;
+				}
+				palette.entries[6][0] = 0.0f;
+				palette.entries[7][0] = 255.0f;
+			} else if (a0 == a1) {
+				palette.count = 1;
+			} else {
+				for (u32 i = 2; i < 8; i++) {
+					palette.entries[i][0] = ((8 - i) * a0 + (i - 1) * a1) / 7.0f;
+				}
+			}
+
+			u8 indices[16];
+			const f32 error = select_indices(p_texels, 1, palette, indices);
+			if (error < p_best.error) {
+				p_best.error = error;
+				p_best.endpoints[0] = a0;
+				p_best.endpoints[1] = a1;
+				std::copy(std::begin(indices), std::end(indices), p_best.indices);
+			}
+
+			if (pass == p_refinements || !refit_endpoints(p_texels, 1, indices, weights, e0, e1)) {
+				break;
+			}
+		}
+	}
+
+	void encode_channel(const ColorBlock& p_block, const u32 p_channel, u8* p_out, const CompressionQuality p_quality) {
+		const Texels texels = to_texels(p_block, p_channel, 1);
+		const u32 refinements = get_refinements(p_quality);
+
+		f32 low = 255.0f;
+		f32 high = 0.0f;
+		f32 inner_low = 255.0f;
+		f32 inner_high = 0.0f;
+		for (const f32 value : texels.values[0]) {
+			low = std::min(low, value);
+			high = std::max(high, value);
+			if (value > 0.0f && value < 255.0f) {
+				inner_low = std::min(inner_low, value);
+				inner_high = std::max(inner_high, value);
+			}
+		}
+
+		ChannelFit best;
+		fit_channel(texels, false, low, high, refinements, best);
+
+		// Blocks mixing the extremes with a narrow range do better when 0 and 255 come for free
+		if (p_quality != CompressionQuality::FAST && best.error > 0.0f && inner_low <= inner_high) {
+			fit_channel(texels, true, inner_low, inner_high, refinements, best);
+		}
+
+		u64 bits = 0;
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			bits |= u64(best.indices[i]) << (i * 3);
+		}
+		p_out[0] = best.endpoints[0];
+		p_out[1] = best.endpoints[1];
+		for (u32 i = 0; i < 6; i++) {
+			p_out[2 + i] = static_cast<u8>(bits >> (i * 8));
+		}
+	}
+
+	struct Bc7Endpoints {
+		u8 values[2][4] = {};
+		u32 pbits[2] = {};
+	};
+
+	/// Rounds an endpoint to seven bits plus the shared p-bit
+	void quantize_bc7(const f32 (&p_endpoint)[4], const u32 p_pbit, u8 (&p_out)[4], f32& p_error) {
+		p_error = 0.0f;
+		for (u32 c = 0; c < 4; c++) {
+			const f32 value = std::round((p_endpoint[c] - p_pbit) / 2.0f);
+			p_out[c] = static_cast<u8>(std::clamp(value, 0.0f, 127.0f));
+			const f32 d = static_cast<f32>(p_out[c] * 2 + p_pbit) - p_endpoint[c];
+			p_error += d * d;
+		}
+	}
+
+	f32 evaluate_bc7(const Texels& p_texels, const Bc7Endpoints& p_endpoints, u8 (&p_indices)[16]) {
+		Palette palette;
+		palette.count = 16;
+		for (u32 c = 0; c < 4; c++) {
+			const u32 v0 = p_endpoints.values[0][c] * 2 + p_endpoints.pbits[0];
+			const u32 v1 = p_endpoints.values[1][c] * 2 + p_endpoints.pbits[1];
+			for (u32 i = 0; i < 16; i++) {
+				palette.entries[i][c] = static_cast<f32>(((64 - BC7_WEIGHTS[i]) * v0 + BC7_WEIGHTS[i] * v1 + 32) >> 6);
+			}
+		}
+		return select_indices(p_texels, 4, palette, p_indices);
+	}
+
+	/// Opaque two subset modes, tried at high quality on blocks with more than one gradient
+	struct Bc7PartitionMode {
+		u32 mode;
+		u32 endpoint_bits; // Per channel, before the p-bit
+		bool shared_pbit; // One p-bit per subset rather than per endpoint
+		std::span<const u32> weights;
+		std::span<const f32> fractions;
+	};
+
+	static constexpr Bc7PartitionMode BC7_MODE_1 = {1, 6, true, BC7_WEIGHTS_3, BC7_FRACTIONS_3};
+	static constexpr Bc7PartitionMode BC7_MODE_3 = {3, 7, false, BC7_WEIGHTS_2, BC7_FRACTIONS_2};
+
+	struct Bc7Subset {
+		u8 values[2][3] = {};
+		u32 pbits[2] = {};
+	};
+
+	struct Bc7Partitioned {
+		const Bc7PartitionMode* mode = nullptr;
+		u32 partition = 0;
+		Bc7Subset subsets[2];
+		u8 indices[16] = {};
+		f32 error = std::numeric_limits<f32>::max();
+	};
+
+	/// Expands an endpoint channel and its p-bit to eight bits by repeating the top bits
+	u32 dequantize_bc7(const u32 p_value, const u32 p_pbit, const u32 p_bits) {
+		const u32 value = (p_value << 1) | p_pbit;
+		return (value << (7 - p_bits)) | (value >> (2 * p_bits - 6));
+	}
+
+	u8 quantize_bc7_channel(const f32 p_value, const u32 p_pbit, const u32 p_bits) {
+		const i32 max = (1 << p_bits) - 1;
+		const i32 estimate = static_cast<i32>(std::round(p_value * max / 255.0f));
+
+		u8 best = 0;
+		f32 best_error = std::numeric_limits<f32>::max();
+		for (i32 value = std::max(estimate - 1, 0); value <= std::min(estimate + 1, max); value++) {
+			const f32 error = std::abs(static_cast<f32>(dequantize_bc7(value, p_pbit, p_bits)) - p_value);
+			if (error < best_error) {
+				best = static_cast<u8>(value);
+				best_error = error;
+			}
+		}
+		return best;
+	}
+
+	/// Picks the closest palette entry of the subset for each of its texels, alpha is always opaque
+	f32 evaluate_bc7_subset(
+		const Texels& p_texels,
+		const u16 p_mask,
+		const Bc7PartitionMode& p_mode,
+		const Bc7Subset& p_subset,
+		u8 (&p_indices)[16]
+	) {
+		f32 palette[8][3];
+		for (u32 c = 0; c < 3; c++) {
+			const u32 v0 = dequantize_bc7(p_subset.values[0][c], p_subset.pbits[0], p_mode.endpoint_bits);
+			const u32 v1 = dequantize_bc7(p_subset.values[1][c], p_subset.pbits[1], p_mode.endpoint_bits);
+			for (u32 i = 0; i < p_mode.weights.size(); i++) {
+				const u32 weight = p_mode.weights[i];
+				palette[i][c] = static_cast<f32>(((64 - weight) * v0 + weight * v1 + 32) >> 6);
+			}
+		}
+
+		f32 total = 0.0f;
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			if (!((p_mask >> i) & 1)) {
+				continue;
+			}
+			f32 best = std::numeric_limits<f32>::max();
+			for (u32 k = 0; k < p_mode.weights.size(); k++) {
+				f32 distance = 0.0f;
+				for (u32 c = 0; c < 3; c++) {
+					const f32 d = p_texels.values[c][i] - palette[k][c];
+					distance += d * d;
+				}
+				if (distance < best) {
+					best = distance;
+					p_indices[i] = static_cast<u8>(k);
+				}
+			}
+			total += best;
+		}
+		return total;
+	}
+
+	/// Fits the texels of one subset like mode 6 does for the whole block, trying every allowed p-bit pairing
+	f32 fit_bc7_subset(
+		const Texels& p_texels,
+		const u16 p_mask,
+		const Bc7PartitionMode& p_mode,
+		const u32 p_refinements,
+		Bc7Subset& p_subset,
+		u8 (&p_indices)[16]
+	) {
+		f32 e0[4];
+		f32 e1[4];
+		get_principal_endpoints(p_texels, 3, e0, e1, p_mask);
+
+		f32 best_error = std::numeric_limits<f32>::max();
+		for (u32 pass = 0; pass <= p_refinements; pass++) {
+			u8 indices[16] = {};
+			u8 pass_indices[16] = {};
+			f32 pass_error = std::numeric_limits<f32>::max();
+			const f32 previous_error = best_error;
+
+			for (u32 p0 = 0; p0 < 2; p0++) {
+				for (u32 p1 = 0; p1 < 2; p1++) {
+					if (p_mode.shared_pbit && p0 != p1) {
+						continue;
+					}
+					Bc7Subset candidate;
+					candidate.pbits[0] = p0;
+					candidate.pbits[1] = p1;
+					for (u32 c = 0; c < 3; c++) {
+						candidate.values[0][c] = quantize_bc7_channel(e0[c], p0, p_mode.endpoint_bits);
+						candidate.values[1][c] = quantize_bc7_channel(e1[c], p1, p_mode.endpoint_bits);
+					}
+
+					const f32 error = evaluate_bc7_subset(p_texels, p_mask, p_mode, candidate, indices);
+					if (error < pass_error) {
+						pass_error = error;
+						std::copy(std::begin(indices), std::end(indices), pass_indices);
+					}
+					if (error < best_error) {
+						best_error = error;
+						p_subset = candidate;
+						for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+							if ((p_mask >> i) & 1) {
+								p_indices[i] = indices[i];
+							}
+						}
+					}
+				}
+			}
+
+			// Every subset of every candidate partition is refined, so stop as soon as a pass stops helping
+			if (pass == p_refinements || best_error >= previous_error
+				|| !refit_endpoints(p_texels, 3, pass_indices, p_mode.fractions, e0, e1, p_mask)) {
+				break;
+			}
+		}
+		return best_error;
+	}
+
+	/**
+	 * @brief Expected squared error of fitting the RGB texels in the mask with one line of four palette entries.
+	 *
+	 * The distance to the principal axis plus the spacing between entries along it, roughly what mode 3 would leave
+	 * behind before endpoint quantization. Cheap enough to rank every partition.
+	 */
+	f32 estimate_bc7_subset(const Texels& p_texels, const u16 p_mask) {
+		f32 count = 0.0f;
+		f32 sum[3] = {};
+		f32 products[3][3] = {};
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			const f32 weight = static_cast<f32>((p_mask >> i) & 1);
+			count += weight;
+			for (u32 a = 0; a < 3; a++) {
+				const f32 value = weight * p_texels.values[a][i];
+				sum[a] += value;
+				for (u32 b = a; b < 3; b++) {
+					products[a][b] += value * p_texels.values[b][i];
+				}
+			}
+		}
+		if (count == 0.0f) {
+			return 0.0f;
+		}
+
+		f32 covariance[3][3];
+		for (u32 a = 0; a < 3; a++) {
+			for (u32 b = a; b < 3; b++) {
+				covariance[a][b] = products[a][b] - sum[a] * sum[b] / count;
+				covariance[b][a] = covariance[a][b];
+			}
+		}
+
+		// Power iteration for the variance along the principal axis, the rest is what a line cannot represent
+		f32 axis[3] = {1.0f, 1.0f, 1.0f};
+		f32 largest = 0.0f;
+		for (u32 iteration = 0; iteration < POWER_ITERATIONS; iteration++) {
+			f32 next[3] = {};
+			largest = 0.0f;
+			for (u32 a = 0; a < 3; a++) {
+				for (u32 b = 0; b < 3; b++) {
+					next[a] += covariance[a][b] * axis[b];
+				}
+				largest = std::max(largest, std::abs(next[a]));
+			}
+			if (largest <= 0.0f) {
+				break;
+			}
+			for (u32 c = 0; c < 3; c++) {
+				axis[c] = next[c] / largest;
+			}
+		}
+
+		f32 along = 0.0f;
+		f32 length = 0.0f;
+		for (u32 a = 0; a < 3; a++) {
+			for (u32 b = 0; b < 3; b++) {
+				along += axis[a] * covariance[a][b] * axis[b];
+			}
+			length += axis[a] * axis[a];
+		}
+		// Texels spread evenly along the axis are off by a ninth of its variance with four entries, (4 - 1)^2
+		const f32 trace = covariance[0][0] + covariance[1][1] + covariance[2][2];
+		const f32 variance = length > 0.0f ? along / length : 0.0f;
+		return std::max(trace - variance, 0.0f) + variance / 9.0f;
+	}
+
+	void fit_bc7_partition(
+		const Texels& p_texels,
+		const u32 p_partition,
+		const Bc7PartitionMode& p_mode,
+		const u32 p_refinements,
+		Bc7Partitioned& p_out
+	) {
+		const u16 second = BC7_PARTITIONS_2[p_partition];
+		const u16 masks[2] = {static_cast<u16>(~second), second};
+
+		p_out.mode = &p_mode;
+		p_out.partition = p_partition;
+		p_out.error = 0.0f;
+		for (u32 s = 0; s < 2; s++) {
+			p_out.error += fit_bc7_subset(p_texels, masks[s], p_mode, p_refinements, p_out.subsets[s], p_out.indices);
+		}
+	}
+
+	void write_bc7_partitioned(Bc7Partitioned p_block, u8* p_out) {
+		const Bc7PartitionMode& mode = *p_block.mode;
+		const u32 index_bits = std::bit_width(mode.weights.size() - 1);
+		const u32 anchors[2] = {0, BC7_ANCHORS_2[p_block.partition]};
+		const u16 second = BC7_PARTITIONS_2[p_block.partition];
+
+		// The anchor index of each subset drops its top bit, so it must select the lower half of the palette
+		for (u32 s = 0; s < 2; s++) {
+			if (p_block.indices[anchors[s]] < mode.weights.size() / 2) {
+				continue;
+			}
+			Bc7Subset& subset = p_block.subsets[s];
+			std::swap(subset.values[0], subset.values[1]);
+			std::swap(subset.pbits[0], subset.pbits[1]);
+			for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+				if (((second >> i) & 1) == s) {
+					p_block.indices[i] = static_cast<u8>(mode.weights.size() - 1 - p_block.indices[i]);
+				}
+			}
+		}
+
+		BitWriter writer;
+		writer.write(1u << mode.mode, mode.mode + 1);
+		writer.write(p_block.partition, 6);
+		for (u32 c = 0; c < 3; c++) {
+			for (const Bc7Subset& subset : p_block.subsets) {
+				writer.write(subset.values[0][c], mode.endpoint_bits);
+				writer.write(subset.values[1][c], mode.endpoint_bits);
+			}
+		}
+		for (const Bc7Subset& subset : p_block.subsets) {
+			writer.write(subset.pbits[0], 1);
+			if (!mode.shared_pbit) {
+				writer.write(subset.pbits[1], 1);
+			}
+		}
+		for (u32 i = 0; i < BLOCK_TEXELS; i++) {
+			writer.write(p_block.indices[i], i == anchors[0] || i == anchors[1] ? index_bits - 1 : index_bits);
+		}
+		writer.store(p_out);
+	}
+} // namespace
+
+void Cooker::encode_bc1(const ColorBlock& p_block, u8* p_out, const CompressionQuality p_quality) {
+	encode_color(p_block, p_out, p_quality);
+}
+
+void Cooker::encode_bc3(const ColorBlock& p_block, u8* p_out, const CompressionQuality p_quality) {
+	encode_channel(p_block, 3, p_out, p_quality);
+	encode_color(p_block, p_out + 8, p_quality);
+}
+
+void Cooker::encode_bc4(const ColorBlock& p_block, const u32 p_channel, u8* p_out, const CompressionQuality p_quality) {
+	encode_channel(p_block, p_channel, p_out, p_quality);
+}
+
+void Cooker::encode_bc5(const ColorBlock& p_block, u8* p_out, const CompressionQuality p_quality) {
+	encode_channel(p_block, 0, p_out, p_quality);
+	encode_channel(p_block, 1, p_out + 8, p_quality);
+}
+
+void Cooker::encode_bc7(const ColorBlock& p_block, u8* p_out, const CompressionQuality p_quality) {
+	const Texels texels = to_texels(p_block, 0, 4);
+	const u32 refinements = get_refinements(p_quality);
+
+	f32 e0[4];
+	f32 e1[4];
+	get_principal_endpoints(texels, 4, e0, e1);
+
+	Bc7Endpoints best;
+	u8 best_indices[16] = {};
+	f32 best_error = std::numeric_limits<f32>::max();
+
+	for (u32 pass = 0; pass <= refinements; pass++) {
+		// Each endpoint rounded with either p-bit, and the p-bit closest to the unquantized endpoint
+		u8 quantized[2][2][4];
+		f32 quantize_error[2][2];
+		u32 pbits[2];
+		for (u32 e = 0; e < 2; e++) {
+			for (u32 p = 0; p < 2; p++) {
+				quantize_bc7(e == 0 ? e0 : e1, p, quantized[e][p], quantize_error[e][p]);
+			}
+			pbits[e] = quantize_error[e][1] < quantize_error[e][0] ? 1 : 0;
+		}
+
+		u8 indices[16];
+		f32 pass_error = std::numeric_limits<f32>::max();
+		u8 pass_indices[16] = {};
+		Bc7Endpoints pass_endpoints;
+
+		// High quality tries every p-bit pairing against the block, otherwise each endpoint keeps its closest
+		for (u32 p0 = 0; p0 < 2; p0++) {
+			for (u32 p1 = 0; p1 < 2; p1++) {
+				if (p_quality != CompressionQuality::HIGH && (p0 != pbits[0] || p1 != pbits[1])) {
+					continue;
+				}
+				Bc7Endpoints candidate;
+				std::copy(std::begin(quantized[0][p0]), std::end(quantized[0][p0]), candidate.values[0]);
+				std::copy(std::begin(quantized[1][p1]), std::end(quantized[1][p1]), candidate.values[1]);
+				candidate.pbits[0] = p0;
+				candidate.pbits[1] = p1;
+
+				const f32 error = evaluate_bc7(texels, candidate, indices);
+				if (error < pass_error) {
+					pass_error = error;
+					pass_endpoints = candidate;
+					std::copy(std::begin(indices), std::end(indices), pass_indices);
+				}
+			}
+		}
+
+		if (pass_error < best_error) {
+			best_error = pass_error;
+			best = pass_endpoints;
+			std::copy(std::begin(pass_indices), std::end(pass_indices), best_indices);
+		}
+
+		if (pass == refinements || !refit_endpoints(texels, 4, pass_indices, BC7_FRACTIONS, e0, e1)) {
+			break;
+		}
+	}
+
+	// Modes 1 and 3 only store opaque colors, but split the block into two subsets with their own endpoints
+	const bool opaque = std::all_of(std::begin(p_block.texels), std::end(p_block.texels), [](const u8 (&p_texel)[4]) {
+		return p_texel[3] == 255;
+	});
+	if (p_quality == CompressionQuality::HIGH && opaque) {
+		// How well each partition could do picks the few worth fitting
+		std::array<std::pair<f32, u32>, 64> estimates;
+		for (u32 partition = 0; partition < 64; partition++) {
+			const u16 second = BC7_PARTITIONS_2[partition];
+			const f32 error =
+				estimate_bc7_subset(texels, static_cast<u16>(~second)) + estimate_bc7_subset(texels, second);
+			estimates[partition] = {error, partition};
+		}
+		std::partial_sort(estimates.begin(), estimates.begin() + BC7_PARTITION_CANDIDATES, estimates.end());
+
+		Bc7Partitioned best_partitioned;
+		for (u32 i = 0; i < BC7_PARTITION_CANDIDATES; i++) {
+			for (const Bc7PartitionMode* mode : {&BC7_MODE_1, &BC7_MODE_3}) {
+				Bc7Partitioned candidate;
+				fit_bc7_partition(texels, estimates[i].second, *mode, refinements, candidate);
+				if (candidate.error < best_partitioned.error) {
+					best_partitioned = candidate;
+				}
+			}
+		}
+
+		if (best_partitioned.error < best_error) {
+			write_bc7_partitioned(best_partitioned, p_out);
+			return;
+		}
+	}
+
+	// The first index drops its top bit, so it must select the lower half of the palette
+	if (best_indices[0] >= 8) {
+		std::swap(best.values[0], best.values[1]);
+		std::swap(best.pbits[0], best.pbits[1]);
+		for (u8& index : best_indices) {
+			index = static_cast<u8>(15 - index);
+		}
+	}
+
+	BitWriter writer;
+	writer.write(BC7_MODE_6, 7);
+	for (u32 c = 0; c < 4; c++) {
+		writer.write(best.values[0][c], 7);
+		writer.write(best.values[1][c], 7);
+	}
+	writer.write(best.pbits[0], 1);
+	writer.write(best.pbits[1], 1);
+	writer.write(best_indices[0], 3);
+	for (u32 i = 1; i < BLOCK_TEXELS; i++) {
+		writer.write(best_indices[i], 4);
+	}
+	writer.store(p_out);
+}
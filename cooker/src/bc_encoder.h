@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/types.h>
+
+namespace Nova::Cooker {
+	enum class CompressionQuality {
+		FAST,   // Endpoints from the principal axis only
+		NORMAL, // Plus a few least squares refinements
+		HIGH,   // Plus more refinements and alternate block modes
+	};
+
+	/// 4x4 RGBA8 texels in row order
+	struct ColorBlock {
+		u8 texels[16][4];
+	};
+
+	/// Opaque color in 8 bytes
+	void encode_bc1(const ColorBlock& block, u8* out, CompressionQuality quality);
+
+	/// A BC4 alpha block followed by a BC1 color block, 16 bytes
+	void encode_bc3(const ColorBlock& block, u8* out, CompressionQuality quality);
+
+	/// One channel of the block in 8 bytes
+	void encode_bc4(const ColorBlock& block, u32 channel, u8* out, CompressionQuality quality);
+
+	/// Red and green as two BC4 blocks, 16 bytes
+	void encode_bc5(const ColorBlock& block, u8* out, CompressionQuality quality);
+
+	/**
+	 * @brief Encodes a BC7 block in 16 bytes.
+	 *
+	 * Mode 6, a single RGBA endpoint pair with 4-bit indices, is used unless high quality finds an opaque block is
+	 * better split in two subsets with mode 1 or 3.
+	 */
+	void encode_bc7(const ColorBlock& block, u8* out, CompressionQuality quality);
+} // namespace Nova::Cooker
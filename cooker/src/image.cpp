@@ -0,0 +1,282 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "image.h"
+
+#include <nova/render/format_conversion.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+using namespace Nova;
+using namespace Nova::Cooker;
+
+namespace {
+	static constexpr usize TGA_HEADER_SIZE = 18;
+	static constexpr u8 TGA_TRUECOLOR = 2;
+	static constexpr u8 TGA_GRAYSCALE = 3;
+	static constexpr u8 TGA_RLE = 8;
+	static constexpr u8 TGA_TOP_LEFT = 0x20;
+
+	std::vector<u8> read_file(const std::filesystem::path& p_path) {
+		std::ifstream file(p_path, std::ios::binary);
+		if (!file) {
+			throw std::runtime_error("Failed to open image: " + p_path.string());
+		}
+		return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	}
+
+	/// Expands 1, 3 or 4 channel texels to RGBA8, swapping red and blue when the source is BGR ordered
+	void expand_to_rgba8(
+		const std::span<const u8> p_src,
+		const u32 p_channels,
+		const bool p_bgr,
+		const std::span<u8> p_dst
+	) {
+		switch (p_channels) {
+			case 1:
+				expand_r8_rgba8(p_src, p_dst);
+				return;
+			case 3:
+				expand_rgb8_rgba8(p_src, p_dst);
+				break;
+			case 4:
+				std::copy(p_src.begin(), p_src.end(), p_dst.begin());
+				break;
+			default:
+				throw std::runtime_error("Unsupported channel count " + std::to_string(p_channels));
+		}
+		if (p_bgr) {
+			swizzle_rgba8_bgra8(p_dst, p_dst);
+		}
+	}
+
+	Image load_tga(const std::span<const u8> p_bytes) {
+		if (p_bytes.size() < TGA_HEADER_SIZE) {
+			throw std::runtime_error("TGA image is truncated");
+		}
+
+		const u8 id_length = p_bytes[0];
+		const u8 color_map = p_bytes[1];
+		const u8 type = p_bytes[2];
+		const u32 width = p_bytes[12] | (p_bytes[13] << 8);
+		const u32 height = p_bytes[14] | (p_bytes[15] << 8);
+		const u32 channels = p_bytes[16] / 8;
+		const u8 descriptor = p_bytes[17];
+
+		const u8 base_type = type & ~TGA_RLE;
+		if (color_map != 0 || (base_type != TGA_TRUECOLOR && base_type != TGA_GRAYSCALE)) {
+			throw std::runtime_error("Only truecolor and grayscale TGA images are supported");
+		}
+		if ((base_type == TGA_GRAYSCALE) != (channels == 1) || (channels != 1 && channels != 3 && channels != 4)) {
+			throw std::runtime_error("Unsupported TGA pixel depth " + std::to_string(p_bytes[16]));
+		}
+		if (width == 0 || height == 0) {
+			throw std::runtime_error("TGA image is empty");
+		}
+
+		const usize pixel_count = usize(width) * height;
+		std::vector<u8> raw(pixel_count * channels);
+		std::span<const u8> data = p_bytes.subspan(std::min(TGA_HEADER_SIZE + id_length, p_bytes.size()));
+
+		if (type & TGA_RLE) {
+			usize pixel = 0;
+			usize offset = 0;
+			while (pixel < pixel_count) {
+				if (offset >= data.size()) {
+					throw std::runtime_error("TGA image is truncated");
+				}
+				const u8 packet = data[offset++];
+				const usize count = std::min<usize>((packet & 0x7f) + 1, pixel_count - pixel);
+				const usize bytes = (packet & 0x80) ? channels : count * channels;
+				if (bytes > data.size() - offset) {
+					throw std::runtime_error("TGA image is truncated");
+				}
+				for (usize i = 0; i < count; i++) {
+					// Run packets repeat one pixel, raw packets copy count pixels
+					const usize src = offset + ((packet & 0x80) ? 0 : i * channels);
+					std::copy_n(data.begin() + src, channels, raw.begin() + (pixel + i) * channels);
+				}
+				pixel += count;
+				offset += bytes;
+			}
+		} else {
+			if (data.size() < raw.size()) {
+				throw std::runtime_error("TGA image is truncated");
+			}
+			std::copy_n(data.begin(), raw.size(), raw.begin());
+		}
+
+		Image image;
+		image.width = width;
+		image.height = height;
+		image.pixels.resize(pixel_count * 4);
+		expand_to_rgba8(raw, channels, true, image.pixels);
+
+		// Rows are stored bottom up unless the descriptor says otherwise
+		if (!(descriptor & TGA_TOP_LEFT)) {
+			const usize row = usize(width) * 4;
+			for (u32 y = 0; y < height / 2; y++) {
+				std::swap_ranges(
+					image.pixels.begin() + y * row,
+					image.pixels.begin() + (y + 1) * row,
+					image.pixels.begin() + (height - 1 - y) * row
+				);
+			}
+		}
+		return image;
+	}
+
+	Image load_pnm(const std::span<const u8> p_bytes) {
+		usize offset = 2;
+		const auto next_value = [&]() -> u32 {
+			while (offset < p_bytes.size()) {
+				if (p_bytes[offset] == '#') {
+					while (offset < p_bytes.size() && p_bytes[offset] != '\n') {
+						offset++;
+					}
+				} else if (std::isspace(p_bytes[offset])) {
+					offset++;
+				} else {
+					break;
+				}
+			}
+			u32 value = 0;
+			const usize start = offset;
+			while (offset < p_bytes.size() && std::isdigit(p_bytes[offset])) {
+				value = value * 10 + (p_bytes[offset++] - '0');
+			}
+			if (offset == start) {
+				throw std::runtime_error("Malformed PNM header");
+			}
+			return value;
+		};
+
+		const u32 channels = p_bytes[1] == '5' ? 1 : 3;
+		const u32 width = next_value();
+		const u32 height = next_value();
+		if (next_value() != 255) {
+			throw std::runtime_error("Only 8-bit PNM images are supported");
+		}
+		// Exactly one whitespace byte separates the header from the texels
+		offset++;
+
+		const usize size = usize(width) * height * channels;
+		if (width == 0 || height == 0 || offset > p_bytes.size() || p_bytes.size() - offset < size) {
+			throw std::runtime_error("PNM image is truncated");
+		}
+
+		Image image;
+		image.width = width;
+		image.height = height;
+		image.pixels.resize(usize(width) * height * 4);
+		expand_to_rgba8(p_bytes.subspan(offset, size), channels, false, image.pixels);
+		return image;
+	}
+
+	u8 encode_srgb(const f32 p_value) {
+		const f32 c = std::clamp(p_value, 0.0f, 1.0f);
+		const f32 s = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+		return static_cast<u8>(s * 255.0f + 0.5f);
+	}
+
+	u8 encode_unorm(const f32 p_value) {
+		return static_cast<u8>(std::clamp(p_value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+} // namespace
+
+bool Image::has_alpha() const {
+	for (usize i = 3; i < pixels.size(); i += 4) {
+		if (pixels[i] != 255) {
+			return true;
+		}
+	}
+	return false;
+}
+
+Image Cooker::load_image(const std::filesystem::path& p_path) {
+	const std::vector<u8> bytes = read_file(p_path);
+	if (bytes.size() >= 2 && bytes[0] == 'P' && (bytes[1] == '5' || bytes[1] == '6')) {
+		return load_pnm(bytes);
+	}
+
+	// TGA has no magic, fall back on the extension
+	std::string extension = p_path.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](const char c) {
+		return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+	});
+	if (extension == ".tga") {
+		return load_tga(bytes);
+	}
+	throw std::runtime_error("Unsupported image format: " + p_path.string());
+}
+
+std::vector<Image> Cooker::generate_mips(const Image& p_image, const bool p_srgb) {
+	std::vector<Image> mips;
+	mips.push_back(p_image);
+
+	u32 width = p_image.width;
+	u32 height = p_image.height;
+	std::vector<f32> level(p_image.pixels.size());
+	if (p_srgb) {
+		convert_srgba8_to_linear(p_image.pixels, level);
+	} else {
+		for (usize i = 0; i < level.size(); i++) {
+			level[i] = p_image.pixels[i] / 255.0f;
+		}
+	}
+
+	while (width > 1 || height > 1) {
+		const u32 mip_width = std::max(width / 2, 1u);
+		const u32 mip_height = std::max(height / 2, 1u);
+		std::vector<f32> mip(usize(mip_width) * mip_height * 4);
+
+		// Odd sizes drop their last row or column, a side that is already one texel wide is sampled twice
+		for (u32 y = 0; y < mip_height; y++) {
+			const u32 y0 = std::min(y * 2, height - 1);
+			const u32 y1 = std::min(y * 2 + 1, height - 1);
+			for (u32 x = 0; x < mip_width; x++) {
+				const u32 x0 = std::min(x * 2, width - 1);
+				const u32 x1 = std::min(x * 2 + 1, width - 1);
+				const std::array<usize, 4> texels = {
+					(usize(y0) * width + x0) * 4,
+					(usize(y0) * width + x1) * 4,
+					(usize(y1) * width + x0) * 4,
+					(usize(y1) * width + x1) * 4,
+				};
+				f32* out = &mip[(usize(y) * mip_width + x) * 4];
+				for (u32 c = 0; c < 4; c++) {
+					f32 sum = 0.0f;
+					for (const usize texel : texels) {
+						sum += level[texel + c];
+					}
+					out[c] = 0.25f * sum;
+				}
+			}
+		}
+
+		Image image;
+		image.width = mip_width;
+		image.height = mip_height;
+		image.pixels.resize(mip.size());
+		for (usize i = 0; i < mip.size(); i++) {
+			image.pixels[i] = (p_srgb && i % 4 != 3) ? encode_srgb(mip[i]) : encode_unorm(mip[i]);
+		}
+		mips.push_back(std::move(image));
+
+		level = std::move(mip);
+		width = mip_width;
+		height = mip_height;
+	}
+	return mips;
+}
@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/types.h>
+
+#include <filesystem>
+#include <vector>
+
+namespace Nova::Cooker {
+	/// Tightly packed RGBA8 texels, top row first
+	struct Image {
+		u32 width = 0;
+		u32 height = 0;
+		std::vector<u8> pixels;
+
+		bool has_alpha() const;
+	};
+
+	/**
+	 * @brief Loads a TGA (uncompressed or RLE, 8, 24 or 32-bit) or binary PGM/PPM image, expanded to RGBA8.
+	 */
+	Image load_image(const std::filesystem::path& path);
+
+	/**
+	 * @brief Builds the mip chain down to 1x1 with a box filter, the first level is the image itself.
+	 *
+	 * Filtering happens in linear space, colors are decoded first when srgb is set. Levels are filtered from the
+	 * unquantized previous level so rounding does not accumulate down the chain.
+	 */
+	std::vector<Image> generate_mips(const Image& image, bool srgb);
+} // namespace Nova::Cooker
@@ -0,0 +1,403 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "image.h"
+#include "mesh_optimizer.h"
+#include "mesh_simplifier.h"
+#include "obj_loader.h"
+#include "texture_compressor.h"
+
+#include <nova/core/cpu.h>
+#include <nova/core/debug.h>
+#include <nova/render/mesh_asset.h>
+#include <nova/render/texture_asset.h>
+#include <nova/render/vertex_format.h>
+#include <nova/types.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string_view>
+
+using namespace Nova;
+using namespace Nova::Cooker;
+
+namespace {
+	/// LODs that remove less than this fraction of the previous level are not worth their memory
+	static constexpr f32 MIN_LOD_REDUCTION = 0.1f;
+
+	struct TextureFormatName {
+		std::string_view name;
+		DataFormat linear;
+		DataFormat srgb;
+	};
+
+	static constexpr TextureFormatName TEXTURE_FORMATS[] = {
+		{"bc1", DataFormat::BC1_RGB_UNORM_BLOCK, DataFormat::BC1_RGB_SRGB_BLOCK},
+		{"bc3", DataFormat::BC3_UNORM_BLOCK, DataFormat::BC3_SRGB_BLOCK},
+		{"bc4", DataFormat::BC4_UNORM_BLOCK, DataFormat::BC4_UNORM_BLOCK},
+		{"bc5", DataFormat::BC5_UNORM_BLOCK, DataFormat::BC5_UNORM_BLOCK},
+		{"bc7", DataFormat::BC7_UNORM_BLOCK, DataFormat::BC7_SRGB_BLOCK},
+		{"rgba8", DataFormat::R8G8B8A8_UNORM, DataFormat::R8G8B8A8_SRGB},
+	};
+
+	// Indexed by CompressionQuality
+	static constexpr std::string_view QUALITY_NAMES[] = {"fast", "normal", "high"};
+
+	static constexpr std::string_view IMAGE_EXTENSIONS[] = {".tga", ".ppm", ".pgm"};
+
+	struct Options {
+		std::filesystem::path input;
+		std::filesystem::path output;
+		u32 lod_count = 4;
+		f32 lod_ratio = 0.5f;
+		f32 lod_error = 0.02f;
+		bool meshlets = true;
+		bool full_precision = false;
+
+		std::string_view texture_format_name = "bc7";
+		DataFormat texture_format = DataFormat::UNDEFINED;
+		CompressionQuality quality = CompressionQuality::NORMAL;
+		bool srgb = true;
+		bool mips = true;
+		u32 thread_count = CpuInfo::get().logical_cores;
+	};
+
+	bool is_image_path(const std::filesystem::path& p_path) {
+		std::string extension = p_path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](const char c) {
+			return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+		});
+		return std::find(std::begin(IMAGE_EXTENSIONS), std::end(IMAGE_EXTENSIONS), extension)
+			!= std::end(IMAGE_EXTENSIONS);
+	}
+
+	void print_usage(const char* p_program) {
+		std::fprintf(
+			stderr,
+			"Usage: %s INPUT.obj -o OUTPUT [--lods N] [--lod-ratio R] [--lod-error E] [--no-meshlets]\n"
+			"       [--full-precision]\n"
+			"       %s INPUT.tga|ppm|pgm -o OUTPUT [--format F] [--quality Q] [--linear] [--no-mips] [--threads N]\n"
+			"  -o PATH          Cooked mesh or texture to write\n"
+			"  --lods N         Maximum number of LODs including the full mesh (default 4)\n"
+			"  --lod-ratio R    Triangle ratio between consecutive LODs (default 0.5)\n"
+			"  --lod-error E    Maximum error relative to the mesh extent (default 0.02)\n"
+			"  --no-meshlets    Skip meshlet generation\n"
+			"  --full-precision Keep 32-bit float normals and UVs instead of octahedral normals and half UVs\n"
+			"  --format F       Texture format: bc1, bc3, bc4, bc5, bc7 or rgba8 (default bc7)\n"
+			"  --quality Q      Block encoder effort: fast, normal or high (default normal)\n"
+			"  --linear         Colors are not sRGB encoded, bc4 and bc5 are always linear\n"
+			"  --no-mips        Only cook the full size level\n"
+			"  --threads N      Encoder threads (default one per logical core)\n",
+			p_program,
+			p_program
+		);
+	}
+
+	bool parse_args(const int p_argc, char** p_argv, Options& p_options) {
+		for (int i = 1; i < p_argc; i++) {
+			const std::string_view arg = p_argv[i];
+			if (arg == "--help" || arg == "-h") {
+				return false;
+			}
+			if (arg == "--no-meshlets") {
+				p_options.meshlets = false;
+				continue;
+			}
+			if (arg == "--full-precision") {
+				p_options.full_precision = true;
+				continue;
+			}
+			if (arg == "--linear") {
+				p_options.srgb = false;
+				continue;
+			}
+			if (arg == "--no-mips") {
+				p_options.mips = false;
+				continue;
+			}
+			if (!arg.starts_with("-")) {
+				p_options.input = arg;
+				continue;
+			}
+			if (i + 1 >= p_argc) {
+				std::fprintf(stderr, "Missing value for %s\n", p_argv[i]);
+				return false;
+			}
+			const char* value = p_argv[++i];
+			if (arg == "-o") {
+				p_options.output = value;
+			} else if (arg == "--lods") {
+				p_options.lod_count = static_cast<u32>(std::strtoul(value, nullptr, 10));
+			} else if (arg == "--lod-ratio") {
+				p_options.lod_ratio = std::strtof(value, nullptr);
+			} else if (arg == "--lod-error") {
+				p_options.lod_error = std::strtof(value, nullptr);
+			} else if (arg == "--format") {
+				p_options.texture_format_name = value;
+			} else if (arg == "--quality") {
+				const auto it = std::find(std::begin(QUALITY_NAMES), std::end(QUALITY_NAMES), value);
+				if (it == std::end(QUALITY_NAMES)) {
+					std::fprintf(stderr, "Unknown quality %s\n", value);
+					return false;
+				}
+				p_options.quality = static_cast<CompressionQuality>(it - std::begin(QUALITY_NAMES));
+			} else if (arg == "--threads") {
+				p_options.thread_count = static_cast<u32>(std::strtoul(value, nullptr, 10));
+			} else {
+				std::fprintf(stderr, "Unknown option %s\n", p_argv[i - 1]);
+				return false;
+			}
+		}
+		if (p_options.input.empty() || p_options.output.empty()) {
+			std::fprintf(stderr, "An input and an output path are required\n");
+			return false;
+		}
+		if (p_options.lod_count == 0 || p_options.lod_ratio <= 0.0f || p_options.lod_ratio >= 1.0f) {
+			std::fprintf(stderr, "--lods must be at least 1 and --lod-ratio between 0 and 1\n");
+			return false;
+		}
+		if (p_options.thread_count == 0) {
+			std::fprintf(stderr, "--threads must be greater than zero\n");
+			return false;
+		}
+		for (const TextureFormatName& format : TEXTURE_FORMATS) {
+			if (format.name == p_options.texture_format_name) {
+				p_options.texture_format = p_options.srgb ? format.srgb : format.linear;
+			}
+		}
+		if (p_options.texture_format == DataFormat::UNDEFINED) {
+			std::fprintf(stderr, "Unknown texture format %s\n", p_options.texture_format_name.data());
+			return false;
+		}
+		return true;
+	}
+
+	void optimize_lod(std::vector<u32>& p_indices, const std::vector<Vertex>& p_vertices) {
+		std::vector<u32> clusters;
+		optimize_vertex_cache(p_indices, p_vertices.size(), &clusters);
+		optimize_overdraw(p_indices, clusters, p_vertices);
+	}
+
+	void append_meshlets(MeshletData& p_out, const MeshletData& p_meshlets) {
+		const u32 vertex_offset = static_cast<u32>(p_out.vertices.size());
+		const u32 triangle_offset = static_cast<u32>(p_out.triangles.size());
+		for (Meshlet meshlet : p_meshlets.meshlets) {
+			meshlet.vertex_offset += vertex_offset;
+			meshlet.triangle_offset += triangle_offset;
+			p_out.meshlets.push_back(meshlet);
+		}
+		p_out.bounds.insert(p_out.bounds.end(), p_meshlets.bounds.begin(), p_meshlets.bounds.end());
+		p_out.vertices.insert(p_out.vertices.end(), p_meshlets.vertices.begin(), p_meshlets.vertices.end());
+		p_out.triangles.insert(p_out.triangles.end(), p_meshlets.triangles.begin(), p_meshlets.triangles.end());
+	}
+
+	/// Interleaves the attributes the source provided, at the locations the engine shaders expect
+	void pack_vertices(MeshAsset& p_asset, const Mesh& p_mesh, const bool p_compact) {
+		u32 stride = 0;
+		const auto add_attribute = [&]<typename T>() {
+			p_asset.attributes.push_back({
+				.binding = 0,
+				.location = static_cast<u32>(p_asset.attributes.size()),
+				.offset = stride,
+				.format = get_vertex_format<T>(),
+			});
+			stride += sizeof(T);
+		};
+
+		// Positions stay full precision, compact normals and UVs take 8 bytes instead of 20
+		add_attribute.operator()<Vec3<f32>>();
+		if (p_mesh.has_normals) {
+			p_compact ? add_attribute.operator()<OctNormal>() : add_attribute.operator()<Vec3<f32>>();
+		}
+		if (p_mesh.has_uvs) {
+			p_compact ? add_attribute.operator()<Half2>() : add_attribute.operator()<Vec2<f32>>();
+		}
+		p_asset.bindings.push_back({.binding = 0, .stride = stride, .rate = InputRate::VERTEX});
+
+		p_asset.vertex_count = static_cast<u32>(p_mesh.vertices.size());
+		p_asset.vertices.resize(usize(stride) * p_mesh.vertices.size());
+
+		u8* out = p_asset.vertices.data();
+		const auto write = [&](const auto& p_value) {
+			std::memcpy(out, &p_value, sizeof(p_value));
+			out += sizeof(p_value);
+		};
+		for (const Vertex& vertex : p_mesh.vertices) {
+			write(vertex.position);
+			if (p_mesh.has_normals) {
+				p_compact ? write(pack_normal(Vec3A(vertex.normal))) : write(vertex.normal);
+			}
+			if (p_mesh.has_uvs) {
+				p_compact ? write(to_half(vertex.uv)) : write(vertex.uv);
+			}
+		}
+	}
+
+	MeshAsset cook_mesh(const Options& p_options) {
+		Mesh mesh = load_obj(p_options.input);
+		std::printf(
+			"Loaded %s: %zu vertices, %zu triangles\n",
+			p_options.input.string().c_str(),
+			mesh.vertices.size(),
+			mesh.indices.size() / 3
+		);
+
+		const f32 source_acmr = get_acmr(mesh.indices, mesh.vertices.size());
+
+		// Every LOD simplifies the full mesh so errors do not compound
+		std::vector<std::vector<u32>> lods;
+		std::vector<f32> errors;
+		lods.push_back(mesh.indices);
+		errors.push_back(0.0f);
+		optimize_lod(lods[0], mesh.vertices);
+
+		for (u32 i = 1; i < p_options.lod_count; i++) {
+			const usize target = static_cast<usize>(lods.back().size() / 3 * p_options.lod_ratio) * 3;
+			f32 error = 0.0f;
+			std::vector<u32> lod = simplify(mesh.indices, mesh.vertices, target, p_options.lod_error, error);
+			if (lod.empty() || lod.size() > lods.back().size() * (1.0f - MIN_LOD_REDUCTION)) {
+				break;
+			}
+			optimize_lod(lod, mesh.vertices);
+			lods.push_back(std::move(lod));
+			errors.push_back(error);
+		}
+
+		MeshAsset asset;
+		for (usize i = 0; i < lods.size(); i++) {
+			MeshLod lod;
+			lod.first_index = static_cast<u32>(asset.indices.size());
+			lod.index_count = static_cast<u32>(lods[i].size());
+			lod.error = errors[i];
+			asset.indices.insert(asset.indices.end(), lods[i].begin(), lods[i].end());
+			asset.lods.push_back(lod);
+		}
+
+		// LOD zero comes first, so the vertex order follows the full detail mesh
+		optimize_vertex_fetch(asset.indices, mesh.vertices);
+
+		std::vector<Vec3<f32>> positions(mesh.vertices.size());
+		for (usize v = 0; v < mesh.vertices.size(); v++) {
+			positions[v] = mesh.vertices[v].position;
+		}
+
+		for (MeshLod& lod : asset.lods) {
+			const std::span<const u32> indices(asset.indices.data() + lod.first_index, lod.index_count);
+			std::printf(
+				"LOD %zu: %u triangles, ACMR %.3f (source %.3f), error %.4f\n",
+				static_cast<usize>(&lod - asset.lods.data()),
+				lod.index_count / 3,
+				get_acmr(indices, mesh.vertices.size()),
+				source_acmr,
+				lod.error
+			);
+
+			if (p_options.meshlets) {
+				const MeshletData meshlets = MeshletData::build(indices, positions);
+				lod.first_meshlet = static_cast<u32>(asset.meshlets.meshlets.size());
+				lod.meshlet_count = static_cast<u32>(meshlets.meshlets.size());
+				append_meshlets(asset.meshlets, meshlets);
+			}
+		}
+
+		pack_vertices(asset, mesh, !p_options.full_precision);
+		return asset;
+	}
+
+	TextureAsset cook_texture(const Options& p_options) {
+		const Image image = load_image(p_options.input);
+		const bool alpha = image.has_alpha();
+		std::printf(
+			"Loaded %s: %ux%u, %s\n",
+			p_options.input.string().c_str(),
+			image.width,
+			image.height,
+			alpha ? "with alpha" : "opaque"
+		);
+		if (alpha && (p_options.texture_format_name == "bc1" || p_options.texture_format_name == "bc4")) {
+			std::printf("Warning: %s drops the alpha channel\n", p_options.texture_format_name.data());
+		}
+
+		const bool srgb = get_format_info(p_options.texture_format).is_srgb();
+		const std::vector<Image> mips = p_options.mips ? generate_mips(image, srgb) : std::vector<Image> {image};
+
+		TextureAsset asset;
+		asset.format = p_options.texture_format;
+		asset.width = image.width;
+		asset.height = image.height;
+
+		JobSystem jobs(p_options.thread_count);
+		const auto start = std::chrono::steady_clock::now();
+		for (const Image& mip : mips) {
+			const std::vector<u8> data = compress_image(mip, asset.format, p_options.quality, jobs);
+			asset.mips.push_back({
+				.width = mip.width,
+				.height = mip.height,
+				.offset = asset.data.size(),
+				.size = data.size(),
+			});
+			asset.data.insert(asset.data.end(), data.begin(), data.end());
+		}
+		const std::chrono::duration<f64, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::printf(
+			"Encoded %zu mips as %s (%s) on %u threads in %.1f ms\n",
+			asset.mips.size(),
+			p_options.texture_format_name.data(),
+			QUALITY_NAMES[static_cast<u32>(p_options.quality)].data(),
+			p_options.thread_count,
+			elapsed.count()
+		);
+		return asset;
+	}
+} // namespace
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!parse_args(argc, argv, options)) {
+		print_usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Debug::get_logger()->set_level(spdlog::level::warn);
+
+	try {
+		if (is_image_path(options.input)) {
+			const TextureAsset asset = cook_texture(options);
+			asset.save(options.output);
+			std::printf(
+				"Wrote %s: %ux%u, %zu mips, %zu bytes\n",
+				options.output.string().c_str(),
+				asset.width,
+				asset.height,
+				asset.mips.size(),
+				asset.data.size()
+			);
+			return EXIT_SUCCESS;
+		}
+
+		const MeshAsset asset = cook_mesh(options);
+		asset.save(options.output);
+		std::printf(
+			"Wrote %s: %u vertices of %u bytes, %zu LODs, %zu meshlets\n",
+			options.output.string().c_str(),
+			asset.vertex_count,
+			asset.bindings[0].stride,
+			asset.lods.size(),
+			asset.meshlets.meshlets.size()
+		);
+		return EXIT_SUCCESS;
+	} catch (const std::exception& e) {
+		std::fprintf(stderr, "Error: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/math/vec2.h>
+#include <nova/math/vec3.h>
+#include <nova/types.h>
+
+#include <vector>
+
+namespace Nova::Cooker {
+	struct Vertex {
+		Vec3<f32> position;
+		Vec3<f32> normal;
+		Vec2<f32> uv;
+	};
+
+	/// Indexed triangle list as loaded from a source file
+	struct Mesh {
+		std::vector<Vertex> vertices;
+		std::vector<u32> indices;
+		bool has_normals = false;
+		bool has_uvs = false;
+	};
+} // namespace Nova::Cooker
@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mesh_optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace Nova;
+using namespace Nova::Cooker;
+
+namespace {
+	static constexpr u32 INVALID_INDEX = std::numeric_limits<u32>::max();
+
+	/// Smallest cluster optimize_overdraw() will split off, smaller ones cost more cache than they save fill
+	static constexpr usize MIN_CLUSTER_TRIANGLES = 32;
+
+	struct Cluster {
+		u32 begin;
+		u32 end;
+		f32 sort_key;
+	};
+
+	/// Counts cache misses of one triangle against a FIFO cache simulated with timestamps
+	u32 simulate_triangle(
+		const u32* p_triangle,
+		std::vector<u32>& p_timestamps,
+		u32& p_time,
+		const u32 p_cache_size
+	) {
+		u32 misses = 0;
+		for (u32 k = 0; k < 3; k++) {
+			const u32 vertex = p_triangle[k];
+			if (p_time - p_timestamps[vertex] > p_cache_size) {
+				p_timestamps[vertex] = p_time++;
+				misses++;
+			}
+		}
+		return misses;
+	}
+} // namespace
+
+void Cooker::optimize_vertex_cache(std::vector<u32>& p_indices, const usize p_vertex_count, std::vector<u32>* p_clusters) {
+	const usize triangle_count = p_indices.size() / 3;
+
+	// Triangles around each vertex
+	std::vector<u32> live(p_vertex_count, 0);
+	for (const u32 index : p_indices) {
+		live[index]++;
+	}
+	std::vector<u32> offsets(p_vertex_count + 1, 0);
+	for (usize v = 0; v < p_vertex_count; v++) {
+		offsets[v + 1] = offsets[v] + live[v];
+	}
+	std::vector<u32> adjacency(p_indices.size());
+	std::vector<u32> fill(offsets.begin(), offsets.end() - 1);
+	for (usize i = 0; i < p_indices.size(); i++) {
+		adjacency[fill[p_indices[i]]++] = static_cast<u32>(i / 3);
+	}
+
+	std::vector<u32> timestamps(p_vertex_count, 0);
+	std::vector<bool> emitted(triangle_count, false);
+	std::vector<u32> dead_end;
+	std::vector<u32> candidates;
+	std::vector<u32> output;
+	output.reserve(p_indices.size());
+
+	u32 time = VERTEX_CACHE_SIZE + 1;
+	u32 cursor = 0;
+	u32 fanning = p_indices.empty() ? INVALID_INDEX : p_indices[0];
+
+	if (p_clusters) {
+		p_clusters->assign(1, 0);
+	}
+
+	while (fanning != INVALID_INDEX) {
+		candidates.clear();
+		for (u32 i = offsets[fanning]; i < offsets[fanning + 1]; i++) {
+			const u32 triangle = adjacency[i];
+			if (emitted[triangle]) {
+				continue;
+			}
+			emitted[triangle] = true;
+
+			for (u32 k = 0; k < 3; k++) {
+				const u32 vertex = p_indices[triangle * 3 + k];
+				output.push_back(vertex);
+				dead_end.push_back(vertex);
+				candidates.push_back(vertex);
+				live[vertex]--;
+				if (time - timestamps[vertex] > VERTEX_CACHE_SIZE) {
+					timestamps[vertex] = time++;
+				}
+			}
+		}
+
+		// Prefer the candidate that will still be cached once its remaining triangles are emitted
+		u32 next = INVALID_INDEX;
+		i64 best_priority = -1;
+		for (const u32 vertex : candidates) {
+			if (live[vertex] == 0) {
+				continue;
+			}
+			i64 priority = 0;
+			if (time - timestamps[vertex] + 2 * live[vertex] <= VERTEX_CACHE_SIZE) {
+				priority = time - timestamps[vertex];
+			}
+			if (priority > best_priority) {
+				best_priority = priority;
+				next = vertex;
+			}
+		}
+
+		if (next == INVALID_INDEX) {
+			while (!dead_end.empty() && next == INVALID_INDEX) {
+				if (live[dead_end.back()] > 0) {
+					next = dead_end.back();
+				}
+				dead_end.pop_back();
+			}
+		}
+
+		// Nothing recent is left, restarting elsewhere begins with a cold cache
+		if (next == INVALID_INDEX) {
+			while (cursor < p_vertex_count && live[cursor] == 0) {
+				cursor++;
+			}
+			if (cursor < p_vertex_count) {
+				next = cursor;
+				if (p_clusters) {
+					p_clusters->push_back(static_cast<u32>(output.size()));
+				}
+			}
+		}
+
+		fanning = next;
+	}
+
+	p_indices = std::move(output);
+}
+
+void Cooker::optimize_overdraw(
+	std::vector<u32>& p_indices,
+	const std::span<const u32> p_clusters,
+	const std::span<const Vertex> p_vertices,
+	const f32 p_threshold
+) {
+	if (p_indices.empty()) {
+		return;
+	}
+
+	std::vector<u32> timestamps(p_vertices.size(), 0);
+	u32 time = VERTEX_CACHE_SIZE + 1;
+
+	// Split hard clusters wherever the cache has done about as well as it will over the whole cluster
+	std::vector<Cluster> clusters;
+	for (usize c = 0; c < p_clusters.size(); c++) {
+		const u32 begin = p_clusters[c];
+		const u32 end = c + 1 < p_clusters.size() ? p_clusters[c + 1] : static_cast<u32>(p_indices.size());
+		if (begin == end) {
+			continue;
+		}
+
+		// Moving time past the cache size empties the cache, so the timestamps never need clearing
+		time += VERTEX_CACHE_SIZE + 1;
+		u32 cluster_misses = 0;
+		for (u32 i = begin; i < end; i += 3) {
+			cluster_misses += simulate_triangle(&p_indices[i], timestamps, time, VERTEX_CACHE_SIZE);
+		}
+		const f32 cluster_acmr = static_cast<f32>(cluster_misses) / static_cast<f32>((end - begin) / 3);
+
+		time += VERTEX_CACHE_SIZE + 1;
+		u32 start = begin;
+		u32 misses = 0;
+		for (u32 i = begin; i < end; i += 3) {
+			misses += simulate_triangle(&p_indices[i], timestamps, time, VERTEX_CACHE_SIZE);
+
+			const u32 triangles = (i + 3 - start) / 3;
+			if (triangles >= MIN_CLUSTER_TRIANGLES && i + 3 < end
+				&& static_cast<f32>(misses) / triangles <= cluster_acmr * p_threshold) {
+				clusters.push_back({start, i + 3, 0.0f});
+				start = i + 3;
+				misses = 0;
+				time += VERTEX_CACHE_SIZE + 1;
+			}
+		}
+		clusters.push_back({start, end, 0.0f});
+	}
+
+	// Area weighted centroids and normals
+	const auto get_triangle = [&](const u32 p_offset, Vec3<f32>& p_centroid, Vec3<f32>& p_normal) {
+		const Vec3<f32>& a = p_vertices[p_indices[p_offset + 0]].position;
+		const Vec3<f32>& b = p_vertices[p_indices[p_offset + 1]].position;
+		const Vec3<f32>& c = p_vertices[p_indices[p_offset + 2]].position;
+		const Vec3<f32> e1 = {b.x - a.x, b.y - a.y, b.z - a.z};
+		const Vec3<f32> e2 = {c.x - a.x, c.y - a.y, c.z - a.z};
+		p_normal = {e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x};
+		p_centroid = {(a.x + b.x + c.x) / 3.0f, (a.y + b.y + c.y) / 3.0f, (a.z + b.z + c.z) / 3.0f};
+		return std::sqrt(p_normal.x * p_normal.x + p_normal.y * p_normal.y + p_normal.z * p_normal.z);
+	};
+
+	Vec3<f32> mesh_centroid = {0.0f, 0.0f, 0.0f};
+	f32 mesh_area = 0.0f;
+	for (u32 i = 0; i < p_indices.size(); i += 3) {
+		Vec3<f32> centroid, normal;
+		const f32 area = get_triangle(i, centroid, normal);
+		mesh_centroid = {
+			mesh_centroid.x + centroid.x * area,
+			mesh_centroid.y + centroid.y * area,
+			mesh_centroid.z + centroid.z * area,
+		};
+		mesh_area += area;
+	}
+	if (mesh_area > 0.0f) {
+		mesh_centroid = {mesh_centroid.x / mesh_area, mesh_centroid.y / mesh_area, mesh_centroid.z / mesh_area};
+	}
+
+	for (Cluster& cluster : clusters) {
+		Vec3<f32> centroid_sum = {0.0f, 0.0f, 0.0f};
+		Vec3<f32> normal_sum = {0.0f, 0.0f, 0.0f};
+		f32 area_sum = 0.0f;
+		for (u32 i = cluster.begin; i < cluster.end; i += 3) {
+			Vec3<f32> centroid, normal;
+			const f32 area = get_triangle(i, centroid, normal);
+			centroid_sum = {
+				centroid_sum.x + centroid.x * area,
+				centroid_sum.y + centroid.y * area,
+				centroid_sum.z + centroid.z * area,
+			};
+			normal_sum = {normal_sum.x + normal.x, normal_sum.y + normal.y, normal_sum.z + normal.z};
+			area_sum += area;
+		}
+		if (area_sum == 0.0f) {
+			continue;
+		}
+
+		const f32 length = std::sqrt(
+			normal_sum.x * normal_sum.x + normal_sum.y * normal_sum.y + normal_sum.z * normal_sum.z
+		);
+		const Vec3<f32> offset = {
+			centroid_sum.x / area_sum - mesh_centroid.x,
+			centroid_sum.y / area_sum - mesh_centroid.y,
+			centroid_sum.z / area_sum - mesh_centroid.z,
+		};
+		cluster.sort_key = length > 0.0f
+			? (offset.x * normal_sum.x + offset.y * normal_sum.y + offset.z * normal_sum.z) / length
+			: 0.0f;
+	}
+
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& p_a, const Cluster& p_b) {
+		return p_a.sort_key > p_b.sort_key;
+	});
+
+	std::vector<u32> output;
+	output.reserve(p_indices.size());
+	for (const Cluster& cluster : clusters) {
+		output.insert(output.end(), p_indices.begin() + cluster.begin, p_indices.begin() + cluster.end);
+	}
+	p_indices = std::move(output);
+}
+
+void Cooker::optimize_vertex_fetch(std::vector<u32>& p_indices, std::vector<Vertex>& p_vertices) {
+	std::vector<u32> remap(p_vertices.size(), INVALID_INDEX);
+	std::vector<Vertex> output;
+	output.reserve(p_vertices.size());
+
+	for (u32& index : p_indices) {
+		if (remap[index] == INVALID_INDEX) {
+			remap[index] = static_cast<u32>(output.size());
+			output.push_back(p_vertices[index]);
+		}
+		index = remap[index];
+	}
+
+	p_vertices = std::move(output);
+}
+
+f32 Cooker::get_acmr(const std::span<const u32> p_indices, const usize p_vertex_count, const u32 p_cache_size) {
+	if (p_indices.empty()) {
+		return 0.0f;
+	}
+
+	std::vector<u32> timestamps(p_vertex_count, 0);
+	u32 time = p_cache_size + 1;
+	u32 misses = 0;
+	for (usize i = 0; i + 2 < p_indices.size(); i += 3) {
+		misses += simulate_triangle(&p_indices[i], timestamps, time, p_cache_size);
+	}
+	return static_cast<f32>(misses) / static_cast<f32>(p_indices.size() / 3);
+}
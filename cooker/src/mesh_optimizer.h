@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "mesh.h"
+
+#include <span>
+#include <vector>
+
+namespace Nova::Cooker {
+	/// FIFO size the optimizer targets, close to the effective cache of current GPUs
+	static constexpr u32 VERTEX_CACHE_SIZE = 16;
+
+	/**
+	 * @brief Reorders triangles for the post-transform vertex cache using Tipsify.
+	 *
+	 * When clusters is given it receives the index offset of every point where the walk had to restart with a cold
+	 * cache, which optimize_overdraw() may reorder freely.
+	 */
+	void optimize_vertex_cache(std::vector<u32>& indices, usize vertex_count, std::vector<u32>* clusters = nullptr);
+
+	/**
+	 * @brief Sorts clusters so outward facing ones are drawn first, letting early depth testing reject more.
+	 *
+	 * Clusters are split further where that costs at most threshold times the cluster's cache miss ratio.
+	 */
+	void optimize_overdraw(
+		std::vector<u32>& indices,
+		std::span<const u32> clusters,
+		std::span<const Vertex> vertices,
+		f32 threshold = 1.05f
+	);
+
+	/// Renumbers vertices in order of first use and drops unused ones
+	void optimize_vertex_fetch(std::vector<u32>& indices, std::vector<Vertex>& vertices);
+
+	/// Average transformed vertices per triangle for a FIFO cache, lower is better
+	f32 get_acmr(std::span<const u32> indices, usize vertex_count, u32 cache_size = VERTEX_CACHE_SIZE);
+} // namespace Nova::Cooker
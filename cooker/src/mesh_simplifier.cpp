@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mesh_simplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+using namespace Nova;
+using namespace Nova::Cooker;
+
+namespace {
+	/// Upper bound on collapse passes, each pass touches every vertex at most once
+	static constexpr u32 MAX_PASSES = 64;
+
+	struct Quadric {
+		f64 a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+		f64 b0 = 0, b1 = 0, b2 = 0;
+		f64 c = 0;
+		f64 weight = 0;
+
+		void add_plane(const f64 p_x, const f64 p_y, const f64 p_z, const f64 p_d, const f64 p_weight) {
+			a00 += p_weight * p_x * p_x;
+			a01 += p_weight * p_x * p_y;
+			a02 += p_weight * p_x * p_z;
+			a11 += p_weight * p_y * p_y;
+			a12 += p_weight * p_y * p_z;
+			a22 += p_weight * p_z * p_z;
+			b0 += p_weight * p_x * p_d;
+			b1 += p_weight * p_y * p_d;
+			b2 += p_weight * p_z * p_d;
+			c += p_weight * p_d * p_d;
+			weight += p_weight;
+		}
+
+		Quadric operator+(const Quadric& p_other) const {
+			return {
+				a00 + p_other.a00,
+				a01 + p_other.a01,
+				a02 + p_other.a02,
+				a11 + p_other.a11,
+				a12 + p_other.a12,
+				a22 + p_other.a22,
+				b0 + p_other.b0,
+				b1 + p_other.b1,
+				b2 + p_other.b2,
+				c + p_other.c,
+				weight + p_other.weight,
+			};
+		}
+
+		/// Area weighted mean squared distance of p to the accumulated planes
+		f64 evaluate(const Vec3<f32>& p_point) const {
+			const f64 x = p_point.x, y = p_point.y, z = p_point.z;
+			const f64 error = a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z + a11 * y * y + 2 * a12 * y * z
+				+ a22 * z * z + 2 * (b0 * x + b1 * y + b2 * z) + c;
+			return weight > 0 ? std::max(error, 0.0) / weight : 0.0;
+		}
+	};
+
+	struct Collapse {
+		f64 cost;
+		u32 from;
+		u32 to;
+	};
+
+	Vec3<f64> get_normal(const Vec3<f32>& p_a, const Vec3<f32>& p_b, const Vec3<f32>& p_c) {
+		const f64 e1x = p_b.x - p_a.x, e1y = p_b.y - p_a.y, e1z = p_b.z - p_a.z;
+		const f64 e2x = p_c.x - p_a.x, e2y = p_c.y - p_a.y, e2z = p_c.z - p_a.z;
+		return {e1y * e2z - e1z * e2y, e1z * e2x - e1x * e2z, e1x * e2y - e1y * e2x};
+	}
+
+	u64 get_edge_key(const u32 p_a, const u32 p_b) {
+		return (u64(std::min(p_a, p_b)) << 32) | std::max(p_a, p_b);
+	}
+} // namespace
+
+std::vector<u32> Cooker::simplify(
+	const std::span<const u32> p_indices,
+	const std::span<const Vertex> p_vertices,
+	const usize p_target_index_count,
+	const f32 p_max_error,
+	f32& p_result_error
+) {
+	const usize vertex_count = p_vertices.size();
+	std::vector<u32> indices(p_indices.begin(), p_indices.end());
+	p_result_error = 0.0f;
+
+	// Work in units of the mesh extent so max_error is scale independent
+	Vec3<f32> min = p_vertices.empty() ? Vec3<f32> {} : p_vertices[0].position;
+	Vec3<f32> max = min;
+	for (const Vertex& vertex : p_vertices) {
+		min = {std::min(min.x, vertex.position.x), std::min(min.y, vertex.position.y), std::min(min.z, vertex.position.z)};
+		max = {std::max(max.x, vertex.position.x), std::max(max.y, vertex.position.y), std::max(max.z, vertex.position.z)};
+	}
+	const f64 extent = std::max({max.x - min.x, max.y - min.y, max.z - min.z, 1e-12f});
+	const f64 max_cost = (p_max_error * extent) * (p_max_error * extent);
+
+	// Edges used by a single triangle lie on a border, or on a seam where vertices were split by attributes
+	std::unordered_map<u64, u32> edge_counts;
+	for (usize i = 0; i < indices.size(); i += 3) {
+		for (u32 k = 0; k < 3; k++) {
+			edge_counts[get_edge_key(indices[i + k], indices[i + (k + 1) % 3])]++;
+		}
+	}
+	std::vector<bool> locked(vertex_count, false);
+	for (const auto& [key, count] : edge_counts) {
+		if (count == 1) {
+			locked[key >> 32] = true;
+			locked[key & 0xffffffff] = true;
+		}
+	}
+
+	std::vector<Quadric> quadrics(vertex_count);
+	for (usize i = 0; i < indices.size(); i += 3) {
+		const Vec3<f32>& a = p_vertices[indices[i + 0]].position;
+		const Vec3<f64> normal = get_normal(a, p_vertices[indices[i + 1]].position, p_vertices[indices[i + 2]].position);
+		const f64 length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+		if (length == 0.0) {
+			continue;
+		}
+		const f64 nx = normal.x / length, ny = normal.y / length, nz = normal.z / length;
+		const f64 d = -(nx * a.x + ny * a.y + nz * a.z);
+		for (u32 k = 0; k < 3; k++) {
+			quadrics[indices[i + k]].add_plane(nx, ny, nz, d, length * 0.5);
+		}
+	}
+
+	std::vector<u32> offsets(vertex_count + 1);
+	std::vector<u32> adjacency;
+	std::vector<u64> edges;
+	std::vector<Collapse> collapses;
+	std::vector<u32> remap(vertex_count);
+	std::vector<bool> touched(vertex_count);
+
+	for (u32 pass = 0; pass < MAX_PASSES && indices.size() > p_target_index_count; pass++) {
+		// Triangles around each vertex
+		std::fill(offsets.begin(), offsets.end(), 0);
+		for (const u32 index : indices) {
+			offsets[index + 1]++;
+		}
+		for (usize v = 0; v < vertex_count; v++) {
+			offsets[v + 1] += offsets[v];
+		}
+		adjacency.resize(indices.size());
+		std::vector<u32> fill(offsets.begin(), offsets.end() - 1);
+		for (usize i = 0; i < indices.size(); i++) {
+			adjacency[fill[indices[i]]++] = static_cast<u32>(i / 3);
+		}
+
+		edges.clear();
+		for (usize i = 0; i < indices.size(); i += 3) {
+			for (u32 k = 0; k < 3; k++) {
+				edges.push_back(get_edge_key(indices[i + k], indices[i + (k + 1) % 3]));
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+		edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+		collapses.clear();
+		for (const u64 edge : edges) {
+			const u32 a = static_cast<u32>(edge >> 32);
+			const u32 b = static_cast<u32>(edge & 0xffffffff);
+			const Quadric quadric = quadrics[a] + quadrics[b];
+			if (!locked[a]) {
+				collapses.push_back({quadric.evaluate(p_vertices[b].position), a, b});
+			}
+			if (!locked[b]) {
+				const f64 cost = quadric.evaluate(p_vertices[a].position);
+				if (locked[a] || cost < collapses.back().cost) {
+					if (!locked[a]) {
+						collapses.pop_back();
+					}
+					collapses.push_back({cost, b, a});
+				}
+			}
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& p_a, const Collapse& p_b) {
+			return p_a.cost < p_b.cost;
+		});
+
+		for (u32 v = 0; v < vertex_count; v++) {
+			remap[v] = v;
+		}
+		std::fill(touched.begin(), touched.end(), false);
+
+		const usize target_triangles = p_target_index_count / 3;
+		usize triangles = indices.size() / 3;
+		bool changed = false;
+
+		for (const Collapse& collapse : collapses) {
+			if (collapse.cost > max_cost || triangles <= target_triangles) {
+				break;
+			}
+			if (touched[collapse.from] || touched[collapse.to]) {
+				continue;
+			}
+
+			// Reject collapses that would flip a surviving triangle
+			bool flips = false;
+			usize removed = 0;
+			for (u32 i = offsets[collapse.from]; i < offsets[collapse.from + 1] && !flips; i++) {
+				const u32* triangle = &indices[adjacency[i] * 3];
+				if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to) {
+					removed++;
+					continue;
+				}
+
+				Vec3<f32> before[3], after[3];
+				for (u32 k = 0; k < 3; k++) {
+					before[k] = p_vertices[triangle[k]].position;
+					after[k] = triangle[k] == collapse.from ? p_vertices[collapse.to].position : before[k];
+				}
+				const Vec3<f64> n0 = get_normal(before[0], before[1], before[2]);
+				const Vec3<f64> n1 = get_normal(after[0], after[1], after[2]);
+				flips = n0.x * n1.x + n0.y * n1.y + n0.z * n1.z <= 0.0;
+			}
+			if (flips) {
+				continue;
+			}
+
+			remap[collapse.from] = collapse.to;
+			quadrics[collapse.to] = quadrics[collapse.to] + quadrics[collapse.from];
+			p_result_error = std::max(p_result_error, static_cast<f32>(std::sqrt(collapse.cost) / extent));
+			triangles -= removed;
+			changed = true;
+
+			// Neighbours keep their triangles unchanged for the rest of the pass, so the flip test above stays valid
+			for (u32 i = offsets[collapse.from]; i < offsets[collapse.from + 1]; i++) {
+				const u32* triangle = &indices[adjacency[i] * 3];
+				touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = true;
+			}
+		}
+
+		if (!changed) {
+			break;
+		}
+
+		usize write = 0;
+		for (usize i = 0; i < indices.size(); i += 3) {
+			const u32 a = remap[indices[i + 0]];
+			const u32 b = remap[indices[i + 1]];
+			const u32 c = remap[indices[i + 2]];
+			if (a != b && b != c && a != c) {
+				indices[write++] = a;
+				indices[write++] = b;
+				indices[write++] = c;
+			}
+		}
+		indices.resize(write);
+	}
+
+	return indices;
+}
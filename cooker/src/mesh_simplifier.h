@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "mesh.h"
+
+#include <span>
+#include <vector>
+
+namespace Nova::Cooker {
+	/**
+	 * @brief Reduces a triangle list towards target_index_count with quadric error edge collapses.
+	 *
+	 * Vertices only ever collapse onto existing vertices, so the result indexes the same vertex buffer. Vertices on
+	 * open borders and attribute seams are kept in place. Collapses stop once the error, relative to the mesh
+	 * extent, would exceed max_error. The error actually reached is written to result_error.
+	 */
+	std::vector<u32> simplify(
+		std::span<const u32> indices,
+		std::span<const Vertex> vertices,
+		usize target_index_count,
+		f32 max_error,
+		f32& result_error
+	);
+} // namespace Nova::Cooker
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "obj_loader.h"
+
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using namespace Nova;
+using namespace Nova::Cooker;
+
+namespace {
+	struct VertexKey {
+		i32 position;
+		i32 uv;
+		i32 normal;
+
+		bool operator==(const VertexKey&) const = default;
+	};
+
+	struct VertexKeyHash {
+		usize operator()(const VertexKey& p_key) const {
+			usize hash = static_cast<u32>(p_key.position);
+			hash = hash * 31 + static_cast<u32>(p_key.uv);
+			hash = hash * 31 + static_cast<u32>(p_key.normal);
+			return hash;
+		}
+	};
+
+	std::string_view next_token(std::string_view& p_line) {
+		const usize start = p_line.find_first_not_of(" \t\r");
+		if (start == std::string_view::npos) {
+			p_line = {};
+			return {};
+		}
+		const usize end = p_line.find_first_of(" \t\r", start);
+		const std::string_view token = p_line.substr(start, end - start);
+		p_line = end == std::string_view::npos ? std::string_view {} : p_line.substr(end);
+		return token;
+	}
+
+	f32 parse_float(std::string_view& p_line) {
+		const std::string_view token = next_token(p_line);
+		f32 value = 0.0f;
+		if (std::from_chars(token.data(), token.data() + token.size(), value).ec != std::errc()) {
+			throw std::runtime_error("Invalid number in OBJ file: " + std::string(token));
+		}
+		return value;
+	}
+
+	/// Resolves a one-based or negative relative OBJ index, zero when absent
+	i32 parse_index(const std::string_view p_token, const usize p_count) {
+		if (p_token.empty()) {
+			return -1;
+		}
+		i32 value = 0;
+		if (std::from_chars(p_token.data(), p_token.data() + p_token.size(), value).ec != std::errc() || value == 0) {
+			throw std::runtime_error("Invalid index in OBJ file: " + std::string(p_token));
+		}
+		const i64 index = value > 0 ? value - 1 : static_cast<i64>(p_count) + value;
+		if (index < 0 || index >= static_cast<i64>(p_count)) {
+			throw std::runtime_error("OBJ index out of range: " + std::string(p_token));
+		}
+		return static_cast<i32>(index);
+	}
+} // namespace
+
+Mesh Cooker::load_obj(const std::filesystem::path& p_path) {
+	std::ifstream file(p_path);
+	if (!file) {
+		throw std::runtime_error("Failed to open " + p_path.string());
+	}
+
+	std::vector<Vec3<f32>> positions;
+	std::vector<Vec3<f32>> normals;
+	std::vector<Vec2<f32>> uvs;
+	std::unordered_map<VertexKey, u32, VertexKeyHash> lookup;
+	std::vector<u32> polygon;
+	Mesh mesh;
+
+	std::string buffer;
+	while (std::getline(file, buffer)) {
+		std::string_view line = buffer;
+		const std::string_view type = next_token(line);
+
+		if (type == "v") {
+			const f32 x = parse_float(line);
+			const f32 y = parse_float(line);
+			const f32 z = parse_float(line);
+			positions.push_back({x, y, z});
+		} else if (type == "vn") {
+			const f32 x = parse_float(line);
+			const f32 y = parse_float(line);
+			const f32 z = parse_float(line);
+			normals.push_back({x, y, z});
+		} else if (type == "vt") {
+			const f32 u = parse_float(line);
+			const f32 v = parse_float(line);
+			uvs.push_back({u, v});
+		} else if (type == "f") {
+			polygon.clear();
+			for (std::string_view token = next_token(line); !token.empty(); token = next_token(line)) {
+				const usize first = token.find('/');
+				const usize second = first == std::string_view::npos ? first : token.find('/', first + 1);
+
+				VertexKey key;
+				key.position = parse_index(token.substr(0, first), positions.size());
+				key.uv = first == std::string_view::npos
+					? -1
+					: parse_index(token.substr(first + 1, second - first - 1), uvs.size());
+				key.normal = second == std::string_view::npos ? -1 : parse_index(token.substr(second + 1), normals.size());
+
+				auto [it, inserted] = lookup.try_emplace(key, static_cast<u32>(mesh.vertices.size()));
+				if (inserted) {
+					Vertex vertex {};
+					vertex.position = positions[key.position];
+					if (key.normal >= 0) {
+						vertex.normal = normals[key.normal];
+						mesh.has_normals = true;
+					}
+					if (key.uv >= 0) {
+						vertex.uv = uvs[key.uv];
+						mesh.has_uvs = true;
+					}
+					mesh.vertices.push_back(vertex);
+				}
+				polygon.push_back(it->second);
+			}
+
+			for (usize i = 2; i < polygon.size(); i++) {
+				mesh.indices.insert(mesh.indices.end(), {polygon[0], polygon[i - 1], polygon[i]});
+			}
+		}
+	}
+
+	if (mesh.indices.empty()) {
+		throw std::runtime_error("No triangles in " + p_path.string());
+	}
+	return mesh;
+}
@@ -0,0 +1,21 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "mesh.h"
+
+#include <filesystem>
+
+namespace Nova::Cooker {
+	/**
+	 * @brief Loads the geometry of a Wavefront OBJ file into a single mesh.
+	 *
+	 * Polygons are fan triangulated and identical position/uv/normal tuples share a vertex. Groups, objects and
+	 * materials are ignored.
+	 */
+	Mesh load_obj(const std::filesystem::path& path);
+} // namespace Nova::Cooker
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "texture_compressor.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Nova;
+using namespace Nova::Cooker;
+
+namespace {
+	using BlockEncoder = void (*)(const ColorBlock&, u8*, CompressionQuality);
+
+	void encode_bc4_red(const ColorBlock& p_block, u8* p_out, const CompressionQuality p_quality) {
+		encode_bc4(p_block, 0, p_out, p_quality);
+	}
+
+	BlockEncoder get_block_encoder(const DataFormat p_format) {
+		switch (p_format) {
+			case DataFormat::BC1_RGB_UNORM_BLOCK:
+			case DataFormat::BC1_RGB_SRGB_BLOCK:
+				return encode_bc1;
+			case DataFormat::BC3_UNORM_BLOCK:
+			case DataFormat::BC3_SRGB_BLOCK:
+				return encode_bc3;
+			case DataFormat::BC4_UNORM_BLOCK:
+				return encode_bc4_red;
+			case DataFormat::BC5_UNORM_BLOCK:
+				return encode_bc5;
+			case DataFormat::BC7_UNORM_BLOCK:
+			case DataFormat::BC7_SRGB_BLOCK:
+				return encode_bc7;
+			default:
+				return nullptr;
+		}
+	}
+
+	bool is_rgba8(const DataFormat p_format) {
+		return p_format == DataFormat::R8G8B8A8_UNORM || p_format == DataFormat::R8G8B8A8_SRGB;
+	}
+
+	ColorBlock fetch_block(const Image& p_image, const u32 p_block_x, const u32 p_block_y) {
+		ColorBlock block;
+		for (u32 y = 0; y < 4; y++) {
+			const u32 row = std::min(p_block_y * 4 + y, p_image.height - 1);
+			for (u32 x = 0; x < 4; x++) {
+				const u32 column = std::min(p_block_x * 4 + x, p_image.width - 1);
+				const u8* texel = &p_image.pixels[(usize(row) * p_image.width + column) * 4];
+				std::copy_n(texel, 4, block.texels[y * 4 + x]);
+			}
+		}
+		return block;
+	}
+} // namespace
+
+bool Cooker::is_texture_format_supported(const DataFormat p_format) {
+	return is_rgba8(p_format) || get_block_encoder(p_format) != nullptr;
+}
+
+std::vector<u8> Cooker::compress_image(
+	const Image& p_image,
+	const DataFormat p_format,
+	const CompressionQuality p_quality,
+	JobSystem& p_jobs
+) {
+	if (is_rgba8(p_format)) {
+		return p_image.pixels;
+	}
+
+	const BlockEncoder encoder = get_block_encoder(p_format);
+	if (encoder == nullptr) {
+		throw std::runtime_error("Unsupported texture format");
+	}
+
+	const DataFormatInfo& info = get_format_info(p_format);
+	const u32 blocks_x = (p_image.width + 3) / 4;
+	const u32 blocks_y = (p_image.height + 3) / 4;
+	std::vector<u8> out(info.get_size(p_image.width, p_image.height));
+
+	// Every block is written exactly once, so tiles can be encoded in any order
+	p_jobs.parallel_for(blocks_y, TILE_BLOCK_ROWS, [&](const u32 p_begin, const u32 p_end) {
+		for (u32 y = p_begin; y < p_end; y++) {
+			for (u32 x = 0; x < blocks_x; x++) {
+				encoder(fetch_block(p_image, x, y), &out[(usize(y) * blocks_x + x) * info.block_size], p_quality);
+			}
+		}
+	});
+	return out;
+}
@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include "bc_encoder.h"
+#include "image.h"
+
+#include <nova/core/job_system.h>
+#include <nova/render/data_format.h>
+
+#include <vector>
+
+namespace Nova::Cooker {
+	/// Block rows per job, small enough to keep threads balanced on small mips
+	static constexpr u32 TILE_BLOCK_ROWS = 4;
+
+	/// Whether compress_image() can produce the format
+	bool is_texture_format_supported(DataFormat format);
+
+	/**
+	 * @brief Encodes an RGBA8 image into format, one job per tile of block rows.
+	 *
+	 * RGBA8 formats are copied as is. Blocks past the right or bottom edge repeat the last column or row. The
+	 * output does not depend on the thread count.
+	 */
+	std::vector<u8> compress_image(const Image& image, DataFormat format, CompressionQuality quality, JobSystem& jobs);
+} // namespace Nova::Cooker
@@ -5,11 +5,16 @@
  */
 
 #include <nova/core/debug.h>
+#include <nova/core/job_system.h>
+#include <nova/core/memory_tracker.h>
+#include <nova/core/task_graph.h>
 #include <nova/platform/window_driver.h>
 #include <nova/render/render_device.h>
 #include <nova/render/render_driver.h>
 #include <nova/types.h>
 
+#include <array>
+#include <chrono>
 #include <cstdlib>
 #include <limits>
 #include <vector>
@@ -140,11 +145,23 @@ int main() {
 		Debug::get_logger()->set_level(spdlog::level::info);
 	}
 
+	// Generous, they only catch leaks and runaway growth
+	MemoryTracker::set_budget(MemoryTag::RENDER, 256ull << 20);
+	MemoryTracker::set_budget(MemoryTag::DRIVER, 256ull << 20);
+	MemoryTracker::set_budget(MemoryTag::DEVICE, 1ull << 30);
+
 	try {
+		const auto startup_begin = std::chrono::steady_clock::now();
+
+		// Window and driver calls stay on this thread, it becomes worker zero
+		JobSystem jobs;
+
+		// Instance creation and device enumeration overlap with opening the window
 		WindowDriver* wd = WindowDriver::create();
-		RenderDriver* rd = RenderDriver::create(RenderAPI::VULKAN, wd);
+		auto rd_future = RenderDriver::create_async(RenderAPI::VULKAN, wd);
 
 		WindowID window = wd->create_window("Nova", 1280, 720);
+		RenderDriver* rd = rd_future.get();
 		SurfaceID surface = rd->create_surface(window);
 
 		rd->select_device(RenderDevice::choose_device(rd, surface));
@@ -172,14 +189,82 @@ int main() {
 
 		PipelineID pipeline = rd->create_pipeline(params);
 		CommandPoolID pool = rd->create_command_pool(graphics_queue);
-		CommandBufferID cmd = rd->create_command_buffer(pool);
 
-		(void)cmd;
+		// A frame reuses the command buffer and fence of the frame MAX_FRAMES_IN_FLIGHT before it
+		std::array<CommandBufferID, TaskGraph::MAX_FRAMES_IN_FLIGHT> commands;
+		std::array<FenceID, TaskGraph::MAX_FRAMES_IN_FLIGHT> fences;
+		for (u32 i = 0; i < TaskGraph::MAX_FRAMES_IN_FLIGHT; i++) {
+			commands[i] = rd->create_command_buffer(pool);
+			fences[i] = rd->create_fence(true);
+		}
+
+		const std::chrono::duration<f64, std::milli> startup_time = std::chrono::steady_clock::now() - startup_begin;
+		NOVA_INFO("Startup took {:.3f} ms", startup_time.count());
 
-		while (wd->get_window_count() > 0) {
-			wd->poll_events();
+		TaskGraph graph(jobs);
+		bool running = true;
+		auto last_update = std::chrono::steady_clock::now();
+		f64 delta_time = 0.0;
+
+		const TaskID input = graph.add_task(
+			"Input",
+			[&](u64) {
+				wd->poll_events();
+				running = wd->get_window_count() > 0;
+			},
+			true
+		);
+		// There is no scene yet, simulation only advances the clock
+		const TaskID simulate = graph.add_task("Simulate", [&](u64) {
+			const auto now = std::chrono::steady_clock::now();
+			delta_time = std::chrono::duration<f64>(now - last_update).count();
+			last_update = now;
+		});
+		const TaskID record = graph.add_task("Record", [&](const u64 p_frame) {
+			const u32 index = p_frame % TaskGraph::MAX_FRAMES_IN_FLIGHT;
+			rd->wait_for_fence(fences[index]);
+			rd->reset_fence(fences[index]);
+			rd->begin_command_buffer(commands[index]);
+			rd->end_command_buffer(commands[index]);
+		});
+		const TaskID submit = graph.add_task("Submit", [&](const u64 p_frame) {
+			const u32 index = p_frame % TaskGraph::MAX_FRAMES_IN_FLIGHT;
+			rd->submit(graphics_queue, commands[index], fences[index]);
+		});
+
+		// Simulation only waits for input, so the next frame simulates while this one records and submits
+		graph.add_dependency(simulate, input);
+		graph.add_dependency(record, simulate);
+		graph.add_dependency(submit, record);
+		// Recording and submitting share the command pool and queue, which the driver doesn't synchronize
+		graph.add_previous_frame_dependency(record, submit);
+
+		auto last_report = std::chrono::steady_clock::now();
+		while (running) {
+			graph.execute();
+			MemoryTracker::end_frame();
+
+			if (std::chrono::steady_clock::now() - last_report >= std::chrono::seconds(1)) {
+				last_report = std::chrono::steady_clock::now();
+				NOVA_DEBUG("Frame {} took {:.3f} ms", graph.get_frame_count(), graph.get_frame_time_ms());
+				for (TaskID task = 0; task < graph.get_task_count(); task++) {
+					[[maybe_unused]] const TaskTiming& timing = graph.get_task_timing(task);
+					NOVA_DEBUG(
+						"  {} started at {:.3f} ms, took {:.3f} ms",
+						graph.get_task_name(task),
+						timing.start_ms,
+						timing.duration_ms
+					);
+				}
+				MemoryTracker::log_report();
+			}
 		}
+		graph.wait_idle();
 
+		for (FenceID fence : fences) {
+			rd->wait_for_fence(fence);
+			rd->destroy_fence(fence);
+		}
 		rd->destroy_command_pool(pool);
 		rd->destroy_pipeline(pipeline);
 		rd->destroy_shader(vert);
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/types.h>
+
+// clang-format off
+#if defined(__x86_64__) || defined(_M_X64)
+	#define NOVA_ARCH_X86_64
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define NOVA_ARCH_ARM64
+#endif
+
+// Lets a function use instructions beyond the build's baseline, callers must check CpuInfo first
+#if defined(NOVA_COMPILER_GCC) || defined(NOVA_COMPILER_CLANG)
+	#define NOVA_TARGET(features) __attribute__((target(features)))
+#else
+	#define NOVA_TARGET(features)
+#endif
+// clang-format on
+
+namespace Nova {
+	enum class CpuFeature { SSE2, SSSE3, SSE4_1, SSE4_2, AVX, AVX2, FMA, F16C, AVX512F, NEON, MAX };
+
+	static constexpr usize CACHE_LINE_SIZE = 64;
+
+	struct NOVA_API CpuInfo {
+		u32 features = 0;
+		u32 logical_cores = 0;
+
+		constexpr bool has(const CpuFeature p_feature) const {
+			return features & (1u << static_cast<u32>(p_feature));
+		}
+
+		/**
+		 * @brief Returns the features of the running CPU, detected on first use. AVX and wider features are only
+		 * reported when the OS saves their registers.
+		 */
+		static const CpuInfo& get();
+	};
+} // namespace Nova
@@ -9,7 +9,24 @@
 #include <nova/api.h>
 #include <spdlog/spdlog.h>
 
-#include <memory>
+#include <utility>
+
+#define NOVA_LOG_LEVEL_TRACE 0
+#define NOVA_LOG_LEVEL_DEBUG 1
+#define NOVA_LOG_LEVEL_INFO 2
+#define NOVA_LOG_LEVEL_WARN 3
+#define NOVA_LOG_LEVEL_ERROR 4
+#define NOVA_LOG_LEVEL_CRITICAL 5
+#define NOVA_LOG_LEVEL_OFF 6
+
+// Levels below this are compiled out entirely
+#ifndef NOVA_ACTIVE_LOG_LEVEL
+#ifdef NDEBUG
+#define NOVA_ACTIVE_LOG_LEVEL NOVA_LOG_LEVEL_INFO
+#else
+#define NOVA_ACTIVE_LOG_LEVEL NOVA_LOG_LEVEL_TRACE
+#endif
+#endif
 
 namespace Nova {
 	namespace Internals {
@@ -24,7 +41,7 @@ namespace Nova {
 
 	class NOVA_API Debug {
 	  public:
-		static std::shared_ptr<spdlog::logger> get_logger();
+		static spdlog::logger* get_logger();
 		static bool is_debug();
 
 		template<typename... Args>
@@ -44,12 +61,41 @@ namespace Nova {
 	};
 } // namespace Nova
 
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_TRACE
+#define NOVA_TRACE(...) ::Nova::Debug::get_logger()->trace(__VA_ARGS__)
+#else
+#define NOVA_TRACE(...) static_cast<void>(0)
+#endif
+
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_DEBUG
+#define NOVA_DEBUG(...) ::Nova::Debug::get_logger()->debug(__VA_ARGS__)
+#else
+#define NOVA_DEBUG(...) static_cast<void>(0)
+#endif
+
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_INFO
 #define NOVA_INFO(...) ::Nova::Debug::get_logger()->info(__VA_ARGS__)
+#else
+#define NOVA_INFO(...) static_cast<void>(0)
+#endif
+
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_WARN
 #define NOVA_WARN(...) ::Nova::Debug::get_logger()->warn(__VA_ARGS__)
+#else
+#define NOVA_WARN(...) static_cast<void>(0)
+#endif
+
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_ERROR
 #define NOVA_ERROR(...) ::Nova::Debug::get_logger()->error(__VA_ARGS__)
+#else
+#define NOVA_ERROR(...) static_cast<void>(0)
+#endif
+
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_CRITICAL
 #define NOVA_CRITICAL(...) ::Nova::Debug::get_logger()->critical(__VA_ARGS__)
-#define NOVA_DEBUG(...) ::Nova::Debug::get_logger()->debug(__VA_ARGS__)
-#define NOVA_TRACE(...) ::Nova::Debug::get_logger()->trace(__VA_ARGS__)
+#else
+#define NOVA_CRITICAL(...) static_cast<void>(0)
+#endif
 
 #ifdef _MSC_VER
 #define NOVA_FUNC_NAME ::Nova::Internals::_format_func_name(__FUNCTION__)
@@ -57,7 +103,11 @@ namespace Nova {
 #define NOVA_FUNC_NAME ::Nova::Internals::_format_func_name(__PRETTY_FUNCTION__)
 #endif
 
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_TRACE
 #define NOVA_AUTO_TRACE() NOVA_TRACE("{}()", NOVA_FUNC_NAME)
+#else
+#define NOVA_AUTO_TRACE() static_cast<void>(0)
+#endif
 
 #define NOVA_ASSERT(expr) \
 	(static_cast<bool>(expr) \
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/core/cpu.h>
+#include <nova/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Nova {
+	class JobCounter;
+
+	/**
+	 * @brief Work stealing job scheduler with one worker per hardware thread.
+	 *
+	 * Every worker owns a Chase-Lev deque. It pushes and pops its own jobs at one end, newest first while their data
+	 * is still in cache, and idle workers steal the oldest jobs from the other end. The thread that creates the
+	 * system is worker zero and runs jobs whenever it waits. Only workers may schedule or wait.
+	 *
+	 * Jobs are callables stored inline in pooled slots, so scheduling never allocates. A thread can have up to
+	 * JOB_POOL_SIZE unfinished jobs of its own, past that scheduling runs other jobs until a slot frees up.
+	 */
+	class NOVA_API JobSystem {
+	  public:
+		/// Bytes a job's callable may take, capture a pointer to anything larger
+		static constexpr usize MAX_JOB_SIZE = 96;
+
+		static constexpr u32 JOB_POOL_SIZE = 4096;
+
+		/// thread_count includes the calling thread, zero means one per logical core
+		explicit JobSystem(u32 thread_count = 0);
+
+		/// Every job must have finished
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/// Queues function, counter is incremented now and decremented once function returns
+		template<typename F>
+		void run(F&& function, JobCounter* counter = nullptr);
+
+		/// Like run(), but function is only queued once dependency reaches zero
+		template<typename F>
+		void run_after(const JobCounter& dependency, F&& function, JobCounter* counter = nullptr);
+
+		/// Like run(), but only worker zero runs function, the next time it waits, e.g. for window system calls
+		template<typename F>
+		void run_on_main(F&& function, JobCounter* counter = nullptr);
+
+		/// Runs other jobs on this thread until counter reaches zero, instead of blocking
+		void wait(const JobCounter& counter);
+
+		/// Calls function(begin, end) on batches of [0, count) across the workers and waits for every batch
+		template<typename F>
+		void parallel_for(u32 count, u32 batch_size, F&& function);
+
+		u32 get_thread_count() const;
+
+		/// Index of the calling worker, below get_thread_count(), e.g. to pick per thread scratch memory
+		u32 get_thread_index() const;
+
+	  private:
+		friend class JobCounter;
+
+		struct alignas(CACHE_LINE_SIZE) Job {
+			void (*invoke)(void* data) = nullptr;
+			JobCounter* counter = nullptr;
+			Job* next = nullptr; // Next job waiting on the same counter
+			std::atomic<bool> in_use = false;
+			alignas(std::max_align_t) std::byte data[MAX_JOB_SIZE];
+		};
+
+		struct Worker;
+
+		std::unique_ptr<Worker[]> m_workers;
+		u32 m_thread_count = 0;
+
+		alignas(CACHE_LINE_SIZE) std::atomic<u32> m_sleeping = 0;
+		std::atomic<u32> m_wake_epoch = 0;
+		std::atomic<bool> m_running = true;
+
+		alignas(CACHE_LINE_SIZE) std::atomic<Job*> m_main_jobs = nullptr; // Newest first
+
+		template<typename F>
+		Job& _create_job(F&& function, JobCounter* counter);
+
+		Job& _allocate_job();
+		void _submit(Job& job);
+		void _submit_after(const JobCounter& dependency, Job& job);
+		void _submit_chain(Job* jobs);
+		void _submit_main(Job& job);
+		Job* _pop_main_job();
+		Job* _find_job(u32 index);
+		void _execute(Job& job);
+		void _finish(JobCounter& counter);
+		void _wake_one();
+		void _worker_main(u32 index);
+	};
+
+	/**
+	 * @brief Counts the unfinished jobs of a group, so threads and other jobs can wait for all of them.
+	 *
+	 * Must outlive the jobs counted by it and the run_after() calls that depend on it. It can be reused once it
+	 * reaches zero.
+	 */
+	class NOVA_API JobCounter {
+	  public:
+		JobCounter() = default;
+
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool is_done() const {
+			return m_count.load(std::memory_order_acquire) == 0;
+		}
+
+	  private:
+		friend class JobSystem;
+
+		/// Set while the last job hands out the waiters, the counter is not done yet but takes no more waiters
+		static constexpr u32 FINISHING = 1u << 31;
+
+		std::atomic<u32> m_count = 0;
+		mutable std::atomic<JobSystem::Job*> m_waiters = nullptr;
+	};
+
+	template<typename F>
+	JobSystem::Job& JobSystem::_create_job(F&& p_function, JobCounter* p_counter) {
+		using Function = std::decay_t<F>;
+		static_assert(sizeof(Function) <= MAX_JOB_SIZE, "Job captures too much, capture a pointer to its state");
+		static_assert(alignof(Function) <= alignof(std::max_align_t), "Job callables cannot be over aligned");
+
+		Job& job = _allocate_job();
+		::new (static_cast<void*>(job.data)) Function(std::forward<F>(p_function));
+		job.invoke = [](void* p_data) {
+			Function& function = *std::launder(static_cast<Function*>(p_data));
+			function();
+			function.~Function();
+		};
+		job.counter = p_counter;
+		if (p_counter) {
+			p_counter->m_count.fetch_add(1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	template<typename F>
+	void JobSystem::run(F&& p_function, JobCounter* p_counter) {
+		_submit(_create_job(std::forward<F>(p_function), p_counter));
+	}
+
+	template<typename F>
+	void JobSystem::run_after(const JobCounter& p_dependency, F&& p_function, JobCounter* p_counter) {
+		_submit_after(p_dependency, _create_job(std::forward<F>(p_function), p_counter));
+	}
+
+	template<typename F>
+	void JobSystem::run_on_main(F&& p_function, JobCounter* p_counter) {
+		_submit_main(_create_job(std::forward<F>(p_function), p_counter));
+	}
+
+	template<typename F>
+	void JobSystem::parallel_for(const u32 p_count, const u32 p_batch_size, F&& p_function) {
+		const u32 batch_size = std::max(p_batch_size, 1u);
+		JobCounter counter;
+		for (u32 begin = 0; begin < p_count; begin += batch_size) {
+			const u32 end = begin + std::min(batch_size, p_count - begin);
+			run([&p_function, begin, end] { p_function(begin, end); }, &counter);
+		}
+		wait(counter);
+	}
+} // namespace Nova
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/core/debug.h>
+#include <nova/types.h>
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace Nova {
+	/**
+	 * @brief Bump allocator over one reserved block of memory, usable by std::pmr containers.
+	 *
+	 * Allocating moves an offset forward and deallocating only takes back the most recent allocation, everything
+	 * else is freed at once by reset() or by rewinding to a marker, both O(1). The OS only commits pages once they
+	 * are touched, so the capacity can be generous. Running out of it throws std::bad_alloc.
+	 *
+	 * An arena is not thread safe. Use get_scratch() for temporaries, or own one per frame in flight for data that
+	 * lives until the frame finishes, resetting it when the frame starts again.
+	 */
+	class NOVA_API LinearArena final : public std::pmr::memory_resource {
+	  public:
+		/// huge_pages asks the OS to back the arena with huge pages, it silently falls back to normal pages
+		explicit LinearArena(usize capacity, bool huge_pages = false);
+		~LinearArena() override;
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		/// Frees everything allocated so far
+		void reset() {
+			m_offset = 0;
+		}
+
+		/// Pass to rewind() to free everything allocated after this call
+		usize get_marker() const {
+			return m_offset;
+		}
+
+		void rewind(const usize p_marker) {
+			NOVA_ASSERT(p_marker <= m_offset);
+			m_offset = p_marker;
+		}
+
+		usize get_used() const;
+		usize get_capacity() const;
+
+		/// Highest usage since construction, e.g. to size the arena
+		usize get_peak() const;
+
+		bool has_huge_pages() const;
+
+		/// Arena of the calling thread for allocations that end with the current scope, see ScratchScope
+		static LinearArena& get_scratch();
+
+	  protected:
+		void* do_allocate(usize bytes, usize alignment) override;
+		void do_deallocate(void* pointer, usize bytes, usize alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	  private:
+		friend class ScratchScope;
+
+		std::byte* m_memory = nullptr;
+		usize m_capacity = 0;
+		usize m_offset = 0;
+		usize m_peak = 0;
+		usize m_floor = 0; // Marker of the innermost ScratchScope, deallocating never goes below it
+		u32 m_depth = 0; // Open ScratchScopes
+#ifdef NOVA_WINDOWS
+		usize m_committed = 0;
+#endif
+		bool m_huge_pages = false;
+	};
+
+	/**
+	 * @brief Frees everything allocated from the calling thread's scratch arena during its lifetime.
+	 *
+	 * Scopes nest, but a container must not grow while a scope nested inside its own is open. The memory would come
+	 * from the top of the arena and be freed again when the nested scope ends, leaving the container dangling. Debug
+	 * builds assert on it.
+	 *
+	 * @code
+	 * ScratchScope scratch;
+	 * std::pmr::vector<VkLayerProperties> layers(count, scratch.get_resource());
+	 * @endcode
+	 */
+	class ScratchScope {
+	  public:
+		ScratchScope() :
+			m_arena(LinearArena::get_scratch()),
+			m_marker(m_arena.get_marker()),
+			m_outer_floor(m_arena.m_floor),
+			m_depth(++m_arena.m_depth) {
+			m_arena.m_floor = m_marker;
+		}
+
+		~ScratchScope() {
+			m_arena.rewind(m_marker);
+			m_arena.m_floor = m_outer_floor;
+			m_arena.m_depth--;
+		}
+
+		ScratchScope(const ScratchScope&) = delete;
+		ScratchScope& operator=(const ScratchScope&) = delete;
+
+		std::pmr::memory_resource* get_resource() const {
+#ifdef NDEBUG
+			return &m_arena;
+#else
+			return &m_resource;
+#endif
+		}
+
+	  private:
+#ifndef NDEBUG
+		/// Forwards to the arena, checking that no nested scope is open
+		class Resource final : public std::pmr::memory_resource {
+		  public:
+			explicit Resource(const ScratchScope& p_scope) : m_scope(p_scope) {}
+
+		  protected:
+			void* do_allocate(const usize p_bytes, const usize p_alignment) override {
+				NOVA_ASSERT(m_scope.m_depth == m_scope.m_arena.m_depth);
+				return m_scope.m_arena.allocate(p_bytes, p_alignment);
+			}
+
+			void do_deallocate(void* p_pointer, const usize p_bytes, const usize p_alignment) override {
+				m_scope.m_arena.deallocate(p_pointer, p_bytes, p_alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override {
+				return this == &p_other;
+			}
+
+		  private:
+			const ScratchScope& m_scope;
+		};
+#endif
+
+		LinearArena& m_arena;
+		usize m_marker;
+		usize m_outer_floor;
+		u32 m_depth;
+#ifndef NDEBUG
+		mutable Resource m_resource {*this};
+#endif
+	};
+} // namespace Nova
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/types.h>
+
+#include <string_view>
+#include <vector>
+
+namespace Nova {
+	enum class MemoryTag : u8 {
+		GENERAL, // Anything allocated outside of a MemoryScope
+		RENDER,
+		DRIVER, // Host memory the graphics driver allocates through the engine when tracking the heap
+		DEVICE, // GPU memory
+		PLATFORM,
+		ASSETS,
+		LOGGING,
+		MAX
+	};
+
+	struct MemoryStats {
+		u64 live_bytes = 0;
+		u64 live_count = 0;
+		u64 peak_bytes = 0;
+		u64 total_bytes = 0; // Since startup
+		u64 total_count = 0;
+		u64 frame_bytes = 0; // Allocated during the last frame, see MemoryTracker::end_frame()
+		u64 frame_count = 0;
+		u64 budget = 0; // Zero when there is no budget
+	};
+
+	struct AllocationCount {
+		u64 count = 0;
+		u64 bytes = 0;
+	};
+
+	struct MemoryCallSite {
+		uptr address = 0; // Return address of the call to operator new
+		MemoryTag tag = MemoryTag::GENERAL; // Of the first allocation made there
+		u64 count = 0;
+		u64 bytes = 0;
+		u64 live_bytes = 0;
+	};
+
+	/**
+	 * @brief Live bytes, peak usage and allocation rate of every MemoryTag, with optional budgets.
+	 *
+	 * Heap allocations are only counted when the engine is built with NOVA_TRACK_MEMORY, which replaces the global
+	 * operator new and delete; debug builds then also count them per call site. Memory allocated elsewhere, such as
+	 * GPU memory, is reported by its owner through record_allocation() and record_free().
+	 *
+	 * Call end_frame() once per frame to update the allocation rate and check the budgets.
+	 */
+	class NOVA_API MemoryTracker {
+	  public:
+		/// Tracked heap allocation for allocators with an alignment, e.g. VkAllocationCallbacks
+		static void* allocate(usize bytes, usize alignment, MemoryTag tag);
+		static void* reallocate(void* pointer, usize bytes, usize alignment, MemoryTag tag);
+		static void deallocate(void* pointer);
+
+		static void record_allocation(MemoryTag tag, u64 bytes);
+		static void record_free(MemoryTag tag, u64 bytes);
+
+		/// Tag of heap allocations made by the calling thread, see MemoryScope
+		static MemoryTag get_thread_tag();
+		static void set_thread_tag(MemoryTag tag);
+
+		/// Tracked allocations made by the calling thread so far
+		static AllocationCount get_thread_count();
+
+		/// True when global operator new is tracked, otherwise only explicitly tracked memory is counted
+		static bool is_tracking_heap();
+
+		static MemoryStats get_stats(MemoryTag tag);
+
+		/// end_frame() warns once whenever the live bytes of the tag exceed the budget, zero removes it
+		static void set_budget(MemoryTag tag, u64 bytes);
+
+		/// Ends the allocation rate measurement for the frame and checks the budgets
+		static void end_frame();
+
+		/// Call sites with the most bytes allocated so far, empty unless heap tracking is on in a debug build
+		static std::vector<MemoryCallSite> get_top_call_sites(usize count);
+
+		/// Logs the stats of every tag at debug level, and the top call sites if there are any
+		static void log_report(usize call_sites = 8);
+
+		static std::string_view get_tag_name(MemoryTag tag);
+	};
+
+	/**
+	 * @brief Tags heap allocations made by the calling thread during its lifetime, restoring the previous tag after.
+	 */
+	class MemoryScope {
+	  public:
+		explicit MemoryScope(const MemoryTag p_tag) : m_previous(MemoryTracker::get_thread_tag()) {
+			MemoryTracker::set_thread_tag(p_tag);
+		}
+
+		~MemoryScope() {
+			MemoryTracker::set_thread_tag(m_previous);
+		}
+
+		MemoryScope(const MemoryScope&) = delete;
+		MemoryScope& operator=(const MemoryScope&) = delete;
+
+	  private:
+		MemoryTag m_previous;
+	};
+} // namespace Nova
+
+#define NOVA_MEMORY_CONCAT_IMPL(a, b) a##b
+#define NOVA_MEMORY_CONCAT(a, b) NOVA_MEMORY_CONCAT_IMPL(a, b)
+
+#define NOVA_MEMORY_SCOPE(tag) const ::Nova::MemoryScope NOVA_MEMORY_CONCAT(_nova_memory_scope_, __LINE__)(tag)
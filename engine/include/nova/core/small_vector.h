@@ -0,0 +1,503 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/core/debug.h>
+#include <nova/types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Nova {
+	/**
+	 * @brief Vector that keeps up to N elements inline and only moves them to the heap once it grows past that.
+	 *
+	 * Meant for members that nearly always hold a handful of elements, so they cost neither an allocation nor a
+	 * pointer chase. Like std::vector, growing invalidates pointers to elements, and so does moving an inline vector.
+	 */
+	template<typename T, usize N>
+	class SmallVector {
+		static_assert(N > 0, "Use std::vector without inline storage");
+
+	  public:
+		using value_type = T;
+		using size_type = usize;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		SmallVector() = default;
+
+		explicit SmallVector(const usize p_count) {
+			resize(p_count);
+		}
+
+		SmallVector(const usize p_count, const T& p_value) {
+			resize(p_count, p_value);
+		}
+
+		SmallVector(std::initializer_list<T> p_values) {
+			_assign(p_values.begin(), p_values.size());
+		}
+
+		SmallVector(const SmallVector& p_other) {
+			_assign(p_other.data(), p_other.size());
+		}
+
+		SmallVector(SmallVector&& p_other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+			_take(p_other);
+		}
+
+		~SmallVector() {
+			std::destroy_n(m_data, m_size);
+			_free();
+		}
+
+		SmallVector& operator=(const SmallVector& p_other) {
+			if (this != &p_other) {
+				clear();
+				_assign(p_other.data(), p_other.size());
+			}
+			return *this;
+		}
+
+		SmallVector& operator=(SmallVector&& p_other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+			if (this != &p_other) {
+				clear();
+				_free();
+				m_data = _inline();
+				m_capacity = N;
+				_take(p_other);
+			}
+			return *this;
+		}
+
+		SmallVector& operator=(std::initializer_list<T> p_values) {
+			clear();
+			_assign(p_values.begin(), p_values.size());
+			return *this;
+		}
+
+		T& operator[](const usize p_index) {
+			return m_data[p_index];
+		}
+
+		const T& operator[](const usize p_index) const {
+			return m_data[p_index];
+		}
+
+		T& front() {
+			return m_data[0];
+		}
+
+		const T& front() const {
+			return m_data[0];
+		}
+
+		T& back() {
+			return m_data[m_size - 1];
+		}
+
+		const T& back() const {
+			return m_data[m_size - 1];
+		}
+
+		T* data() {
+			return m_data;
+		}
+
+		const T* data() const {
+			return m_data;
+		}
+
+		T* begin() {
+			return m_data;
+		}
+
+		const T* begin() const {
+			return m_data;
+		}
+
+		T* end() {
+			return m_data + m_size;
+		}
+
+		const T* end() const {
+			return m_data + m_size;
+		}
+
+		bool empty() const {
+			return m_size == 0;
+		}
+
+		usize size() const {
+			return m_size;
+		}
+
+		usize capacity() const {
+			return m_capacity;
+		}
+
+		/// False once the elements have moved to the heap
+		bool is_inline() const {
+			return m_data == _inline();
+		}
+
+		void reserve(const usize p_capacity) {
+			if (p_capacity > m_capacity) {
+				_reallocate(p_capacity);
+			}
+		}
+
+		void resize(const usize p_size) {
+			reserve(p_size);
+			if (p_size > m_size) {
+				std::uninitialized_value_construct(m_data + m_size, m_data + p_size);
+			} else {
+				std::destroy(m_data + p_size, m_data + m_size);
+			}
+			m_size = p_size;
+		}
+
+		void resize(const usize p_size, const T& p_value) {
+			if (p_size > m_size && p_size > m_capacity) {
+				// The value may be an element of this vector
+				const T value = p_value;
+				reserve(p_size);
+				std::uninitialized_fill(m_data + m_size, m_data + p_size, value);
+			} else if (p_size > m_size) {
+				std::uninitialized_fill(m_data + m_size, m_data + p_size, p_value);
+			} else {
+				std::destroy(m_data + p_size, m_data + m_size);
+			}
+			m_size = p_size;
+		}
+
+		void clear() {
+			std::destroy_n(m_data, m_size);
+			m_size = 0;
+		}
+
+		void push_back(const T& p_value) {
+			emplace_back(p_value);
+		}
+
+		void push_back(T&& p_value) {
+			emplace_back(std::move(p_value));
+		}
+
+		template<typename... Args>
+		T& emplace_back(Args&&... p_args) {
+			if (m_size < m_capacity) {
+				T* element = std::construct_at(m_data + m_size, std::forward<Args>(p_args)...);
+				m_size++;
+				return *element;
+			}
+
+			// Construct first, the arguments may refer to elements that are about to move
+			const usize capacity = m_capacity * 2;
+			T* data = std::allocator<T>().allocate(capacity);
+			T* element;
+			try {
+				element = std::construct_at(data + m_size, std::forward<Args>(p_args)...);
+			} catch (...) {
+				std::allocator<T>().deallocate(data, capacity);
+				throw;
+			}
+			_relocate(data);
+			m_data = data;
+			m_capacity = capacity;
+			m_size++;
+			return *element;
+		}
+
+		void pop_back() {
+			NOVA_ASSERT(m_size > 0);
+			std::destroy_at(m_data + --m_size);
+		}
+
+		/// Removes the element, keeping the order of the others
+		T* erase(const T* p_position) {
+			T* position = m_data + (p_position - m_data);
+			std::move(position + 1, end(), position);
+			pop_back();
+			return position;
+		}
+
+		bool operator==(const SmallVector& p_other) const {
+			return std::equal(begin(), end(), p_other.begin(), p_other.end());
+		}
+
+	  private:
+		T* m_data = _inline();
+		usize m_size = 0;
+		usize m_capacity = N;
+		alignas(T) std::byte m_storage[sizeof(T) * N];
+
+		T* _inline() {
+			return std::launder(reinterpret_cast<T*>(m_storage));
+		}
+
+		const T* _inline() const {
+			return std::launder(reinterpret_cast<const T*>(m_storage));
+		}
+
+		void _assign(const T* p_values, const usize p_count) {
+			reserve(p_count);
+			std::uninitialized_copy_n(p_values, p_count, m_data);
+			m_size = p_count;
+		}
+
+		void _take(SmallVector& p_other) {
+			if (p_other.is_inline()) {
+				std::uninitialized_move_n(p_other.m_data, p_other.m_size, m_data);
+				m_size = p_other.m_size;
+				p_other.clear();
+			} else {
+				m_data = std::exchange(p_other.m_data, p_other._inline());
+				m_size = std::exchange(p_other.m_size, 0);
+				m_capacity = std::exchange(p_other.m_capacity, N);
+			}
+		}
+
+		void _reallocate(const usize p_capacity) {
+			T* data = std::allocator<T>().allocate(p_capacity);
+			_relocate(data);
+			m_data = data;
+			m_capacity = p_capacity;
+		}
+
+		/// Moves the elements into new storage and frees the old storage
+		void _relocate(T* p_data) {
+			if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+				std::uninitialized_move_n(m_data, m_size, p_data);
+			} else {
+				std::uninitialized_copy_n(m_data, m_size, p_data);
+			}
+			std::destroy_n(m_data, m_size);
+			_free();
+		}
+
+		void _free() {
+			if (!is_inline()) {
+				std::allocator<T>().deallocate(m_data, m_capacity);
+			}
+		}
+	};
+
+	/**
+	 * @brief Vector with room for N elements inline and never more, for counts with a known upper bound.
+	 *
+	 * Exceeding the capacity is an assertion failure.
+	 */
+	template<typename T, usize N>
+	class FixedVector {
+		static_assert(N > 0, "FixedVector needs a capacity");
+
+	  public:
+		using value_type = T;
+		using size_type = usize;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		FixedVector() = default;
+
+		explicit FixedVector(const usize p_count) {
+			resize(p_count);
+		}
+
+		FixedVector(const usize p_count, const T& p_value) {
+			resize(p_count, p_value);
+		}
+
+		FixedVector(std::initializer_list<T> p_values) {
+			_assign(p_values.begin(), p_values.size());
+		}
+
+		FixedVector(const FixedVector& p_other) {
+			_assign(p_other.data(), p_other.size());
+		}
+
+		FixedVector(FixedVector&& p_other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+			std::uninitialized_move_n(p_other.data(), p_other.m_size, data());
+			m_size = p_other.m_size;
+			p_other.clear();
+		}
+
+		~FixedVector() {
+			clear();
+		}
+
+		FixedVector& operator=(const FixedVector& p_other) {
+			if (this != &p_other) {
+				clear();
+				_assign(p_other.data(), p_other.size());
+			}
+			return *this;
+		}
+
+		FixedVector& operator=(FixedVector&& p_other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+			if (this != &p_other) {
+				clear();
+				std::uninitialized_move_n(p_other.data(), p_other.m_size, data());
+				m_size = p_other.m_size;
+				p_other.clear();
+			}
+			return *this;
+		}
+
+		FixedVector& operator=(std::initializer_list<T> p_values) {
+			clear();
+			_assign(p_values.begin(), p_values.size());
+			return *this;
+		}
+
+		T& operator[](const usize p_index) {
+			return data()[p_index];
+		}
+
+		const T& operator[](const usize p_index) const {
+			return data()[p_index];
+		}
+
+		T& front() {
+			return data()[0];
+		}
+
+		const T& front() const {
+			return data()[0];
+		}
+
+		T& back() {
+			return data()[m_size - 1];
+		}
+
+		const T& back() const {
+			return data()[m_size - 1];
+		}
+
+		T* data() {
+			return std::launder(reinterpret_cast<T*>(m_storage));
+		}
+
+		const T* data() const {
+			return std::launder(reinterpret_cast<const T*>(m_storage));
+		}
+
+		T* begin() {
+			return data();
+		}
+
+		const T* begin() const {
+			return data();
+		}
+
+		T* end() {
+			return data() + m_size;
+		}
+
+		const T* end() const {
+			return data() + m_size;
+		}
+
+		bool empty() const {
+			return m_size == 0;
+		}
+
+		bool full() const {
+			return m_size == N;
+		}
+
+		usize size() const {
+			return m_size;
+		}
+
+		static constexpr usize capacity() {
+			return N;
+		}
+
+		void resize(const usize p_size) {
+			NOVA_ASSERT(p_size <= N);
+			if (p_size > m_size) {
+				std::uninitialized_value_construct(data() + m_size, data() + p_size);
+			} else {
+				std::destroy(data() + p_size, data() + m_size);
+			}
+			m_size = p_size;
+		}
+
+		void resize(const usize p_size, const T& p_value) {
+			NOVA_ASSERT(p_size <= N);
+			if (p_size > m_size) {
+				std::uninitialized_fill(data() + m_size, data() + p_size, p_value);
+			} else {
+				std::destroy(data() + p_size, data() + m_size);
+			}
+			m_size = p_size;
+		}
+
+		void clear() {
+			std::destroy_n(data(), m_size);
+			m_size = 0;
+		}
+
+		void push_back(const T& p_value) {
+			emplace_back(p_value);
+		}
+
+		void push_back(T&& p_value) {
+			emplace_back(std::move(p_value));
+		}
+
+		template<typename... Args>
+		T& emplace_back(Args&&... p_args) {
+			NOVA_ASSERT(m_size < N);
+			T* element = std::construct_at(data() + m_size, std::forward<Args>(p_args)...);
+			m_size++;
+			return *element;
+		}
+
+		void pop_back() {
+			NOVA_ASSERT(m_size > 0);
+			std::destroy_at(data() + --m_size);
+		}
+
+		/// Removes the element, keeping the order of the others
+		T* erase(const T* p_position) {
+			T* position = data() + (p_position - data());
+			std::move(position + 1, end(), position);
+			pop_back();
+			return position;
+		}
+
+		bool operator==(const FixedVector& p_other) const {
+			return std::equal(begin(), end(), p_other.begin(), p_other.end());
+		}
+
+	  private:
+		usize m_size = 0;
+		alignas(T) std::byte m_storage[sizeof(T) * N];
+
+		void _assign(const T* p_values, const usize p_count) {
+			NOVA_ASSERT(p_count <= N);
+			std::uninitialized_copy_n(p_values, p_count, data());
+			m_size = p_count;
+		}
+	};
+} // namespace Nova
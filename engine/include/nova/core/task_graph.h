@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/core/job_system.h>
+#include <nova/types.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Nova {
+	using TaskID = u32;
+
+	struct TaskTiming {
+		f64 start_ms = 0.0; // Since the frame was started
+		f64 duration_ms = 0.0;
+	};
+
+	/**
+	 * @brief The tasks of a frame and the order between them, built once and then executed every frame.
+	 *
+	 * Each task runs as a job once its dependencies in the same frame have finished, so independent tasks run in
+	 * parallel. A task also waits for its own run in the previous frame and for any previous frame dependencies
+	 * added, but otherwise frames overlap: when simulation only depends on input, frame N + 1 simulates while frame
+	 * N is still recording and submitting. At most MAX_FRAMES_IN_FLIGHT frames run at once.
+	 *
+	 * The graph must be executed by worker zero of its JobSystem, which also runs the main thread tasks.
+	 *
+	 * @code
+	 * TaskGraph graph(jobs);
+	 * const TaskID input = graph.add_task("Input", [&](u64) { wd->poll_events(); }, true);
+	 * const TaskID simulate = graph.add_task("Simulate", [&](u64 p_frame) { world.update(p_frame); });
+	 * graph.add_dependency(simulate, input);
+	 *
+	 * while (running) {
+	 *     graph.execute();
+	 * }
+	 * graph.wait_idle();
+	 * @endcode
+	 */
+	class NOVA_API TaskGraph {
+	  public:
+		static constexpr u32 MAX_FRAMES_IN_FLIGHT = 2;
+
+		/// Called with the index of the frame being executed
+		using Function = std::function<void(u64 frame)>;
+
+		explicit TaskGraph(JobSystem& jobs);
+
+		/// Waits for every frame still running
+		~TaskGraph();
+
+		TaskGraph(const TaskGraph&) = delete;
+		TaskGraph& operator=(const TaskGraph&) = delete;
+
+		/// main_thread tasks only run on worker zero, e.g. to poll window events
+		TaskID add_task(std::string name, Function function, bool main_thread = false);
+
+		/// task waits for dependency to finish in the same frame
+		void add_dependency(TaskID task, TaskID dependency);
+
+		/// task waits for dependency to finish in the previous frame
+		void add_previous_frame_dependency(TaskID task, TaskID dependency);
+
+		/// Starts the next frame, then runs jobs until no more than MAX_FRAMES_IN_FLIGHT - 1 frames are left running
+		void execute();
+
+		/// Runs jobs until every started frame has finished
+		void wait_idle();
+
+		u32 get_task_count() const;
+		const std::string& get_task_name(TaskID task) const;
+
+		/// Frames started so far, the next frame executed gets this index
+		u64 get_frame_count() const;
+
+		/// Timing of the task in the most recently finished frame
+		const TaskTiming& get_task_timing(TaskID task) const;
+
+		/// Time between starting the most recently finished frame and its last task finishing
+		f64 get_frame_time_ms() const;
+
+	  private:
+		using Clock = std::chrono::steady_clock;
+
+		struct Task {
+			std::string name;
+			Function function;
+			bool main_thread = false;
+			std::vector<TaskID> dependencies;
+			std::vector<TaskID> previous_dependencies;
+		};
+
+		struct Frame {
+			u64 index = 0;
+			Clock::time_point start;
+			std::unique_ptr<JobCounter[]> done;
+			std::vector<Clock::time_point> task_start;
+			std::vector<Clock::time_point> task_end;
+		};
+
+		JobSystem& m_jobs;
+		std::vector<Task> m_tasks;
+		std::vector<TaskID> m_order;
+
+		// One more frame than can be in flight, since the oldest running frame still reads the one before it
+		Frame m_frames[MAX_FRAMES_IN_FLIGHT + 1];
+		u64 m_frame_count = 0;
+		u64 m_finished_count = 0;
+
+		std::vector<TaskTiming> m_timings;
+		f64 m_frame_time_ms = 0.0;
+
+		void _compile();
+		void _schedule(Frame& frame, TaskID task);
+		void _run(Frame& frame, TaskID task);
+		void _finish_frame();
+	};
+} // namespace Nova
@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/core/debug.h>
+#include <nova/types.h>
+
+#include <chrono>
+#include <string_view>
+
+namespace Nova {
+	/**
+	 * @brief Logs the time spent between construction and destruction at debug level.
+	 */
+	class ScopedTimer {
+	  public:
+		explicit ScopedTimer(const std::string_view p_name) : m_name(p_name), m_start(std::chrono::steady_clock::now()) {}
+
+		~ScopedTimer() {
+			NOVA_DEBUG("{} took {:.3f} ms", m_name, get_elapsed_ms());
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+		f64 get_elapsed_ms() const {
+			return std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+		}
+
+	  private:
+		std::string_view m_name;
+		std::chrono::steady_clock::time_point m_start;
+	};
+} // namespace Nova
+
+#define NOVA_TIMER_CONCAT_IMPL(a, b) a##b
+#define NOVA_TIMER_CONCAT(a, b) NOVA_TIMER_CONCAT_IMPL(a, b)
+
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_DEBUG
+#define NOVA_SCOPED_TIMER(name) const ::Nova::ScopedTimer NOVA_TIMER_CONCAT(_nova_timer_, __LINE__)(name)
+#else
+#define NOVA_SCOPED_TIMER(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/math/common.h>
+#include <nova/math/mat4.h>
+#include <nova/math/vec3.h>
+#include <nova/types.h>
+
+#include <limits>
+
+namespace Nova {
+	/// Axis aligned bounding box, min above max on any axis means it is empty
+	struct AABB {
+		Vec3A min;
+		Vec3A max;
+
+		/// Merging anything into the empty box gives the bounds of that thing
+		static constexpr AABB empty() {
+			constexpr f32 inf = std::numeric_limits<f32>::infinity();
+			return {{inf, inf, inf}, {-inf, -inf, -inf}};
+		}
+
+		static constexpr AABB from_center_extents(const Vec3A& p_center, const Vec3A& p_extents) {
+			return {p_center - p_extents, p_center + p_extents};
+		}
+
+		constexpr bool is_empty() const {
+			return min.x > max.x || min.y > max.y || min.z > max.z;
+		}
+
+		constexpr Vec3A get_center() const {
+			return (min + max) * 0.5f;
+		}
+
+		/// Half the size on each axis
+		constexpr Vec3A get_extents() const {
+			return (max - min) * 0.5f;
+		}
+
+		/// Used as the cost metric when building hierarchies, zero for empty boxes
+		constexpr f32 get_surface_area() const {
+			if (is_empty()) {
+				return 0.0f;
+			}
+			const Vec3A size = max - min;
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		constexpr bool contains(const Vec3A& p_point) const {
+			return p_point.x >= min.x && p_point.y >= min.y && p_point.z >= min.z && p_point.x <= max.x
+				&& p_point.y <= max.y && p_point.z <= max.z;
+		}
+
+		constexpr bool contains(const AABB& p_other) const {
+			return p_other.min.x >= min.x && p_other.min.y >= min.y && p_other.min.z >= min.z && p_other.max.x <= max.x
+				&& p_other.max.y <= max.y && p_other.max.z <= max.z;
+		}
+
+		/// Touching boxes overlap
+		constexpr bool overlaps(const AABB& p_other) const {
+			return min.x <= p_other.max.x && min.y <= p_other.max.y && min.z <= p_other.max.z && max.x >= p_other.min.x
+				&& max.y >= p_other.min.y && max.z >= p_other.min.z;
+		}
+	};
+
+	struct BoundingSphere {
+		Vec3A center;
+		f32 radius = 0.0f;
+
+		/// Encloses the box, not the tightest sphere for its contents
+		static constexpr BoundingSphere from_aabb(const AABB& p_box) {
+			return {p_box.get_center(), length(p_box.get_extents())};
+		}
+
+		constexpr bool contains(const Vec3A& p_point) const {
+			return length_squared(p_point - center) <= radius * radius;
+		}
+
+		constexpr bool overlaps(const BoundingSphere& p_other) const {
+			const f32 distance = radius + p_other.radius;
+			return length_squared(p_other.center - center) <= distance * distance;
+		}
+	};
+
+	struct Ray {
+		Vec3A origin;
+		Vec3A direction; // Distances along the ray are in multiples of its length
+	};
+
+	constexpr AABB merge(const AABB& p_a, const AABB& p_b) {
+		return {min(p_a.min, p_b.min), max(p_a.max, p_b.max)};
+	}
+
+	constexpr AABB merge(const AABB& p_box, const Vec3A& p_point) {
+		return {min(p_box.min, p_point), max(p_box.max, p_point)};
+	}
+
+	/// Smallest sphere enclosing both
+	constexpr BoundingSphere merge(const BoundingSphere& p_a, const BoundingSphere& p_b) {
+		const Vec3A offset = p_b.center - p_a.center;
+		const f32 distance = length(offset);
+		if (distance + p_b.radius <= p_a.radius) {
+			return p_a;
+		}
+		if (distance + p_a.radius <= p_b.radius) {
+			return p_b;
+		}
+		const f32 radius = (distance + p_a.radius + p_b.radius) * 0.5f;
+		return {p_a.center + offset * ((radius - p_a.radius) / distance), radius};
+	}
+
+	/// Bounds of the transformed box, which grow under rotation. p_m must be affine.
+	constexpr AABB transform(const Mat4& p_m, const AABB& p_box) {
+		if (p_box.is_empty()) {
+			return p_box;
+		}
+
+		// Each output axis spans the absolute projections of the input extents (Arvo)
+		const auto abs_xyz = [](const Vec4<f32>& p_column) {
+			return Vec3A(
+				p_column.x < 0.0f ? -p_column.x : p_column.x,
+				p_column.y < 0.0f ? -p_column.y : p_column.y,
+				p_column.z < 0.0f ? -p_column.z : p_column.z
+			);
+		};
+		const Vec3A extents = p_box.get_extents();
+		const Vec3A new_extents = abs_xyz(p_m.columns[0]) * extents.x + abs_xyz(p_m.columns[1]) * extents.y
+			+ abs_xyz(p_m.columns[2]) * extents.z;
+		return AABB::from_center_extents(transform_point(p_m, p_box.get_center()), new_extents);
+	}
+
+	/// The radius grows by the largest axis scale, p_m must be affine
+	constexpr BoundingSphere transform(const Mat4& p_m, const BoundingSphere& p_sphere) {
+		f32 scale_squared = 0.0f;
+		for (u32 i = 0; i < 3; i++) {
+			const Vec4<f32>& column = p_m.columns[i];
+			const f32 axis_squared = column.x * column.x + column.y * column.y + column.z * column.z;
+			scale_squared = axis_squared > scale_squared ? axis_squared : scale_squared;
+		}
+		return {transform_point(p_m, p_sphere.center), p_sphere.radius * Math::sqrt(scale_squared)};
+	}
+} // namespace Nova
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/math/bounds.h>
+#include <nova/math/frustum.h>
+#include <nova/types.h>
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Nova {
+	/**
+	 * @brief Dynamic bounding volume hierarchy over proxy boxes, for culling, picking and overlap queries.
+	 *
+	 * Nodes are stored depth first in one array with one proxy per leaf, and every node records where its subtree
+	 * ends. Queries walk forward through memory without a stack and skip a rejected subtree with a single jump.
+	 *
+	 * Changes take effect in update(). Moved proxies refit their ancestors in place, and subtrees whose surface area
+	 * has grown well past the area they were built with are rebuilt in place with SAH. New proxies, and proxies that
+	 * jump clear of their old bounds, are tested linearly until enough of them, or enough removals, have accumulated
+	 * to rebuild the whole tree.
+	 *
+	 * Queries append the user data of every match to results and may run concurrently with each other, but not with
+	 * changes.
+	 */
+	class NOVA_API BVH {
+	  public:
+		using ProxyID = u32;
+
+		static constexpr ProxyID INVALID_PROXY = ~0u;
+
+		struct RayHit {
+			u32 user_data;
+			f32 distance;
+		};
+
+		/// Refines a box hit, e.g. against triangles, returns the distance along the ray or infinity for a miss
+		using RayTest = std::function<f32(u32 user_data, const Ray& ray)>;
+
+		ProxyID create_proxy(const AABB& bounds, u32 user_data);
+		void destroy_proxy(ProxyID proxy);
+		void move_proxy(ProxyID proxy, const AABB& bounds);
+
+		const AABB& get_bounds(ProxyID proxy) const;
+		u32 get_user_data(ProxyID proxy) const;
+		u32 get_proxy_count() const;
+
+		/// Bounds of every proxy in the tree, empty before the first update()
+		AABB get_root_bounds() const;
+
+		/// Applies the changes made since the last call
+		void update();
+
+		/// Rebuilds the whole tree with SAH, update() does this by itself when it is due
+		void rebuild();
+
+		/// Planes fully containing a subtree are not tested again below it, and fully visible subtrees are not tested
+		void query_frustum(const Frustum& frustum, std::vector<u32>& results) const;
+
+		void query_overlap(const AABB& bounds, std::vector<u32>& results) const;
+
+		/// Every proxy whose box the ray enters within max_distance, in no particular order
+		void query_ray(const Ray& ray, f32 max_distance, std::vector<u32>& results) const;
+
+		/// Closest proxy hit within max_distance, using the box entry distance when test is empty
+		std::optional<RayHit> raycast(const Ray& ray, f32 max_distance, const RayTest& test = nullptr) const;
+
+	  private:
+		struct alignas(32) Node {
+			f32 min[3];
+			ProxyID proxy; // INVALID_PROXY for interior nodes and destroyed leaves
+			f32 max[3];
+			u32 escape; // One past the last node of the subtree, leaves have no children so this is their index + 1
+		};
+
+		struct Proxy {
+			AABB bounds;
+			u32 user_data = 0;
+			u32 leaf; // Node index, or PENDING or FREE
+		};
+
+		struct BuildItem;
+
+		std::vector<Node> m_nodes;
+		std::vector<u32> m_parents;
+		std::vector<f32> m_build_areas;
+		std::vector<u8> m_refit_flags;
+
+		std::vector<Proxy> m_proxies;
+		std::vector<ProxyID> m_free;
+		std::vector<ProxyID> m_pending;
+		std::vector<u32> m_moved_leaves;
+		u32 m_proxy_count = 0;
+		u32 m_destroyed_leaves = 0;
+
+		void _release_leaf(u32 leaf);
+		void _refit();
+		u32 _build(u32 node, u32 parent, BuildItem* items, u32 count);
+		void _rebuild_subtree(u32 node);
+	};
+} // namespace Nova
@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/types.h>
+
+#include <cmath>
+#include <concepts>
+#include <limits>
+
+namespace Nova::Math {
+	static constexpr f32 PI = 3.14159265358979323846f;
+	static constexpr f32 TAU = 2.0f * PI;
+
+	constexpr f32 to_radians(const f32 p_degrees) {
+		return p_degrees * (PI / 180.0f);
+	}
+
+	constexpr f32 to_degrees(const f32 p_radians) {
+		return p_radians * (180.0f / PI);
+	}
+
+	/// std::sqrt at runtime, Newton's method during constant evaluation
+	template<std::floating_point T>
+	constexpr T sqrt(const T p_value) {
+		if consteval {
+			if (p_value == T(0) || p_value == std::numeric_limits<T>::infinity()) {
+				return p_value;
+			}
+			if (!(p_value > T(0))) {
+				return std::numeric_limits<T>::quiet_NaN();
+			}
+			// Starting above the root, the iterates fall monotonically until rounding stops them
+			f64 x = p_value > T(1) ? f64(p_value) : 1.0;
+			while (true) {
+				const f64 next = 0.5 * (x + p_value / x);
+				if (next >= x) {
+					break;
+				}
+				x = next;
+			}
+			return static_cast<T>(x);
+		}
+		return std::sqrt(p_value);
+	}
+} // namespace Nova::Math
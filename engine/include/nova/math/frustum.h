@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/math/bounds.h>
+#include <nova/math/common.h>
+#include <nova/math/mat4.h>
+#include <nova/math/vec4.h>
+#include <nova/types.h>
+
+namespace Nova {
+	/**
+	 * @brief Six planes bounding a view volume.
+	 *
+	 * Planes have unit normals pointing into the frustum, a point p is inside when dot(plane.xyz, p) + plane.w >= 0,
+	 * which is the layout GpuCuller and MeshletView expect.
+	 */
+	struct Frustum {
+		Vec4<f32> planes[6]; // Left, right, bottom, top, near, far
+
+		/**
+		 * @brief Extracts the planes of a projection with depth from 0 to 1, like Mat4::perspective().
+		 *
+		 * Passing projection * view gives world space planes, passing a full model-view-projection gives them in
+		 * that model's space.
+		 */
+		static constexpr Frustum from_matrix(const Mat4& p_m) {
+			const Vec4<f32>(&c)[4] = p_m.columns;
+			const auto normalize_plane = [](const Vec4<f32>& p_plane) {
+				const f32 length = Math::sqrt(p_plane.x * p_plane.x + p_plane.y * p_plane.y + p_plane.z * p_plane.z);
+				return p_plane / length;
+			};
+
+			const Vec4<f32> x = {c[0].x, c[1].x, c[2].x, c[3].x};
+			const Vec4<f32> y = {c[0].y, c[1].y, c[2].y, c[3].y};
+			const Vec4<f32> z = {c[0].z, c[1].z, c[2].z, c[3].z};
+			const Vec4<f32> w = {c[0].w, c[1].w, c[2].w, c[3].w};
+			return {{
+				normalize_plane(w + x),
+				normalize_plane(w - x),
+				normalize_plane(w + y),
+				normalize_plane(w - y),
+				normalize_plane(z),
+				normalize_plane(w - z),
+			}};
+		}
+
+		/// Conservative, spheres just outside a corner can pass
+		constexpr bool intersects(const BoundingSphere& p_sphere) const {
+			for (const Vec4<f32>& plane : planes) {
+				const f32 distance = plane.x * p_sphere.center.x + plane.y * p_sphere.center.y
+					+ plane.z * p_sphere.center.z + plane.w;
+				if (distance < -p_sphere.radius) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// Conservative, boxes just outside a corner can pass
+		constexpr bool intersects(const AABB& p_box) const {
+			for (const Vec4<f32>& plane : planes) {
+				// The corner furthest along the normal
+				const f32 x = plane.x >= 0.0f ? p_box.max.x : p_box.min.x;
+				const f32 y = plane.y >= 0.0f ? p_box.max.y : p_box.min.y;
+				const f32 z = plane.z >= 0.0f ? p_box.max.z : p_box.min.z;
+				if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f) {
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+} // namespace Nova
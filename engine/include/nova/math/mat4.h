@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/math/quat.h>
+#include <nova/math/simd.h>
+#include <nova/math/vec3.h>
+#include <nova/math/vec4.h>
+#include <nova/types.h>
+
+#include <cmath>
+
+namespace Nova {
+	/**
+	 * @brief Column major 4x4 matrix acting on column vectors, matching GLSL's mat4.
+	 *
+	 * Projections are right handed and target Vulkan clip space: depth runs from 0 at the near plane to 1 at the far
+	 * plane and y is flipped so world up is screen up.
+	 */
+	struct alignas(16) Mat4 {
+		Vec4<f32> columns[4];
+
+		static constexpr Mat4 identity() {
+			return {{
+				{1.0f, 0.0f, 0.0f, 0.0f},
+				{0.0f, 1.0f, 0.0f, 0.0f},
+				{0.0f, 0.0f, 1.0f, 0.0f},
+				{0.0f, 0.0f, 0.0f, 1.0f},
+			}};
+		}
+
+		static constexpr Mat4 translation(const Vec3A& p_offset) {
+			Mat4 result = identity();
+			result.columns[3] = {p_offset.x, p_offset.y, p_offset.z, 1.0f};
+			return result;
+		}
+
+		static constexpr Mat4 scale(const Vec3A& p_scale) {
+			return {{
+				{p_scale.x, 0.0f, 0.0f, 0.0f},
+				{0.0f, p_scale.y, 0.0f, 0.0f},
+				{0.0f, 0.0f, p_scale.z, 0.0f},
+				{0.0f, 0.0f, 0.0f, 1.0f},
+			}};
+		}
+
+		/// p_rotation must be normalized
+		static constexpr Mat4 rotation(const Quat& p_rotation) {
+			return trs({0.0f, 0.0f, 0.0f}, p_rotation, {1.0f, 1.0f, 1.0f});
+		}
+
+		/// Scales, then rotates, then translates
+		static constexpr Mat4 trs(const Vec3A& p_translation, const Quat& p_rotation, const Vec3A& p_scale) {
+			const f32 x = p_rotation.x;
+			const f32 y = p_rotation.y;
+			const f32 z = p_rotation.z;
+			const f32 w = p_rotation.w;
+			return {{
+				{
+					(1.0f - 2.0f * (y * y + z * z)) * p_scale.x,
+					2.0f * (x * y + w * z) * p_scale.x,
+					2.0f * (x * z - w * y) * p_scale.x,
+					0.0f,
+				},
+				{
+					2.0f * (x * y - w * z) * p_scale.y,
+					(1.0f - 2.0f * (x * x + z * z)) * p_scale.y,
+					2.0f * (y * z + w * x) * p_scale.y,
+					0.0f,
+				},
+				{
+					2.0f * (x * z + w * y) * p_scale.z,
+					2.0f * (y * z - w * x) * p_scale.z,
+					(1.0f - 2.0f * (x * x + y * y)) * p_scale.z,
+					0.0f,
+				},
+				{p_translation.x, p_translation.y, p_translation.z, 1.0f},
+			}};
+		}
+
+		/// p_fov_y is the full vertical field of view in radians
+		static Mat4 perspective(const f32 p_fov_y, const f32 p_aspect, const f32 p_near, const f32 p_far) {
+			const f32 focal_length = 1.0f / std::tan(p_fov_y * 0.5f);
+			const f32 depth = 1.0f / (p_near - p_far);
+			return {{
+				{focal_length / p_aspect, 0.0f, 0.0f, 0.0f},
+				{0.0f, -focal_length, 0.0f, 0.0f},
+				{0.0f, 0.0f, p_far * depth, -1.0f},
+				{0.0f, 0.0f, p_near * p_far * depth, 0.0f},
+			}};
+		}
+
+		static constexpr Mat4 orthographic(
+			const f32 p_left,
+			const f32 p_right,
+			const f32 p_bottom,
+			const f32 p_top,
+			const f32 p_near,
+			const f32 p_far
+		) {
+			const f32 width = 1.0f / (p_right - p_left);
+			const f32 height = 1.0f / (p_top - p_bottom);
+			const f32 depth = 1.0f / (p_near - p_far);
+			return {{
+				{2.0f * width, 0.0f, 0.0f, 0.0f},
+				{0.0f, -2.0f * height, 0.0f, 0.0f},
+				{0.0f, 0.0f, depth, 0.0f},
+				{-(p_right + p_left) * width, (p_top + p_bottom) * height, p_near * depth, 1.0f},
+			}};
+		}
+
+		/// View matrix looking down -z, p_up must not be parallel to the view direction
+		static constexpr Mat4 look_at(const Vec3A& p_eye, const Vec3A& p_target, const Vec3A& p_up) {
+			const Vec3A forward = normalize(p_target - p_eye);
+			const Vec3A side = normalize(cross(forward, p_up));
+			const Vec3A up = cross(side, forward);
+			return {{
+				{side.x, up.x, -forward.x, 0.0f},
+				{side.y, up.y, -forward.y, 0.0f},
+				{side.z, up.z, -forward.z, 0.0f},
+				{-dot(side, p_eye), -dot(up, p_eye), dot(forward, p_eye), 1.0f},
+			}};
+		}
+	};
+
+	constexpr Vec4<f32> operator*(const Mat4& p_m, const Vec4<f32>& p_v) {
+		if !consteval {
+			const Simd::f32x4 v = Simd::load(p_v);
+			Simd::f32x4 result = Simd::mul(Simd::load(p_m.columns[0]), Simd::shuffle<0, 0, 0, 0>(v));
+			result = Simd::madd(Simd::load(p_m.columns[1]), Simd::shuffle<1, 1, 1, 1>(v), result);
+			result = Simd::madd(Simd::load(p_m.columns[2]), Simd::shuffle<2, 2, 2, 2>(v), result);
+			result = Simd::madd(Simd::load(p_m.columns[3]), Simd::shuffle<3, 3, 3, 3>(v), result);
+			return Simd::to_vec4(result);
+		}
+		return p_m.columns[0] * p_v.x + p_m.columns[1] * p_v.y + p_m.columns[2] * p_v.z + p_m.columns[3] * p_v.w;
+	}
+
+	/// Applies p_b first, then p_a
+	constexpr Mat4 operator*(const Mat4& p_a, const Mat4& p_b) {
+		return {{p_a * p_b.columns[0], p_a * p_b.columns[1], p_a * p_b.columns[2], p_a * p_b.columns[3]}};
+	}
+
+	constexpr bool operator==(const Mat4& p_a, const Mat4& p_b) {
+		for (u32 i = 0; i < 4; i++) {
+			if (!(p_a.columns[i] == p_b.columns[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// Transforms a position, assumes an affine matrix so there is no divide by w
+	constexpr Vec3A transform_point(const Mat4& p_m, const Vec3A& p_point) {
+		const Vec4<f32> result = p_m * Vec4<f32> {p_point.x, p_point.y, p_point.z, 1.0f};
+		return {result.x, result.y, result.z};
+	}
+
+	/// Transforms a direction, ignoring translation
+	constexpr Vec3A transform_vector(const Mat4& p_m, const Vec3A& p_vector) {
+		const Vec4<f32> result = p_m * Vec4<f32> {p_vector.x, p_vector.y, p_vector.z, 0.0f};
+		return {result.x, result.y, result.z};
+	}
+
+	constexpr Mat4 transpose(const Mat4& p_m) {
+		if !consteval {
+			Simd::f32x4 c0 = Simd::load(p_m.columns[0]);
+			Simd::f32x4 c1 = Simd::load(p_m.columns[1]);
+			Simd::f32x4 c2 = Simd::load(p_m.columns[2]);
+			Simd::f32x4 c3 = Simd::load(p_m.columns[3]);
+			Simd::transpose(c0, c1, c2, c3);
+			return {{Simd::to_vec4(c0), Simd::to_vec4(c1), Simd::to_vec4(c2), Simd::to_vec4(c3)}};
+		}
+		const Vec4<f32>(&c)[4] = p_m.columns;
+		return {{
+			{c[0].x, c[1].x, c[2].x, c[3].x},
+			{c[0].y, c[1].y, c[2].y, c[3].y},
+			{c[0].z, c[1].z, c[2].z, c[3].z},
+			{c[0].w, c[1].w, c[2].w, c[3].w},
+		}};
+	}
+
+	/**
+	 * @brief General inverse. Singular matrices produce infinities or NaNs.
+	 *
+	 * With columns a, b, c and d whose last rows are x, y, z and w, the inverse follows from s = a x b, t = c x d,
+	 * u = y * a - x * b and v = w * c - z * d, all on the upper three rows.
+	 */
+	constexpr Mat4 inverse(const Mat4& p_m) {
+		if !consteval {
+			const Simd::f32x4 a = Simd::load(p_m.columns[0]);
+			const Simd::f32x4 b = Simd::load(p_m.columns[1]);
+			const Simd::f32x4 c = Simd::load(p_m.columns[2]);
+			const Simd::f32x4 d = Simd::load(p_m.columns[3]);
+			const Simd::f32x4 x = Simd::shuffle<3, 3, 3, 3>(a);
+			const Simd::f32x4 y = Simd::shuffle<3, 3, 3, 3>(b);
+			const Simd::f32x4 z = Simd::shuffle<3, 3, 3, 3>(c);
+			const Simd::f32x4 w = Simd::shuffle<3, 3, 3, 3>(d);
+
+			// The last lanes of all four cancel to zero
+			Simd::f32x4 s = Simd::cross3(a, b);
+			Simd::f32x4 t = Simd::cross3(c, d);
+			Simd::f32x4 u = Simd::sub(Simd::mul(a, y), Simd::mul(b, x));
+			Simd::f32x4 v = Simd::sub(Simd::mul(c, w), Simd::mul(d, z));
+
+			const Simd::f32x4 determinant = Simd::add(Simd::dot3(s, v), Simd::dot3(t, u));
+			const Simd::f32x4 inverse_determinant = Simd::div(Simd::splat(1.0f), determinant);
+			s = Simd::mul(s, inverse_determinant);
+			t = Simd::mul(t, inverse_determinant);
+			u = Simd::mul(u, inverse_determinant);
+			v = Simd::mul(v, inverse_determinant);
+
+			// Rows of the inverse, the dot products fill the last lane
+			const Simd::f32x4 last_negative = Simd::set(0.0f, 0.0f, 0.0f, -1.0f);
+			const Simd::f32x4 last_positive = Simd::set(0.0f, 0.0f, 0.0f, 1.0f);
+			Simd::f32x4 r0 = Simd::madd(t, y, Simd::cross3(b, v));
+			Simd::f32x4 r1 = Simd::sub(Simd::cross3(v, a), Simd::mul(t, x));
+			Simd::f32x4 r2 = Simd::madd(s, w, Simd::cross3(d, u));
+			Simd::f32x4 r3 = Simd::sub(Simd::cross3(u, c), Simd::mul(s, z));
+			r0 = Simd::madd(Simd::dot3(b, t), last_negative, r0);
+			r1 = Simd::madd(Simd::dot3(a, t), last_positive, r1);
+			r2 = Simd::madd(Simd::dot3(d, s), last_negative, r2);
+			r3 = Simd::madd(Simd::dot3(c, s), last_positive, r3);
+
+			Simd::transpose(r0, r1, r2, r3);
+			return {{Simd::to_vec4(r0), Simd::to_vec4(r1), Simd::to_vec4(r2), Simd::to_vec4(r3)}};
+		}
+
+		const auto xyz = [](const Vec4<f32>& p_v) { return Vec3<f32> {p_v.x, p_v.y, p_v.z}; };
+		const Vec3<f32> a = xyz(p_m.columns[0]);
+		const Vec3<f32> b = xyz(p_m.columns[1]);
+		const Vec3<f32> c = xyz(p_m.columns[2]);
+		const Vec3<f32> d = xyz(p_m.columns[3]);
+		const f32 x = p_m.columns[0].w;
+		const f32 y = p_m.columns[1].w;
+		const f32 z = p_m.columns[2].w;
+		const f32 w = p_m.columns[3].w;
+
+		Vec3<f32> s = cross(a, b);
+		Vec3<f32> t = cross(c, d);
+		Vec3<f32> u = a * y - b * x;
+		Vec3<f32> v = c * w - d * z;
+
+		const f32 inverse_determinant = 1.0f / (dot(s, v) + dot(t, u));
+		s *= inverse_determinant;
+		t *= inverse_determinant;
+		u *= inverse_determinant;
+		v *= inverse_determinant;
+
+		const Vec3<f32> r0 = cross(b, v) + t * y;
+		const Vec3<f32> r1 = cross(v, a) - t * x;
+		const Vec3<f32> r2 = cross(d, u) + s * w;
+		const Vec3<f32> r3 = cross(u, c) - s * z;
+		return transpose({{
+			{r0.x, r0.y, r0.z, -dot(b, t)},
+			{r1.x, r1.y, r1.z, dot(a, t)},
+			{r2.x, r2.y, r2.z, -dot(d, s)},
+			{r3.x, r3.y, r3.z, dot(c, s)},
+		}});
+	}
+} // namespace Nova
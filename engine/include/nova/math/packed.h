@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/math/vec2.h>
+#include <nova/math/vec3.h>
+#include <nova/math/vec4.h>
+#include <nova/math/vector_stream.h>
+#include <nova/types.h>
+
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace Nova {
+	/// IEEE 754 half precision float, a storage format only, convert to f32 for arithmetic
+	struct Half {
+		u16 bits;
+	};
+
+	using f16 = Half;
+	using Half2 = Vec2<Half>;
+	using Half4 = Vec4<Half>;
+
+	/// Rounds to the nearest half, out of range values become infinity
+	constexpr Half to_half(const f32 p_value) {
+		u32 x = std::bit_cast<u32>(p_value);
+
+		const u32 sign = (x >> 16) & 0x8000;
+		x &= 0x7FFFFFFF;
+
+		if (x >= 0x7F800000) {
+			return {static_cast<u16>(sign | 0x7C00 | (x > 0x7F800000 ? 0x200 : 0))};
+		}
+		if (x >= 0x477FF000) {
+			return {static_cast<u16>(sign | 0x7C00)}; // 65520 and above round to infinity
+		}
+
+		u32 half;
+		u32 remainder;
+		u32 midpoint;
+		if (x < 0x38800000) {
+			// Below the smallest normal half, shift the mantissa into a subnormal
+			if (x < 0x33000000) {
+				return {static_cast<u16>(sign)};
+			}
+			const u32 mantissa = (x & 0x7FFFFF) | 0x800000;
+			const u32 shift = 126 - (x >> 23);
+			half = mantissa >> shift;
+			remainder = mantissa & ((1u << shift) - 1);
+			midpoint = 1u << (shift - 1);
+		} else {
+			half = (x >> 13) - ((127 - 15) << 10);
+			remainder = x & 0x1FFF;
+			midpoint = 0x1000;
+		}
+
+		// Round to nearest even, a carry out of the mantissa correctly bumps the exponent
+		if (remainder > midpoint || (remainder == midpoint && (half & 1))) {
+			half++;
+		}
+		return {static_cast<u16>(sign | half)};
+	}
+
+	/// Exact, every half is representable as a float
+	constexpr f32 to_f32(const Half p_half) {
+		const u32 sign = static_cast<u32>(p_half.bits & 0x8000) << 16;
+		const u32 exponent = (p_half.bits >> 10) & 0x1F;
+		const u32 mantissa = p_half.bits & 0x3FF;
+
+		if (exponent == 0x1F) {
+			return std::bit_cast<f32>(sign | 0x7F800000 | (mantissa << 13));
+		}
+		if (exponent == 0) {
+			// Subnormal halves are normal floats, scale the mantissa by the smallest subnormal
+			const f32 magnitude = static_cast<f32>(mantissa) * 5.9604644775390625e-8f;
+			return std::bit_cast<f32>(sign | std::bit_cast<u32>(magnitude));
+		}
+		return std::bit_cast<f32>(sign | ((exponent + 127 - 15) << 23) | (mantissa << 13));
+	}
+
+	constexpr Half2 to_half(const Vec2<f32>& p_v) {
+		return {to_half(p_v.x), to_half(p_v.y)};
+	}
+
+	constexpr Half4 to_half(const Vec4<f32>& p_v) {
+		return {to_half(p_v.x), to_half(p_v.y), to_half(p_v.z), to_half(p_v.w)};
+	}
+
+	constexpr Vec2<f32> to_f32(const Half2& p_v) {
+		return {to_f32(p_v.x), to_f32(p_v.y)};
+	}
+
+	constexpr Vec4<f32> to_f32(const Half4& p_v) {
+		return {to_f32(p_v.x), to_f32(p_v.y), to_f32(p_v.z), to_f32(p_v.w)};
+	}
+
+	/// Integer components the GPU reads as floats in [-1, 1] for signed types and [0, 1] for unsigned ones
+	template<std::integral T, u32 N>
+	struct PackedNorm {
+		T data[N];
+	};
+
+	using SNorm8x4 = PackedNorm<i8, 4>;
+	using UNorm8x4 = PackedNorm<u8, 4>;
+	using SNorm16x2 = PackedNorm<i16, 2>;
+	using UNorm16x2 = PackedNorm<u16, 2>;
+	using SNorm16x4 = PackedNorm<i16, 4>;
+	using UNorm16x4 = PackedNorm<u16, 4>;
+
+	/// Clamps to the range of T and rounds half away from zero, NaN packs to the lowest value
+	template<std::integral T>
+	constexpr T pack_norm(const f32 p_value) {
+		constexpr f32 scale = static_cast<f32>(std::numeric_limits<T>::max());
+		constexpr f32 lowest = std::is_signed_v<T> ? -1.0f : 0.0f;
+		const f32 clamped = p_value > 1.0f ? 1.0f : (p_value > lowest ? p_value : lowest);
+		const f32 scaled = clamped * scale;
+		return static_cast<T>(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+	}
+
+	/// The lowest signed value also decodes to -1, as it does on the GPU
+	template<std::integral T>
+	constexpr f32 unpack_norm(const T p_value) {
+		const f32 value = static_cast<f32>(p_value) / static_cast<f32>(std::numeric_limits<T>::max());
+		return value < -1.0f ? -1.0f : value;
+	}
+
+	template<std::integral T>
+	constexpr PackedNorm<T, 2> pack_norm(const Vec2<f32>& p_v) {
+		return {pack_norm<T>(p_v.x), pack_norm<T>(p_v.y)};
+	}
+
+	template<std::integral T>
+	constexpr PackedNorm<T, 4> pack_norm(const Vec4<f32>& p_v) {
+		return {pack_norm<T>(p_v.x), pack_norm<T>(p_v.y), pack_norm<T>(p_v.z), pack_norm<T>(p_v.w)};
+	}
+
+	template<std::integral T>
+	constexpr Vec2<f32> unpack_norm(const PackedNorm<T, 2>& p_v) {
+		return {unpack_norm(p_v.data[0]), unpack_norm(p_v.data[1])};
+	}
+
+	template<std::integral T>
+	constexpr Vec4<f32> unpack_norm(const PackedNorm<T, 4>& p_v) {
+		return {unpack_norm(p_v.data[0]), unpack_norm(p_v.data[1]), unpack_norm(p_v.data[2]), unpack_norm(p_v.data[3])};
+	}
+
+	/// Projects a direction onto the octahedron and unfolds it into [-1, 1] squared, the zero vector maps to +Z
+	constexpr Vec2<f32> encode_octahedral(const Vec3A& p_v) {
+		const f32 abs_x = p_v.x < 0.0f ? -p_v.x : p_v.x;
+		const f32 abs_y = p_v.y < 0.0f ? -p_v.y : p_v.y;
+		const f32 abs_z = p_v.z < 0.0f ? -p_v.z : p_v.z;
+		const f32 l1 = abs_x + abs_y + abs_z;
+		const f32 inv_l1 = l1 > 0.0f ? 1.0f / l1 : 0.0f;
+
+		const f32 x = p_v.x * inv_l1;
+		const f32 y = p_v.y * inv_l1;
+		if (p_v.z >= 0.0f) {
+			return {x, y};
+		}
+
+		// The lower hemisphere folds over the diagonals into the corners
+		const f32 abs_px = x < 0.0f ? -x : x;
+		const f32 abs_py = y < 0.0f ? -y : y;
+		return {(1.0f - abs_py) * (x >= 0.0f ? 1.0f : -1.0f), (1.0f - abs_px) * (y >= 0.0f ? 1.0f : -1.0f)};
+	}
+
+	/// Returns a unit vector
+	constexpr Vec3A decode_octahedral(const Vec2<f32>& p_p) {
+		const f32 z = 1.0f - (p_p.x < 0.0f ? -p_p.x : p_p.x) - (p_p.y < 0.0f ? -p_p.y : p_p.y);
+		const f32 fold = z < 0.0f ? -z : 0.0f;
+		const f32 x = p_p.x + (p_p.x >= 0.0f ? -fold : fold);
+		const f32 y = p_p.y + (p_p.y >= 0.0f ? -fold : fold);
+		return normalize(Vec3A(x, y, z));
+	}
+
+	/**
+	 * @brief Octahedral unit vector fetched as R16G16_SNORM, 4 bytes instead of 12.
+	 *
+	 * Shaders decode it like decode_octahedral(), the error stays below 0.005 degrees.
+	 */
+	using OctNormal = SNorm16x2;
+
+	constexpr OctNormal pack_normal(const Vec3A& p_normal) {
+		return pack_norm<i16>(encode_octahedral(p_normal));
+	}
+
+	constexpr Vec3A unpack_normal(const OctNormal& p_normal) {
+		return decode_octahedral(unpack_norm(p_normal));
+	}
+
+	/**
+	 * @brief Octahedral tangent and bitangent sign fetched as R16G16_SNORM, 4 bytes instead of 16.
+	 *
+	 * The second component stores y remapped to [0, 1] and negated when the bitangent is flipped. Shaders recover
+	 * the sign from it and then y as abs(value) * 2 - 1, giving up one bit of precision on that axis.
+	 */
+	using OctTangent = SNorm16x2;
+
+	constexpr OctTangent pack_tangent(const Vec3A& p_tangent, const f32 p_bitangent_sign) {
+		const Vec2<f32> p = encode_octahedral(p_tangent);
+
+		// Zero has no sign, so keep y at least one step above it
+		constexpr f32 min_y = 1.0f / static_cast<f32>(std::numeric_limits<i16>::max());
+		const f32 y = p.y * 0.5f + 0.5f;
+		const f32 clamped_y = y > min_y ? y : min_y;
+		return pack_norm<i16>(Vec2<f32> {p.x, p_bitangent_sign < 0.0f ? -clamped_y : clamped_y});
+	}
+
+	/// Returns the unit tangent in xyz and the bitangent sign in w
+	constexpr Vec4<f32> unpack_tangent(const OctTangent& p_tangent) {
+		const Vec2<f32> p = unpack_norm(p_tangent);
+		const f32 sign = p.y < 0.0f ? -1.0f : 1.0f;
+		const Vec3A t = decode_octahedral({p.x, p.y * sign * 2.0f - 1.0f});
+		return {t.x, t.y, t.z, sign};
+	}
+
+	// The kernels below pick the widest instruction set the CPU supports at runtime, dst must hold as many values
+	// as src. They match the scalar functions above, apart from the last bit of normalized results.
+
+	NOVA_API void pack_halves(std::span<const f32> src, std::span<Half> dst);
+	NOVA_API void unpack_halves(std::span<const Half> src, std::span<f32> dst);
+
+	NOVA_API void pack_normals(ConstVec3Stream src, std::span<OctNormal> dst);
+	NOVA_API void unpack_normals(std::span<const OctNormal> src, Vec3Stream dst);
+} // namespace Nova
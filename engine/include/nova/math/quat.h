@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/math/common.h>
+#include <nova/math/simd.h>
+#include <nova/math/vec3.h>
+#include <nova/pragma.h>
+#include <nova/types.h>
+
+#include <cmath>
+
+namespace Nova {
+	NOVA_BEGIN_ALLOW_ANONYMOUS_TYPES
+
+	/// Rotation quaternion, w is the scalar part
+	struct alignas(16) Quat {
+		union {
+			struct {
+				f32 x, y, z, w;
+			};
+			f32 data[4];
+		};
+
+		static constexpr Quat identity() {
+			return {0.0f, 0.0f, 0.0f, 1.0f};
+		}
+
+		/// p_axis must be normalized, positive angles turn counter-clockwise looking down the axis
+		static Quat from_axis_angle(const Vec3A& p_axis, const f32 p_angle) {
+			const f32 s = std::sin(p_angle * 0.5f);
+			return {p_axis.x * s, p_axis.y * s, p_axis.z * s, std::cos(p_angle * 0.5f)};
+		}
+	};
+
+	NOVA_END_ALLOW_ANONYMOUS_TYPES
+
+	namespace Simd {
+		inline f32x4 load(const Quat& p_q) {
+			return load(p_q.data);
+		}
+
+		inline Quat to_quat(const f32x4 p_v) {
+			Quat result;
+			store(result.data, p_v);
+			return result;
+		}
+	} // namespace Simd
+
+	/// Applies p_b first, then p_a
+	constexpr Quat operator*(const Quat& p_a, const Quat& p_b) {
+		if !consteval {
+			const Simd::f32x4 a = Simd::load(p_a);
+			const Simd::f32x4 b = Simd::load(p_b);
+			Simd::f32x4 result = Simd::mul(Simd::shuffle<3, 3, 3, 3>(a), b);
+			result = Simd::madd(
+				Simd::mul(Simd::shuffle<0, 0, 0, 0>(a), Simd::set(1.0f, -1.0f, 1.0f, -1.0f)),
+				Simd::shuffle<3, 2, 1, 0>(b),
+				result
+			);
+			result = Simd::madd(
+				Simd::mul(Simd::shuffle<1, 1, 1, 1>(a), Simd::set(1.0f, 1.0f, -1.0f, -1.0f)),
+				Simd::shuffle<2, 3, 0, 1>(b),
+				result
+			);
+			result = Simd::madd(
+				Simd::mul(Simd::shuffle<2, 2, 2, 2>(a), Simd::set(-1.0f, 1.0f, 1.0f, -1.0f)),
+				Simd::shuffle<1, 0, 3, 2>(b),
+				result
+			);
+			return Simd::to_quat(result);
+		}
+		return {
+			p_a.w * p_b.x + p_a.x * p_b.w + p_a.y * p_b.z - p_a.z * p_b.y,
+			p_a.w * p_b.y - p_a.x * p_b.z + p_a.y * p_b.w + p_a.z * p_b.x,
+			p_a.w * p_b.z + p_a.x * p_b.y - p_a.y * p_b.x + p_a.z * p_b.w,
+			p_a.w * p_b.w - p_a.x * p_b.x - p_a.y * p_b.y - p_a.z * p_b.z,
+		};
+	}
+
+	/// Rotates p_v, p_q must be normalized
+	constexpr Vec3A operator*(const Quat& p_q, const Vec3A& p_v) {
+		// v + w * t + q.xyz x t with t = 2 * q.xyz x v, the padding lane stays zero
+		if !consteval {
+			const Simd::f32x4 q = Simd::load(p_q);
+			const Simd::f32x4 v = Simd::load(p_v);
+			const Simd::f32x4 t = Simd::mul(Simd::cross3(q, v), Simd::splat(2.0f));
+			const Simd::f32x4 result = Simd::madd(Simd::shuffle<3, 3, 3, 3>(q), t, Simd::add(v, Simd::cross3(q, t)));
+			return Simd::to_vec3a(result);
+		}
+		const Vec3A axis = {p_q.x, p_q.y, p_q.z};
+		const Vec3A t = cross(axis, p_v) * 2.0f;
+		return p_v + t * p_q.w + cross(axis, t);
+	}
+
+	constexpr bool operator==(const Quat& p_a, const Quat& p_b) {
+		return p_a.x == p_b.x && p_a.y == p_b.y && p_a.z == p_b.z && p_a.w == p_b.w;
+	}
+
+	constexpr f32 dot(const Quat& p_a, const Quat& p_b) {
+		if !consteval {
+			return Simd::get_x(Simd::dot4(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return p_a.x * p_b.x + p_a.y * p_b.y + p_a.z * p_b.z + p_a.w * p_b.w;
+	}
+
+	constexpr f32 length(const Quat& p_q) {
+		return Math::sqrt(dot(p_q, p_q));
+	}
+
+	constexpr Quat normalize(const Quat& p_q) {
+		if !consteval {
+			const Simd::f32x4 q = Simd::load(p_q);
+			return Simd::to_quat(Simd::div(q, Simd::sqrt(Simd::dot4(q, q))));
+		}
+		const f32 inverse_length = 1.0f / length(p_q);
+		return {p_q.x * inverse_length, p_q.y * inverse_length, p_q.z * inverse_length, p_q.w * inverse_length};
+	}
+
+	constexpr Quat conjugate(const Quat& p_q) {
+		return {-p_q.x, -p_q.y, -p_q.z, p_q.w};
+	}
+
+	/// Equal to the conjugate for normalized quaternions
+	constexpr Quat inverse(const Quat& p_q) {
+		const f32 inverse_length_squared = 1.0f / dot(p_q, p_q);
+		return {
+			-p_q.x * inverse_length_squared,
+			-p_q.y * inverse_length_squared,
+			-p_q.z * inverse_length_squared,
+			p_q.w * inverse_length_squared,
+		};
+	}
+
+	/**
+	 * @brief Blends p_a and p_b with weights p_wa and p_wb, negating p_b when the pair is more than 180 degrees apart.
+	 */
+	constexpr Quat blend(const Quat& p_a, const Quat& p_b, f32 p_wa, f32 p_wb) {
+		if (dot(p_a, p_b) < 0.0f) {
+			p_wb = -p_wb;
+		}
+		if !consteval {
+			const Simd::f32x4 a = Simd::mul(Simd::load(p_a), Simd::splat(p_wa));
+			return Simd::to_quat(Simd::madd(Simd::load(p_b), Simd::splat(p_wb), a));
+		}
+		return {
+			p_a.x * p_wa + p_b.x * p_wb,
+			p_a.y * p_wa + p_b.y * p_wb,
+			p_a.z * p_wa + p_b.z * p_wb,
+			p_a.w * p_wa + p_b.w * p_wb,
+		};
+	}
+
+	/// Normalized linear interpolation along the shortest arc, cheaper than slerp but not constant speed
+	constexpr Quat nlerp(const Quat& p_a, const Quat& p_b, const f32 p_t) {
+		return normalize(blend(p_a, p_b, 1.0f - p_t, p_t));
+	}
+
+	/// Constant speed interpolation along the shortest arc
+	inline Quat slerp(const Quat& p_a, const Quat& p_b, const f32 p_t) {
+		// Nearly parallel inputs make sin(theta) vanish, where nlerp is indistinguishable
+		static constexpr f32 NLERP_THRESHOLD = 0.9995f;
+
+		const f32 cos_theta = std::abs(dot(p_a, p_b));
+		if (cos_theta > NLERP_THRESHOLD) {
+			return nlerp(p_a, p_b, p_t);
+		}
+
+		const f32 theta = std::acos(cos_theta);
+		const f32 inverse_sin = 1.0f / std::sin(theta);
+		return blend(p_a, p_b, std::sin((1.0f - p_t) * theta) * inverse_sin, std::sin(p_t * theta) * inverse_sin);
+	}
+} // namespace Nova
@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/core/cpu.h>
+#include <nova/types.h>
+
+#include <cmath>
+
+// clang-format off
+#if defined(NOVA_ARCH_X86_64)
+	#define NOVA_SIMD_SSE
+	#include <immintrin.h>
+#elif defined(NOVA_ARCH_ARM64)
+	#define NOVA_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+// clang-format on
+
+/**
+ * Four lane float operations behind the math types.
+ *
+ * These are inline, so they use what the including translation unit targets: SSE2 on x86-64 with FMA when it is
+ * enabled at compile time, NEON on ARM64, and plain arrays elsewhere.
+ */
+namespace Nova::Simd {
+#if defined(NOVA_SIMD_SSE)
+	using f32x4 = __m128;
+#elif defined(NOVA_SIMD_NEON)
+	using f32x4 = float32x4_t;
+#else
+	struct f32x4 {
+		f32 lanes[4];
+	};
+#endif
+
+	/// p_src must be 16 byte aligned
+	inline f32x4 load(const f32* p_src) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_load_ps(p_src);
+#elif defined(NOVA_SIMD_NEON)
+		return vld1q_f32(p_src);
+#else
+		return {{p_src[0], p_src[1], p_src[2], p_src[3]}};
+#endif
+	}
+
+	/// p_dst must be 16 byte aligned
+	inline void store(f32* p_dst, const f32x4 p_v) {
+#if defined(NOVA_SIMD_SSE)
+		_mm_store_ps(p_dst, p_v);
+#elif defined(NOVA_SIMD_NEON)
+		vst1q_f32(p_dst, p_v);
+#else
+		for (u32 i = 0; i < 4; i++) {
+			p_dst[i] = p_v.lanes[i];
+		}
+#endif
+	}
+
+	inline f32x4 set(const f32 p_x, const f32 p_y, const f32 p_z, const f32 p_w) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_setr_ps(p_x, p_y, p_z, p_w);
+#else
+		alignas(16) const f32 lanes[4] = {p_x, p_y, p_z, p_w};
+		return load(lanes);
+#endif
+	}
+
+	inline f32x4 splat(const f32 p_value) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_set1_ps(p_value);
+#elif defined(NOVA_SIMD_NEON)
+		return vdupq_n_f32(p_value);
+#else
+		return {{p_value, p_value, p_value, p_value}};
+#endif
+	}
+
+	inline f32 get_x(const f32x4 p_v) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_cvtss_f32(p_v);
+#elif defined(NOVA_SIMD_NEON)
+		return vgetq_lane_f32(p_v, 0);
+#else
+		return p_v.lanes[0];
+#endif
+	}
+
+	/// Returns (p_v[X], p_v[Y], p_v[Z], p_v[W])
+	template<u32 X, u32 Y, u32 Z, u32 W>
+	inline f32x4 shuffle(const f32x4 p_v) {
+		static_assert(X < 4 && Y < 4 && Z < 4 && W < 4);
+#if defined(NOVA_SIMD_SSE)
+		return _mm_shuffle_ps(p_v, p_v, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(NOVA_SIMD_NEON)
+		alignas(16) const f32 lanes[4] = {
+			vgetq_lane_f32(p_v, X),
+			vgetq_lane_f32(p_v, Y),
+			vgetq_lane_f32(p_v, Z),
+			vgetq_lane_f32(p_v, W),
+		};
+		return vld1q_f32(lanes);
+#else
+		return {{p_v.lanes[X], p_v.lanes[Y], p_v.lanes[Z], p_v.lanes[W]}};
+#endif
+	}
+
+#if !defined(NOVA_SIMD_SSE) && !defined(NOVA_SIMD_NEON)
+	template<typename F>
+	inline f32x4 map(const f32x4 p_a, const f32x4 p_b, F p_op) {
+		f32x4 result;
+		for (u32 i = 0; i < 4; i++) {
+			result.lanes[i] = p_op(p_a.lanes[i], p_b.lanes[i]);
+		}
+		return result;
+	}
+#endif
+
+	inline f32x4 add(const f32x4 p_a, const f32x4 p_b) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_add_ps(p_a, p_b);
+#elif defined(NOVA_SIMD_NEON)
+		return vaddq_f32(p_a, p_b);
+#else
+		return map(p_a, p_b, [](const f32 a, const f32 b) { return a + b; });
+#endif
+	}
+
+	inline f32x4 sub(const f32x4 p_a, const f32x4 p_b) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_sub_ps(p_a, p_b);
+#elif defined(NOVA_SIMD_NEON)
+		return vsubq_f32(p_a, p_b);
+#else
+		return map(p_a, p_b, [](const f32 a, const f32 b) { return a - b; });
+#endif
+	}
+
+	inline f32x4 mul(const f32x4 p_a, const f32x4 p_b) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_mul_ps(p_a, p_b);
+#elif defined(NOVA_SIMD_NEON)
+		return vmulq_f32(p_a, p_b);
+#else
+		return map(p_a, p_b, [](const f32 a, const f32 b) { return a * b; });
+#endif
+	}
+
+	inline f32x4 div(const f32x4 p_a, const f32x4 p_b) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_div_ps(p_a, p_b);
+#elif defined(NOVA_SIMD_NEON)
+		return vdivq_f32(p_a, p_b);
+#else
+		return map(p_a, p_b, [](const f32 a, const f32 b) { return a / b; });
+#endif
+	}
+
+	/// Lane-wise p_a < p_b ? p_a : p_b, NEON differs only for NaN inputs
+	inline f32x4 min(const f32x4 p_a, const f32x4 p_b) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_min_ps(p_a, p_b);
+#elif defined(NOVA_SIMD_NEON)
+		return vminq_f32(p_a, p_b);
+#else
+		return map(p_a, p_b, [](const f32 a, const f32 b) { return a < b ? a : b; });
+#endif
+	}
+
+	/// Lane-wise p_a > p_b ? p_a : p_b, NEON differs only for NaN inputs
+	inline f32x4 max(const f32x4 p_a, const f32x4 p_b) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_max_ps(p_a, p_b);
+#elif defined(NOVA_SIMD_NEON)
+		return vmaxq_f32(p_a, p_b);
+#else
+		return map(p_a, p_b, [](const f32 a, const f32 b) { return a > b ? a : b; });
+#endif
+	}
+
+	/// p_a * p_b + p_c, fused where the target has FMA
+	inline f32x4 madd(const f32x4 p_a, const f32x4 p_b, const f32x4 p_c) {
+#if defined(NOVA_SIMD_SSE) && defined(__FMA__)
+		return _mm_fmadd_ps(p_a, p_b, p_c);
+#elif defined(NOVA_SIMD_NEON)
+		return vfmaq_f32(p_c, p_a, p_b);
+#else
+		return add(mul(p_a, p_b), p_c);
+#endif
+	}
+
+	inline f32x4 sqrt(const f32x4 p_v) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_sqrt_ps(p_v);
+#elif defined(NOVA_SIMD_NEON)
+		return vsqrtq_f32(p_v);
+#else
+		f32x4 result;
+		for (u32 i = 0; i < 4; i++) {
+			result.lanes[i] = std::sqrt(p_v.lanes[i]);
+		}
+		return result;
+#endif
+	}
+
+	inline f32x4 negate(const f32x4 p_v) {
+#if defined(NOVA_SIMD_SSE)
+		return _mm_xor_ps(p_v, _mm_set1_ps(-0.0f));
+#elif defined(NOVA_SIMD_NEON)
+		return vnegq_f32(p_v);
+#else
+		return sub(splat(0.0f), p_v);
+#endif
+	}
+
+	/// Horizontal sum of all four lanes, broadcast to every lane
+	inline f32x4 dot4(const f32x4 p_a, const f32x4 p_b) {
+		const f32x4 product = mul(p_a, p_b);
+		const f32x4 pairs = add(product, shuffle<1, 0, 3, 2>(product));
+		return add(pairs, shuffle<2, 3, 0, 1>(pairs));
+	}
+
+	/// Sum of the first three lanes, broadcast to every lane
+	inline f32x4 dot3(const f32x4 p_a, const f32x4 p_b) {
+		const f32x4 product = mul(p_a, p_b);
+		const f32x4 sum = add(add(product, shuffle<1, 1, 1, 1>(product)), shuffle<2, 2, 2, 2>(product));
+		return shuffle<0, 0, 0, 0>(sum);
+	}
+
+	/// Cross product of the first three lanes, the last lane is zero for finite inputs
+	inline f32x4 cross3(const f32x4 p_a, const f32x4 p_b) {
+		const f32x4 a_yzx = shuffle<1, 2, 0, 3>(p_a);
+		const f32x4 b_yzx = shuffle<1, 2, 0, 3>(p_b);
+		const f32x4 c = sub(mul(p_a, b_yzx), mul(a_yzx, p_b));
+		return shuffle<1, 2, 0, 3>(c);
+	}
+
+	inline void transpose(f32x4& p_r0, f32x4& p_r1, f32x4& p_r2, f32x4& p_r3) {
+#if defined(NOVA_SIMD_SSE)
+		_MM_TRANSPOSE4_PS(p_r0, p_r1, p_r2, p_r3);
+#elif defined(NOVA_SIMD_NEON)
+		const float32x4x2_t t01 = vtrnq_f32(p_r0, p_r1);
+		const float32x4x2_t t23 = vtrnq_f32(p_r2, p_r3);
+		p_r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+		p_r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+		p_r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+		p_r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+#else
+		f32x4* rows[4] = {&p_r0, &p_r1, &p_r2, &p_r3};
+		for (u32 i = 0; i < 4; i++) {
+			for (u32 j = i + 1; j < 4; j++) {
+				const f32 value = rows[i]->lanes[j];
+				rows[i]->lanes[j] = rows[j]->lanes[i];
+				rows[j]->lanes[i] = value;
+			}
+		}
+#endif
+	}
+} // namespace Nova::Simd
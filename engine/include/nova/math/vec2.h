@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <nova/math/common.h>
 #include <nova/pragma.h>
 #include <nova/types.h>
 
+#include <concepts>
+#include <type_traits>
+
 namespace Nova {
 	NOVA_BEGIN_ALLOW_ANONYMOUS_TYPES
 
@@ -32,4 +36,104 @@ namespace Nova {
 	using uVec2 = Vec2<u32>;
 
 	NOVA_END_ALLOW_ANONYMOUS_TYPES
+
+	template<typename T>
+	constexpr Vec2<T> operator+(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return {p_a.x + p_b.x, p_a.y + p_b.y};
+	}
+
+	template<typename T>
+	constexpr Vec2<T> operator-(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return {p_a.x - p_b.x, p_a.y - p_b.y};
+	}
+
+	template<typename T>
+	constexpr Vec2<T> operator-(const Vec2<T>& p_v) {
+		return {-p_v.x, -p_v.y};
+	}
+
+	template<typename T>
+	constexpr Vec2<T> operator*(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return {p_a.x * p_b.x, p_a.y * p_b.y};
+	}
+
+	template<typename T>
+	constexpr Vec2<T> operator*(const Vec2<T>& p_v, const std::type_identity_t<T> p_s) {
+		return {p_v.x * p_s, p_v.y * p_s};
+	}
+
+	template<typename T>
+	constexpr Vec2<T> operator*(const std::type_identity_t<T> p_s, const Vec2<T>& p_v) {
+		return p_v * p_s;
+	}
+
+	template<typename T>
+	constexpr Vec2<T> operator/(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return {p_a.x / p_b.x, p_a.y / p_b.y};
+	}
+
+	template<typename T>
+	constexpr Vec2<T> operator/(const Vec2<T>& p_v, const std::type_identity_t<T> p_s) {
+		return {p_v.x / p_s, p_v.y / p_s};
+	}
+
+	template<typename T>
+	constexpr Vec2<T>& operator+=(Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return p_a = p_a + p_b;
+	}
+
+	template<typename T>
+	constexpr Vec2<T>& operator-=(Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return p_a = p_a - p_b;
+	}
+
+	template<typename T>
+	constexpr Vec2<T>& operator*=(Vec2<T>& p_v, const std::type_identity_t<T> p_s) {
+		return p_v = p_v * p_s;
+	}
+
+	template<typename T>
+	constexpr Vec2<T>& operator/=(Vec2<T>& p_v, const std::type_identity_t<T> p_s) {
+		return p_v = p_v / p_s;
+	}
+
+	template<typename T>
+	constexpr bool operator==(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return p_a.x == p_b.x && p_a.y == p_b.y;
+	}
+
+	template<typename T>
+	constexpr T dot(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return p_a.x * p_b.x + p_a.y * p_b.y;
+	}
+
+	template<typename T>
+	constexpr T length_squared(const Vec2<T>& p_v) {
+		return dot(p_v, p_v);
+	}
+
+	template<std::floating_point T>
+	constexpr T length(const Vec2<T>& p_v) {
+		return Math::sqrt(length_squared(p_v));
+	}
+
+	template<std::floating_point T>
+	constexpr Vec2<T> normalize(const Vec2<T>& p_v) {
+		return p_v / length(p_v);
+	}
+
+	template<typename T>
+	constexpr Vec2<T> min(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return {p_a.x < p_b.x ? p_a.x : p_b.x, p_a.y < p_b.y ? p_a.y : p_b.y};
+	}
+
+	template<typename T>
+	constexpr Vec2<T> max(const Vec2<T>& p_a, const Vec2<T>& p_b) {
+		return {p_a.x > p_b.x ? p_a.x : p_b.x, p_a.y > p_b.y ? p_a.y : p_b.y};
+	}
+
+	template<std::floating_point T>
+	constexpr Vec2<T> lerp(const Vec2<T>& p_a, const Vec2<T>& p_b, const std::type_identity_t<T> p_t) {
+		return p_a + (p_b - p_a) * p_t;
+	}
 } // namespace Nova
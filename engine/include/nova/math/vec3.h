@@ -6,9 +6,14 @@
 
 #pragma once
 
+#include <nova/math/common.h>
+#include <nova/math/simd.h>
 #include <nova/pragma.h>
 #include <nova/types.h>
 
+#include <concepts>
+#include <type_traits>
+
 namespace Nova {
 	NOVA_BEGIN_ALLOW_ANONYMOUS_TYPES
 
@@ -29,4 +34,258 @@ namespace Nova {
 	using uVec3 = Vec3<u32>;
 
 	NOVA_END_ALLOW_ANONYMOUS_TYPES
+
+	template<typename T>
+	constexpr Vec3<T> operator+(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return {p_a.x + p_b.x, p_a.y + p_b.y, p_a.z + p_b.z};
+	}
+
+	template<typename T>
+	constexpr Vec3<T> operator-(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return {p_a.x - p_b.x, p_a.y - p_b.y, p_a.z - p_b.z};
+	}
+
+	template<typename T>
+	constexpr Vec3<T> operator-(const Vec3<T>& p_v) {
+		return {-p_v.x, -p_v.y, -p_v.z};
+	}
+
+	template<typename T>
+	constexpr Vec3<T> operator*(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return {p_a.x * p_b.x, p_a.y * p_b.y, p_a.z * p_b.z};
+	}
+
+	template<typename T>
+	constexpr Vec3<T> operator*(const Vec3<T>& p_v, const std::type_identity_t<T> p_s) {
+		return {p_v.x * p_s, p_v.y * p_s, p_v.z * p_s};
+	}
+
+	template<typename T>
+	constexpr Vec3<T> operator*(const std::type_identity_t<T> p_s, const Vec3<T>& p_v) {
+		return p_v * p_s;
+	}
+
+	template<typename T>
+	constexpr Vec3<T> operator/(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return {p_a.x / p_b.x, p_a.y / p_b.y, p_a.z / p_b.z};
+	}
+
+	template<typename T>
+	constexpr Vec3<T> operator/(const Vec3<T>& p_v, const std::type_identity_t<T> p_s) {
+		return {p_v.x / p_s, p_v.y / p_s, p_v.z / p_s};
+	}
+
+	template<typename T>
+	constexpr Vec3<T>& operator+=(Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return p_a = p_a + p_b;
+	}
+
+	template<typename T>
+	constexpr Vec3<T>& operator-=(Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return p_a = p_a - p_b;
+	}
+
+	template<typename T>
+	constexpr Vec3<T>& operator*=(Vec3<T>& p_v, const std::type_identity_t<T> p_s) {
+		return p_v = p_v * p_s;
+	}
+
+	template<typename T>
+	constexpr Vec3<T>& operator/=(Vec3<T>& p_v, const std::type_identity_t<T> p_s) {
+		return p_v = p_v / p_s;
+	}
+
+	template<typename T>
+	constexpr bool operator==(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return p_a.x == p_b.x && p_a.y == p_b.y && p_a.z == p_b.z;
+	}
+
+	template<typename T>
+	constexpr T dot(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return p_a.x * p_b.x + p_a.y * p_b.y + p_a.z * p_b.z;
+	}
+
+	template<typename T>
+	constexpr Vec3<T> cross(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return {p_a.y * p_b.z - p_a.z * p_b.y, p_a.z * p_b.x - p_a.x * p_b.z, p_a.x * p_b.y - p_a.y * p_b.x};
+	}
+
+	template<typename T>
+	constexpr T length_squared(const Vec3<T>& p_v) {
+		return dot(p_v, p_v);
+	}
+
+	template<std::floating_point T>
+	constexpr T length(const Vec3<T>& p_v) {
+		return Math::sqrt(length_squared(p_v));
+	}
+
+	template<std::floating_point T>
+	constexpr Vec3<T> normalize(const Vec3<T>& p_v) {
+		return p_v / length(p_v);
+	}
+
+	template<typename T>
+	constexpr Vec3<T> min(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return {p_a.x < p_b.x ? p_a.x : p_b.x, p_a.y < p_b.y ? p_a.y : p_b.y, p_a.z < p_b.z ? p_a.z : p_b.z};
+	}
+
+	template<typename T>
+	constexpr Vec3<T> max(const Vec3<T>& p_a, const Vec3<T>& p_b) {
+		return {p_a.x > p_b.x ? p_a.x : p_b.x, p_a.y > p_b.y ? p_a.y : p_b.y, p_a.z > p_b.z ? p_a.z : p_b.z};
+	}
+
+	template<std::floating_point T>
+	constexpr Vec3<T> lerp(const Vec3<T>& p_a, const Vec3<T>& p_b, const std::type_identity_t<T> p_t) {
+		return p_a + (p_b - p_a) * p_t;
+	}
+
+	/**
+	 * @brief Vec3<f32> padded to 16 bytes so it loads as one SIMD register.
+	 *
+	 * Use it for CPU side math, Vec3 stays tightly packed for vertex data. The padding lane starts at zero and the
+	 * operations below keep it that way.
+	 */
+	struct alignas(16) Vec3A {
+		f32 x = 0.0f;
+		f32 y = 0.0f;
+		f32 z = 0.0f;
+		f32 padding = 0.0f;
+
+		constexpr Vec3A() = default;
+		constexpr Vec3A(const f32 p_x, const f32 p_y, const f32 p_z) : x(p_x), y(p_y), z(p_z) {}
+		constexpr explicit Vec3A(const Vec3<f32>& p_v) : x(p_v.x), y(p_v.y), z(p_v.z) {}
+
+		constexpr Vec3<f32> to_vec3() const {
+			return {x, y, z};
+		}
+	};
+
+	namespace Simd {
+		inline f32x4 load(const Vec3A& p_v) {
+			return load(&p_v.x);
+		}
+
+		inline Vec3A to_vec3a(const f32x4 p_v) {
+			Vec3A result;
+			store(&result.x, p_v);
+			return result;
+		}
+	} // namespace Simd
+
+	constexpr Vec3A operator+(const Vec3A& p_a, const Vec3A& p_b) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::add(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return {p_a.x + p_b.x, p_a.y + p_b.y, p_a.z + p_b.z};
+	}
+
+	constexpr Vec3A operator-(const Vec3A& p_a, const Vec3A& p_b) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::sub(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return {p_a.x - p_b.x, p_a.y - p_b.y, p_a.z - p_b.z};
+	}
+
+	constexpr Vec3A operator-(const Vec3A& p_v) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::sub(Simd::splat(0.0f), Simd::load(p_v)));
+		}
+		return {-p_v.x, -p_v.y, -p_v.z};
+	}
+
+	constexpr Vec3A operator*(const Vec3A& p_a, const Vec3A& p_b) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::mul(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return {p_a.x * p_b.x, p_a.y * p_b.y, p_a.z * p_b.z};
+	}
+
+	constexpr Vec3A operator*(const Vec3A& p_v, const f32 p_s) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::mul(Simd::load(p_v), Simd::splat(p_s)));
+		}
+		return {p_v.x * p_s, p_v.y * p_s, p_v.z * p_s};
+	}
+
+	constexpr Vec3A operator*(const f32 p_s, const Vec3A& p_v) {
+		return p_v * p_s;
+	}
+
+	/// There is no component-wise division, the padding lane would become 0/0
+	constexpr Vec3A operator/(const Vec3A& p_v, const f32 p_s) {
+		return p_v * (1.0f / p_s);
+	}
+
+	constexpr Vec3A& operator+=(Vec3A& p_a, const Vec3A& p_b) {
+		return p_a = p_a + p_b;
+	}
+
+	constexpr Vec3A& operator-=(Vec3A& p_a, const Vec3A& p_b) {
+		return p_a = p_a - p_b;
+	}
+
+	constexpr Vec3A& operator*=(Vec3A& p_v, const f32 p_s) {
+		return p_v = p_v * p_s;
+	}
+
+	constexpr Vec3A& operator/=(Vec3A& p_v, const f32 p_s) {
+		return p_v = p_v / p_s;
+	}
+
+	constexpr bool operator==(const Vec3A& p_a, const Vec3A& p_b) {
+		return p_a.x == p_b.x && p_a.y == p_b.y && p_a.z == p_b.z;
+	}
+
+	constexpr f32 dot(const Vec3A& p_a, const Vec3A& p_b) {
+		if !consteval {
+			return Simd::get_x(Simd::dot3(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return p_a.x * p_b.x + p_a.y * p_b.y + p_a.z * p_b.z;
+	}
+
+	constexpr Vec3A cross(const Vec3A& p_a, const Vec3A& p_b) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::cross3(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return Vec3A(cross(p_a.to_vec3(), p_b.to_vec3()));
+	}
+
+	constexpr f32 length_squared(const Vec3A& p_v) {
+		return dot(p_v, p_v);
+	}
+
+	constexpr f32 length(const Vec3A& p_v) {
+		return Math::sqrt(length_squared(p_v));
+	}
+
+	constexpr Vec3A normalize(const Vec3A& p_v) {
+		if !consteval {
+			const Simd::f32x4 v = Simd::load(p_v);
+			return Simd::to_vec3a(Simd::div(v, Simd::sqrt(Simd::dot3(v, v))));
+		}
+		return p_v / length(p_v);
+	}
+
+	constexpr Vec3A min(const Vec3A& p_a, const Vec3A& p_b) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::min(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return Vec3A(min(p_a.to_vec3(), p_b.to_vec3()));
+	}
+
+	constexpr Vec3A max(const Vec3A& p_a, const Vec3A& p_b) {
+		if !consteval {
+			return Simd::to_vec3a(Simd::max(Simd::load(p_a), Simd::load(p_b)));
+		}
+		return Vec3A(max(p_a.to_vec3(), p_b.to_vec3()));
+	}
+
+	constexpr Vec3A lerp(const Vec3A& p_a, const Vec3A& p_b, const f32 p_t) {
+		if !consteval {
+			const Simd::f32x4 a = Simd::load(p_a);
+			return Simd::to_vec3a(Simd::madd(Simd::sub(Simd::load(p_b), a), Simd::splat(p_t), a));
+		}
+		return p_a + (p_b - p_a) * p_t;
+	}
 } // namespace Nova
@@ -6,14 +6,20 @@
 
 #pragma once
 
+#include <nova/math/common.h>
+#include <nova/math/simd.h>
 #include <nova/pragma.h>
 #include <nova/types.h>
 
+#include <concepts>
+#include <type_traits>
+
 namespace Nova {
 	NOVA_BEGIN_ALLOW_ANONYMOUS_TYPES
 
+	/// Aligned like a GLSL vec4, so Vec4<f32> loads as one SIMD register and matches std140/std430 layouts
 	template<typename T = f32>
-	struct Vec4 {
+	struct alignas(sizeof(T) * 4) Vec4 {
 		union {
 			struct {
 				T x, y, z, w;
@@ -29,4 +35,176 @@ namespace Nova {
 	using uVec4 = Vec4<u32>;
 
 	NOVA_END_ALLOW_ANONYMOUS_TYPES
+
+	namespace Simd {
+		inline f32x4 load(const Vec4<f32>& p_v) {
+			return load(p_v.data);
+		}
+
+		inline Vec4<f32> to_vec4(const f32x4 p_v) {
+			Vec4<f32> result;
+			store(result.data, p_v);
+			return result;
+		}
+	} // namespace Simd
+
+	template<typename T>
+	constexpr Vec4<T> operator+(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::add(Simd::load(p_a), Simd::load(p_b)));
+			}
+		}
+		return {p_a.x + p_b.x, p_a.y + p_b.y, p_a.z + p_b.z, p_a.w + p_b.w};
+	}
+
+	template<typename T>
+	constexpr Vec4<T> operator-(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::sub(Simd::load(p_a), Simd::load(p_b)));
+			}
+		}
+		return {p_a.x - p_b.x, p_a.y - p_b.y, p_a.z - p_b.z, p_a.w - p_b.w};
+	}
+
+	template<typename T>
+	constexpr Vec4<T> operator-(const Vec4<T>& p_v) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::negate(Simd::load(p_v)));
+			}
+		}
+		return {-p_v.x, -p_v.y, -p_v.z, -p_v.w};
+	}
+
+	template<typename T>
+	constexpr Vec4<T> operator*(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::mul(Simd::load(p_a), Simd::load(p_b)));
+			}
+		}
+		return {p_a.x * p_b.x, p_a.y * p_b.y, p_a.z * p_b.z, p_a.w * p_b.w};
+	}
+
+	template<typename T>
+	constexpr Vec4<T> operator*(const Vec4<T>& p_v, const std::type_identity_t<T> p_s) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::mul(Simd::load(p_v), Simd::splat(p_s)));
+			}
+		}
+		return {p_v.x * p_s, p_v.y * p_s, p_v.z * p_s, p_v.w * p_s};
+	}
+
+	template<typename T>
+	constexpr Vec4<T> operator*(const std::type_identity_t<T> p_s, const Vec4<T>& p_v) {
+		return p_v * p_s;
+	}
+
+	template<typename T>
+	constexpr Vec4<T> operator/(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::div(Simd::load(p_a), Simd::load(p_b)));
+			}
+		}
+		return {p_a.x / p_b.x, p_a.y / p_b.y, p_a.z / p_b.z, p_a.w / p_b.w};
+	}
+
+	template<typename T>
+	constexpr Vec4<T> operator/(const Vec4<T>& p_v, const std::type_identity_t<T> p_s) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::div(Simd::load(p_v), Simd::splat(p_s)));
+			}
+		}
+		return {p_v.x / p_s, p_v.y / p_s, p_v.z / p_s, p_v.w / p_s};
+	}
+
+	template<typename T>
+	constexpr Vec4<T>& operator+=(Vec4<T>& p_a, const Vec4<T>& p_b) {
+		return p_a = p_a + p_b;
+	}
+
+	template<typename T>
+	constexpr Vec4<T>& operator-=(Vec4<T>& p_a, const Vec4<T>& p_b) {
+		return p_a = p_a - p_b;
+	}
+
+	template<typename T>
+	constexpr Vec4<T>& operator*=(Vec4<T>& p_v, const std::type_identity_t<T> p_s) {
+		return p_v = p_v * p_s;
+	}
+
+	template<typename T>
+	constexpr Vec4<T>& operator/=(Vec4<T>& p_v, const std::type_identity_t<T> p_s) {
+		return p_v = p_v / p_s;
+	}
+
+	template<typename T>
+	constexpr bool operator==(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		return p_a.x == p_b.x && p_a.y == p_b.y && p_a.z == p_b.z && p_a.w == p_b.w;
+	}
+
+	template<typename T>
+	constexpr T dot(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::get_x(Simd::dot4(Simd::load(p_a), Simd::load(p_b)));
+			}
+		}
+		return p_a.x * p_b.x + p_a.y * p_b.y + p_a.z * p_b.z + p_a.w * p_b.w;
+	}
+
+	template<typename T>
+	constexpr T length_squared(const Vec4<T>& p_v) {
+		return dot(p_v, p_v);
+	}
+
+	template<std::floating_point T>
+	constexpr T length(const Vec4<T>& p_v) {
+		return Math::sqrt(length_squared(p_v));
+	}
+
+	template<std::floating_point T>
+	constexpr Vec4<T> normalize(const Vec4<T>& p_v) {
+		return p_v / length(p_v);
+	}
+
+	template<typename T>
+	constexpr Vec4<T> min(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::min(Simd::load(p_a), Simd::load(p_b)));
+			}
+		}
+		return {
+			p_a.x < p_b.x ? p_a.x : p_b.x,
+			p_a.y < p_b.y ? p_a.y : p_b.y,
+			p_a.z < p_b.z ? p_a.z : p_b.z,
+			p_a.w < p_b.w ? p_a.w : p_b.w,
+		};
+	}
+
+	template<typename T>
+	constexpr Vec4<T> max(const Vec4<T>& p_a, const Vec4<T>& p_b) {
+		if constexpr (std::is_same_v<T, f32>) {
+			if !consteval {
+				return Simd::to_vec4(Simd::max(Simd::load(p_a), Simd::load(p_b)));
+			}
+		}
+		return {
+			p_a.x > p_b.x ? p_a.x : p_b.x,
+			p_a.y > p_b.y ? p_a.y : p_b.y,
+			p_a.z > p_b.z ? p_a.z : p_b.z,
+			p_a.w > p_b.w ? p_a.w : p_b.w,
+		};
+	}
+
+	template<std::floating_point T>
+	constexpr Vec4<T> lerp(const Vec4<T>& p_a, const Vec4<T>& p_b, const std::type_identity_t<T> p_t) {
+		return p_a + (p_b - p_a) * p_t;
+	}
 } // namespace Nova
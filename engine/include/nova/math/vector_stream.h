@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/math/bounds.h>
+#include <nova/math/mat4.h>
+#include <nova/math/vec3.h>
+#include <nova/math/vec4.h>
+#include <nova/types.h>
+
+#include <span>
+#include <type_traits>
+
+namespace Nova {
+	/**
+	 * @brief Structure of arrays view over three component vectors, one array per component.
+	 *
+	 * Every array holds at least count values. The arrays do not need any alignment, but 32 byte aligned arrays keep
+	 * the wide kernels from splitting cache lines.
+	 */
+	template<typename T>
+	struct BasicVec3Stream {
+		T* x = nullptr;
+		T* y = nullptr;
+		T* z = nullptr;
+		usize count = 0;
+
+		constexpr operator BasicVec3Stream<const T>() const
+			requires(!std::is_const_v<T>)
+		{
+			return {x, y, z, count};
+		}
+	};
+
+	/// Structure of arrays view over four component vectors, see BasicVec3Stream
+	template<typename T>
+	struct BasicVec4Stream {
+		T* x = nullptr;
+		T* y = nullptr;
+		T* z = nullptr;
+		T* w = nullptr;
+		usize count = 0;
+
+		constexpr operator BasicVec4Stream<const T>() const
+			requires(!std::is_const_v<T>)
+		{
+			return {x, y, z, w, count};
+		}
+	};
+
+	using Vec3Stream = BasicVec3Stream<f32>;
+	using ConstVec3Stream = BasicVec3Stream<const f32>;
+	using Vec4Stream = BasicVec4Stream<f32>;
+	using ConstVec4Stream = BasicVec4Stream<const f32>;
+
+	// The kernels below pick the widest instruction set the CPU supports at runtime. dst must hold at least as many
+	// vectors as src and may be the same arrays. Fused multiply-adds on wider instruction sets can change the last bit.
+
+	NOVA_API void aos_to_soa(std::span<const Vec3<f32>> src, Vec3Stream dst);
+	NOVA_API void aos_to_soa(std::span<const Vec4<f32>> src, Vec4Stream dst);
+	NOVA_API void soa_to_aos(ConstVec3Stream src, std::span<Vec3<f32>> dst);
+	NOVA_API void soa_to_aos(ConstVec4Stream src, std::span<Vec4<f32>> dst);
+
+	/// Transforms positions, assumes an affine matrix so there is no divide by w
+	NOVA_API void transform_points(const Mat4& matrix, ConstVec3Stream src, Vec3Stream dst);
+
+	/// Transforms directions, ignoring translation
+	NOVA_API void transform_vectors(const Mat4& matrix, ConstVec3Stream src, Vec3Stream dst);
+
+	NOVA_API void transform(const Mat4& matrix, ConstVec4Stream src, Vec4Stream dst);
+
+	/// Transforms positions to clip space and divides by w, points on the camera plane become infinite
+	NOVA_API void project_points(const Mat4& matrix, ConstVec3Stream src, Vec3Stream dst);
+
+	/// Zero length vectors become NaN, like normalize() on a single vector
+	NOVA_API void normalize(ConstVec3Stream src, Vec3Stream dst);
+
+	/// NaN components are skipped, an empty stream gives AABB::empty()
+	NOVA_API AABB compute_bounds(ConstVec3Stream src);
+} // namespace Nova
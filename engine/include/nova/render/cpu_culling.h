@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/math/frustum.h>
+#include <nova/math/vector_stream.h>
+#include <nova/types.h>
+
+#include <span>
+
+namespace Nova {
+	/// Frusta tested in one pass, each gets a bit of the visibility masks
+	static constexpr u32 MAX_CULL_FRUSTA = 32;
+
+	/**
+	 * @brief Culls bounding spheres, stored as xyz center and w radius, against one or more frusta.
+	 *
+	 * Writes the index of every sphere in [first, first + count) that intersects at least one frustum to visible, in
+	 * ascending order, and returns how many were written. visible must hold count indices. When masks is not empty it
+	 * must hold count values too, and masks[i] gets bit f set when frusta[f] intersects sphere visible[i], so shadow
+	 * cascades can share one pass.
+	 *
+	 * Disjoint ranges can be culled on separate threads into separate outputs. Like Frustum::intersects() the test
+	 * is conservative, and NaN bounds are culled.
+	 */
+	NOVA_API u32 cull_spheres(
+		std::span<const Frustum> frusta,
+		ConstVec4Stream spheres,
+		u32 first,
+		u32 count,
+		std::span<u32> visible,
+		std::span<u32> masks = {}
+	);
+
+	/// Culls boxes given by their min and max corners, see cull_spheres()
+	NOVA_API u32 cull_aabbs(
+		std::span<const Frustum> frusta,
+		ConstVec3Stream min,
+		ConstVec3Stream max,
+		u32 first,
+		u32 count,
+		std::span<u32> visible,
+		std::span<u32> masks = {}
+	);
+
+	inline u32 cull_spheres(const Frustum& frustum, ConstVec4Stream spheres, std::span<u32> visible) {
+		return cull_spheres({&frustum, 1}, spheres, 0, static_cast<u32>(spheres.count), visible);
+	}
+
+	inline u32 cull_aabbs(const Frustum& frustum, ConstVec3Stream min, ConstVec3Stream max, std::span<u32> visible) {
+		return cull_aabbs({&frustum, 1}, min, max, 0, static_cast<u32>(min.count), visible);
+	}
+} // namespace Nova
@@ -6,6 +6,11 @@
 
 #pragma once
 
+#include <nova/types.h>
+
+#include <iterator>
+#include <string_view>
+
 namespace Nova {
 	enum class DataFormat {
 		UNDEFINED,
@@ -227,5 +232,300 @@ namespace Nova {
 		G16_B16_R16_3PLANE_422_UNORM,
 		G16_B16R16_2PLANE_422_UNORM,
 		G16_B16_R16_3PLANE_444_UNORM,
+		MAX
+	};
+
+	/// How the bits of a channel are interpreted, sRGB formats are UNORM with FormatFlags::SRGB
+	enum class FormatType : u8 { NONE, UNORM, SNORM, USCALED, SSCALED, UINT, SINT, UFLOAT, SFLOAT };
+
+	enum class FormatFlags : u8 {
+		NONE = 0,
+		SRGB = 1 << 0,
+		DEPTH = 1 << 1,
+		STENCIL = 1 << 2,
+		COMPRESSED = 1 << 3,
+		PACKED = 1 << 4,
+		PLANAR = 1 << 5,
+	};
+
+	constexpr FormatFlags operator|(const FormatFlags p_a, const FormatFlags p_b) {
+		return static_cast<FormatFlags>(static_cast<u8>(p_a) | static_cast<u8>(p_b));
+	}
+	constexpr FormatFlags operator&(const FormatFlags p_a, const FormatFlags p_b) {
+		return static_cast<FormatFlags>(static_cast<u8>(p_a) & static_cast<u8>(p_b));
+	}
+
+	struct DataFormatInfo {
+		/// Channels in memory order, or from the most significant bits down for PACKED formats
+		std::string_view channels;
+
+		/// Texels covered by one block, 4x4 for block compressed formats and 2x1 for 4:2:2 formats
+		u8 block_width = 0;
+		u8 block_height = 0;
+
+		/// Bytes per block, zero for PLANAR formats whose planes are sized separately
+		u8 block_size = 0;
+
+		u8 channel_count = 0;
+		FormatType type = FormatType::NONE;
+		FormatFlags flags = FormatFlags::NONE;
+
+		constexpr bool has(const FormatFlags p_flags) const {
+			return (flags & p_flags) == p_flags;
+		}
+		constexpr bool is_srgb() const {
+			return has(FormatFlags::SRGB);
+		}
+		constexpr bool is_depth_stencil() const {
+			return (flags & (FormatFlags::DEPTH | FormatFlags::STENCIL)) != FormatFlags::NONE;
+		}
+		constexpr bool is_compressed() const {
+			return has(FormatFlags::COMPRESSED);
+		}
+
+		/// Bytes of a tightly packed image, zero for PLANAR formats
+		constexpr u64 get_size(const u32 p_width, const u32 p_height) const {
+			if (block_width == 0 || block_height == 0) {
+				return 0;
+			}
+			const u64 blocks_x = (static_cast<u64>(p_width) + block_width - 1) / block_width;
+			const u64 blocks_y = (static_cast<u64>(p_height) + block_height - 1) / block_height;
+			return blocks_x * blocks_y * block_size;
+		}
 	};
+
+	// Indexed by Nova::DataFormat
+	inline constexpr DataFormatInfo DATA_FORMAT_INFO[] = {
+		{"", 0, 0, 0, 0, FormatType::NONE, FormatFlags::NONE},
+		{"RG", 1, 1, 1, 2, FormatType::UNORM, FormatFlags::PACKED},
+		{"RGBA", 1, 1, 2, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"BGRA", 1, 1, 2, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"RGB", 1, 1, 2, 3, FormatType::UNORM, FormatFlags::PACKED},
+		{"BGR", 1, 1, 2, 3, FormatType::UNORM, FormatFlags::PACKED},
+		{"RGBA", 1, 1, 2, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"BGRA", 1, 1, 2, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"ARGB", 1, 1, 2, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"R", 1, 1, 1, 1, FormatType::UNORM, FormatFlags::NONE},
+		{"R", 1, 1, 1, 1, FormatType::SNORM, FormatFlags::NONE},
+		{"R", 1, 1, 1, 1, FormatType::USCALED, FormatFlags::NONE},
+		{"R", 1, 1, 1, 1, FormatType::SSCALED, FormatFlags::NONE},
+		{"R", 1, 1, 1, 1, FormatType::UINT, FormatFlags::NONE},
+		{"R", 1, 1, 1, 1, FormatType::SINT, FormatFlags::NONE},
+		{"R", 1, 1, 1, 1, FormatType::UNORM, FormatFlags::SRGB},
+		{"RG", 1, 1, 2, 2, FormatType::UNORM, FormatFlags::NONE},
+		{"RG", 1, 1, 2, 2, FormatType::SNORM, FormatFlags::NONE},
+		{"RG", 1, 1, 2, 2, FormatType::USCALED, FormatFlags::NONE},
+		{"RG", 1, 1, 2, 2, FormatType::SSCALED, FormatFlags::NONE},
+		{"RG", 1, 1, 2, 2, FormatType::UINT, FormatFlags::NONE},
+		{"RG", 1, 1, 2, 2, FormatType::SINT, FormatFlags::NONE},
+		{"RG", 1, 1, 2, 2, FormatType::UNORM, FormatFlags::SRGB},
+		{"RGB", 1, 1, 3, 3, FormatType::UNORM, FormatFlags::NONE},
+		{"RGB", 1, 1, 3, 3, FormatType::SNORM, FormatFlags::NONE},
+		{"RGB", 1, 1, 3, 3, FormatType::USCALED, FormatFlags::NONE},
+		{"RGB", 1, 1, 3, 3, FormatType::SSCALED, FormatFlags::NONE},
+		{"RGB", 1, 1, 3, 3, FormatType::UINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 3, 3, FormatType::SINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 3, 3, FormatType::UNORM, FormatFlags::SRGB},
+		{"BGR", 1, 1, 3, 3, FormatType::UNORM, FormatFlags::NONE},
+		{"BGR", 1, 1, 3, 3, FormatType::SNORM, FormatFlags::NONE},
+		{"BGR", 1, 1, 3, 3, FormatType::USCALED, FormatFlags::NONE},
+		{"BGR", 1, 1, 3, 3, FormatType::SSCALED, FormatFlags::NONE},
+		{"BGR", 1, 1, 3, 3, FormatType::UINT, FormatFlags::NONE},
+		{"BGR", 1, 1, 3, 3, FormatType::SINT, FormatFlags::NONE},
+		{"BGR", 1, 1, 3, 3, FormatType::UNORM, FormatFlags::SRGB},
+		{"RGBA", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::NONE},
+		{"RGBA", 1, 1, 4, 4, FormatType::SNORM, FormatFlags::NONE},
+		{"RGBA", 1, 1, 4, 4, FormatType::USCALED, FormatFlags::NONE},
+		{"RGBA", 1, 1, 4, 4, FormatType::SSCALED, FormatFlags::NONE},
+		{"RGBA", 1, 1, 4, 4, FormatType::UINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 4, 4, FormatType::SINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::SRGB},
+		{"BGRA", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::NONE},
+		{"BGRA", 1, 1, 4, 4, FormatType::SNORM, FormatFlags::NONE},
+		{"BGRA", 1, 1, 4, 4, FormatType::USCALED, FormatFlags::NONE},
+		{"BGRA", 1, 1, 4, 4, FormatType::SSCALED, FormatFlags::NONE},
+		{"BGRA", 1, 1, 4, 4, FormatType::UINT, FormatFlags::NONE},
+		{"BGRA", 1, 1, 4, 4, FormatType::SINT, FormatFlags::NONE},
+		{"BGRA", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::SRGB},
+		{"ABGR", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::SNORM, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::USCALED, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::SSCALED, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::UINT, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::SINT, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::PACKED},
+		{"ARGB", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"ARGB", 1, 1, 4, 4, FormatType::SNORM, FormatFlags::PACKED},
+		{"ARGB", 1, 1, 4, 4, FormatType::USCALED, FormatFlags::PACKED},
+		{"ARGB", 1, 1, 4, 4, FormatType::SSCALED, FormatFlags::PACKED},
+		{"ARGB", 1, 1, 4, 4, FormatType::UINT, FormatFlags::PACKED},
+		{"ARGB", 1, 1, 4, 4, FormatType::SINT, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::SNORM, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::USCALED, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::SSCALED, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::UINT, FormatFlags::PACKED},
+		{"ABGR", 1, 1, 4, 4, FormatType::SINT, FormatFlags::PACKED},
+		{"R", 1, 1, 2, 1, FormatType::UNORM, FormatFlags::NONE},
+		{"R", 1, 1, 2, 1, FormatType::SNORM, FormatFlags::NONE},
+		{"R", 1, 1, 2, 1, FormatType::USCALED, FormatFlags::NONE},
+		{"R", 1, 1, 2, 1, FormatType::SSCALED, FormatFlags::NONE},
+		{"R", 1, 1, 2, 1, FormatType::UINT, FormatFlags::NONE},
+		{"R", 1, 1, 2, 1, FormatType::SINT, FormatFlags::NONE},
+		{"R", 1, 1, 2, 1, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RG", 1, 1, 4, 2, FormatType::UNORM, FormatFlags::NONE},
+		{"RG", 1, 1, 4, 2, FormatType::SNORM, FormatFlags::NONE},
+		{"RG", 1, 1, 4, 2, FormatType::USCALED, FormatFlags::NONE},
+		{"RG", 1, 1, 4, 2, FormatType::SSCALED, FormatFlags::NONE},
+		{"RG", 1, 1, 4, 2, FormatType::UINT, FormatFlags::NONE},
+		{"RG", 1, 1, 4, 2, FormatType::SINT, FormatFlags::NONE},
+		{"RG", 1, 1, 4, 2, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RGB", 1, 1, 6, 3, FormatType::UNORM, FormatFlags::NONE},
+		{"RGB", 1, 1, 6, 3, FormatType::SNORM, FormatFlags::NONE},
+		{"RGB", 1, 1, 6, 3, FormatType::USCALED, FormatFlags::NONE},
+		{"RGB", 1, 1, 6, 3, FormatType::SSCALED, FormatFlags::NONE},
+		{"RGB", 1, 1, 6, 3, FormatType::UINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 6, 3, FormatType::SINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 6, 3, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 8, 4, FormatType::UNORM, FormatFlags::NONE},
+		{"RGBA", 1, 1, 8, 4, FormatType::SNORM, FormatFlags::NONE},
+		{"RGBA", 1, 1, 8, 4, FormatType::USCALED, FormatFlags::NONE},
+		{"RGBA", 1, 1, 8, 4, FormatType::SSCALED, FormatFlags::NONE},
+		{"RGBA", 1, 1, 8, 4, FormatType::UINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 8, 4, FormatType::SINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 8, 4, FormatType::SFLOAT, FormatFlags::NONE},
+		{"R", 1, 1, 4, 1, FormatType::UINT, FormatFlags::NONE},
+		{"R", 1, 1, 4, 1, FormatType::SINT, FormatFlags::NONE},
+		{"R", 1, 1, 4, 1, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RG", 1, 1, 8, 2, FormatType::UINT, FormatFlags::NONE},
+		{"RG", 1, 1, 8, 2, FormatType::SINT, FormatFlags::NONE},
+		{"RG", 1, 1, 8, 2, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RGB", 1, 1, 12, 3, FormatType::UINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 12, 3, FormatType::SINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 12, 3, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 16, 4, FormatType::UINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 16, 4, FormatType::SINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 16, 4, FormatType::SFLOAT, FormatFlags::NONE},
+		{"R", 1, 1, 8, 1, FormatType::UINT, FormatFlags::NONE},
+		{"R", 1, 1, 8, 1, FormatType::SINT, FormatFlags::NONE},
+		{"R", 1, 1, 8, 1, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RG", 1, 1, 16, 2, FormatType::UINT, FormatFlags::NONE},
+		{"RG", 1, 1, 16, 2, FormatType::SINT, FormatFlags::NONE},
+		{"RG", 1, 1, 16, 2, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RGB", 1, 1, 24, 3, FormatType::UINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 24, 3, FormatType::SINT, FormatFlags::NONE},
+		{"RGB", 1, 1, 24, 3, FormatType::SFLOAT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 32, 4, FormatType::UINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 32, 4, FormatType::SINT, FormatFlags::NONE},
+		{"RGBA", 1, 1, 32, 4, FormatType::SFLOAT, FormatFlags::NONE},
+		{"BGR", 1, 1, 4, 3, FormatType::UFLOAT, FormatFlags::PACKED},
+		{"EBGR", 1, 1, 4, 4, FormatType::UFLOAT, FormatFlags::PACKED},
+		{"D", 1, 1, 2, 1, FormatType::UNORM, FormatFlags::DEPTH},
+		{"D", 1, 1, 4, 1, FormatType::UNORM, FormatFlags::DEPTH},
+		{"D", 1, 1, 4, 1, FormatType::SFLOAT, FormatFlags::DEPTH},
+		{"S", 1, 1, 1, 1, FormatType::UINT, FormatFlags::STENCIL},
+		{"DS", 1, 1, 3, 2, FormatType::UNORM, FormatFlags::DEPTH | FormatFlags::STENCIL},
+		{"DS", 1, 1, 4, 2, FormatType::UNORM, FormatFlags::DEPTH | FormatFlags::STENCIL},
+		{"DS", 1, 1, 5, 2, FormatType::SFLOAT, FormatFlags::DEPTH | FormatFlags::STENCIL},
+		{"RGB", 4, 4, 8, 3, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGB", 4, 4, 8, 3, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 8, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 8, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"R", 4, 4, 8, 1, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"R", 4, 4, 8, 1, FormatType::SNORM, FormatFlags::COMPRESSED},
+		{"RG", 4, 4, 16, 2, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RG", 4, 4, 16, 2, FormatType::SNORM, FormatFlags::COMPRESSED},
+		{"RGB", 4, 4, 16, 3, FormatType::UFLOAT, FormatFlags::COMPRESSED},
+		{"RGB", 4, 4, 16, 3, FormatType::SFLOAT, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGB", 4, 4, 8, 3, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGB", 4, 4, 8, 3, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 8, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 8, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"R", 4, 4, 8, 1, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"R", 4, 4, 8, 1, FormatType::SNORM, FormatFlags::COMPRESSED},
+		{"RG", 4, 4, 16, 2, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RG", 4, 4, 16, 2, FormatType::SNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 4, 4, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 5, 4, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 5, 4, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 5, 5, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 5, 5, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 6, 5, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 6, 5, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 6, 6, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 6, 6, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 8, 5, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 8, 5, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 8, 6, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 8, 6, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 8, 8, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 8, 8, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 10, 5, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 10, 5, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 10, 6, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 10, 6, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 10, 8, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 10, 8, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 10, 10, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 10, 10, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 12, 10, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 12, 10, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"RGBA", 12, 12, 16, 4, FormatType::UNORM, FormatFlags::COMPRESSED},
+		{"RGBA", 12, 12, 16, 4, FormatType::UNORM, FormatFlags::SRGB | FormatFlags::COMPRESSED},
+		{"GBGR", 2, 1, 4, 3, FormatType::UNORM, FormatFlags::NONE},
+		{"BGRG", 2, 1, 4, 3, FormatType::UNORM, FormatFlags::NONE},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"R", 1, 1, 2, 1, FormatType::UNORM, FormatFlags::PACKED},
+		{"RG", 1, 1, 4, 2, FormatType::UNORM, FormatFlags::PACKED},
+		{"RGBA", 1, 1, 8, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"GBGR", 2, 1, 8, 3, FormatType::UNORM, FormatFlags::PACKED},
+		{"BGRG", 2, 1, 8, 3, FormatType::UNORM, FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"R", 1, 1, 2, 1, FormatType::UNORM, FormatFlags::PACKED},
+		{"RG", 1, 1, 4, 2, FormatType::UNORM, FormatFlags::PACKED},
+		{"RGBA", 1, 1, 8, 4, FormatType::UNORM, FormatFlags::PACKED},
+		{"GBGR", 2, 1, 8, 3, FormatType::UNORM, FormatFlags::PACKED},
+		{"BGRG", 2, 1, 8, 3, FormatType::UNORM, FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR | FormatFlags::PACKED},
+		{"GBGR", 2, 1, 8, 3, FormatType::UNORM, FormatFlags::NONE},
+		{"BGRG", 2, 1, 8, 3, FormatType::UNORM, FormatFlags::NONE},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+		{"GBR", 1, 1, 0, 3, FormatType::UNORM, FormatFlags::PLANAR},
+	};
+
+	static_assert(std::size(DATA_FORMAT_INFO) == static_cast<usize>(DataFormat::MAX));
+
+	constexpr const DataFormatInfo& get_format_info(const DataFormat p_format) {
+		return DATA_FORMAT_INFO[static_cast<usize>(p_format)];
+	}
+
+	static_assert(get_format_info(DataFormat::R8G8B8A8_SRGB).is_srgb());
+	static_assert(get_format_info(DataFormat::R32G32B32A32_SFLOAT).block_size == 16);
+	static_assert(get_format_info(DataFormat::D32_SFLOAT_S8_UINT).is_depth_stencil());
+	static_assert(get_format_info(DataFormat::BC7_SRGB_BLOCK).get_size(4, 4) == 16);
+	static_assert(get_format_info(DataFormat::G16_B16_R16_3PLANE_444_UNORM).has(FormatFlags::PLANAR));
 } // namespace Nova
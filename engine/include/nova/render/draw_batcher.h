@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/render/render_driver.h>
+#include <nova/render/render_structs.h>
+#include <nova/types.h>
+
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace Nova {
+	/// Geometry shared by every instance of a batched draw
+	struct BatchMesh {
+		BufferID vertex_buffer = nullptr;
+		BufferID index_buffer = nullptr;
+		IndexType index_type = IndexType::UINT32;
+		u32 first_index = 0;
+		u32 index_count = 0;
+		i32 vertex_offset = 0;
+	};
+
+	struct BatchStats {
+		u32 submitted = 0;
+		u32 draws = 0;
+		u32 pipeline_binds = 0;
+		u32 material_binds = 0;
+		u32 dropped = 0;
+	};
+
+	/**
+	 * @brief Collects draw requests for a frame and records them as few instanced draws as possible.
+	 *
+	 * Requests sharing a pipeline, mesh and material become a single draw. Per-instance data is copied into a
+	 * persistently mapped instance buffer that pipelines read through a vertex binding with InputRate::INSTANCE.
+	 * Batches are recorded sorted by pipeline, then material, then mesh, so state changes are also minimal.
+	 */
+	class NOVA_API DrawBatcher {
+	  public:
+		/// Called whenever the material changes within a flush, e.g. to push its constants
+		using BindMaterial = std::function<void(CommandBufferID command_buffer, PipelineID pipeline, u32 material)>;
+
+		struct Params {
+			u32 instance_stride = 0;
+			u32 instance_binding = 1;
+			u32 max_instances = 65536;
+			u32 frames_in_flight = 2;
+			BindMaterial bind_material;
+		};
+
+		DrawBatcher(RenderDriver* driver, const Params& params);
+		~DrawBatcher();
+
+		DrawBatcher(const DrawBatcher&) = delete;
+		DrawBatcher& operator=(const DrawBatcher&) = delete;
+
+		u32 add_mesh(const BatchMesh& mesh);
+
+		/**
+		 * @brief Starts collecting a frame. The instance memory of this frame index must no longer be in use by the
+		 * GPU, which holds once the fence of the frame submitted frames_in_flight frames ago has been waited on.
+		 */
+		void begin_frame(u32 frame_index);
+
+		/// Queues one instance, data must be exactly instance_stride bytes
+		void submit(PipelineID pipeline, u32 mesh, u32 material, std::span<const u8> data);
+
+		template<typename T>
+		void submit(PipelineID pipeline, const u32 mesh, const u32 material, const T& data) {
+			submit(pipeline, mesh, material, {reinterpret_cast<const u8*>(&data), sizeof(T)});
+		}
+
+		/// Sorts and records every queued request inside the current render pass, may be called once per pass
+		void cmd_flush(CommandBufferID command_buffer);
+
+		const BatchStats& get_stats() const;
+
+	  private:
+		struct Request {
+			u64 key;
+			u32 data_offset;
+		};
+
+		RenderDriver* m_driver;
+		Params m_params;
+		BufferID m_instance_buffer = nullptr;
+		u8* m_instance_data = nullptr;
+		u32 m_frame_index = 0;
+		u32 m_frame_used = 0; // Instances already flushed this frame
+
+		std::vector<BatchMesh> m_meshes;
+		std::vector<PipelineID> m_pipelines;
+		std::vector<Request> m_requests;
+		std::vector<u8> m_staged;
+		BatchStats m_stats;
+
+		u32 _get_pipeline_index(PipelineID pipeline);
+	};
+} // namespace Nova
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/render/data_format.h>
+#include <nova/types.h>
+
+#include <span>
+
+namespace Nova {
+	/**
+	 * @brief Converts tightly packed texels between formats on the CPU. Returns false if the pair is unsupported.
+	 *
+	 * Supported pairs are a format to itself, RGBA8 to BGRA8 and back, R8 and RGB8 to RGBA8, sRGB RGBA8 to
+	 * R32G32B32A32_SFLOAT, and 32-bit float to 16-bit float with the same channels. Apart from the sRGB decode both
+	 * formats must share a type. dst must hold the converted texels.
+	 */
+	NOVA_API bool convert_texels(
+		DataFormat src_format,
+		std::span<const u8> src,
+		DataFormat dst_format,
+		std::span<u8> dst
+	);
+
+	// The kernels below pick the widest instruction set the CPU supports at runtime
+
+	/// Swaps the first and third bytes of every four, src and dst may be the same memory
+	NOVA_API void swizzle_rgba8_bgra8(std::span<const u8> src, std::span<u8> dst);
+
+	/// Replicates single channel texels into RGB with opaque alpha
+	NOVA_API void expand_r8_rgba8(std::span<const u8> src, std::span<u8> dst);
+
+	/// Adds opaque alpha to three channel texels
+	NOVA_API void expand_rgb8_rgba8(std::span<const u8> src, std::span<u8> dst);
+
+	/// Decodes sRGB RGBA8 texels to linear floats, alpha is already linear and is only normalized
+	NOVA_API void convert_srgba8_to_linear(std::span<const u8> src, std::span<f32> dst);
+
+	/// Rounds to the nearest half, out of range values become infinity
+	NOVA_API void convert_f32_to_f16(std::span<const f32> src, std::span<u16> dst);
+} // namespace Nova
@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/math/vec4.h>
+#include <nova/render/render_structs.h>
+#include <nova/types.h>
+
+#include <span>
+
+namespace Nova {
+	class RenderDriver;
+
+	/// Matches VkDrawIndexedIndirectCommand
+	struct DrawIndexedIndirectCommand {
+		u32 index_count;
+		u32 instance_count;
+		u32 first_index;
+		i32 vertex_offset;
+		u32 first_instance;
+	};
+
+	/**
+	 * @brief Per-object data read by the cull shader.
+	 *
+	 * The bounding sphere is stored as center (xyz) and radius (w). The object index is written to first_instance so
+	 * vertex shaders can fetch their own per-object data through the same storage buffer.
+	 */
+	struct GpuObject {
+		Vec4<f32> bounds;
+		u32 index_count;
+		u32 first_index;
+		i32 vertex_offset;
+		u32 padding;
+	};
+
+	/// Push constant block of engine/shaders/gpu_cull.comp
+	struct CullPushConstants {
+		u64 objects;
+		u64 draws;
+		u64 draw_count;
+		u32 object_count;
+		u32 padding;
+		Vec4<f32> planes[6];
+	};
+
+	static_assert(sizeof(DrawIndexedIndirectCommand) == 20);
+	static_assert(sizeof(GpuObject) == 32);
+	static_assert(sizeof(CullPushConstants) == 128, "Must fit the minimum guaranteed push constant size");
+
+	/**
+	 * @brief Culls objects against the view frustum on the GPU and draws the survivors with a single indirect call.
+	 *
+	 * Buffers are created on the driver's current device, which must have BUFFER_DEVICE_ADDRESS, DRAW_INDIRECT_COUNT
+	 * and DRAW_INDIRECT_FIRST_INSTANCE enabled. The cull shader is compiled by the caller from gpu_cull.comp.
+	 */
+	class NOVA_API GpuCuller {
+	  public:
+		GpuCuller(RenderDriver* driver, ShaderID cull_shader, u32 max_objects);
+		~GpuCuller();
+
+		GpuCuller(const GpuCuller&) = delete;
+		GpuCuller& operator=(const GpuCuller&) = delete;
+
+		/**
+		 * @brief Writes objects into the staging buffer, uploaded by the next cmd_cull().
+		 *
+		 * The staging buffer is shared between frames, so this must not be called while a previously recorded
+		 * cmd_cull() upload may still be executing.
+		 */
+		void set_objects(std::span<const GpuObject> objects, u32 first = 0);
+
+		/**
+		 * @brief Records the upload, culling dispatch and barriers. Must be recorded outside a render pass.
+		 *
+		 * Planes are in world space with normals pointing into the frustum, a point p is inside when
+		 * dot(plane.xyz, p) + plane.w >= 0.
+		 */
+		void cmd_cull(CommandBufferID command_buffer, u32 object_count, std::span<const Vec4<f32>, 6> planes);
+
+		/// Records the indirect draw, the caller binds the graphics pipeline and index buffer first
+		void cmd_draw(CommandBufferID command_buffer);
+
+		u32 get_max_objects() const;
+		BufferID get_object_buffer() const;
+
+	  private:
+		RenderDriver* m_driver;
+		PipelineID m_pipeline = nullptr;
+		u32 m_max_objects;
+		u32 m_object_count = 0;
+
+		BufferID m_objects = nullptr;
+		BufferID m_staging = nullptr;
+		BufferID m_draws = nullptr;
+		BufferID m_count = nullptr;
+		GpuObject* m_staging_data = nullptr;
+
+		u32 m_dirty_begin = 0;
+		u32 m_dirty_end = 0;
+	};
+} // namespace Nova
@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/render/meshlet.h>
+#include <nova/render/params/graphics_pipeline.h>
+#include <nova/types.h>
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace Nova {
+	struct MeshLod {
+		u32 first_index = 0;
+		u32 index_count = 0;
+		u32 first_meshlet = 0;
+		u32 meshlet_count = 0;
+		f32 error = 0.0f; // Relative to the mesh extent
+	};
+
+	/**
+	 * @brief Cooked mesh as written by nova-cooker.
+	 *
+	 * Vertices are interleaved in a single buffer described by bindings and attributes, which GraphicsPipelineParams
+	 * can reference directly. Every LOD indexes the same vertex buffer, LOD zero is the full detail mesh.
+	 */
+	struct NOVA_API MeshAsset {
+		std::vector<VertexBinding> bindings;
+		std::vector<VertexAttribute> attributes;
+		std::vector<u8> vertices;
+		u32 vertex_count = 0;
+
+		std::vector<u32> indices;
+		std::vector<MeshLod> lods;
+
+		/// Meshlets of every LOD, see MeshLod::first_meshlet
+		MeshletData meshlets;
+
+		static MeshAsset load(const std::filesystem::path& path);
+		static MeshAsset load(std::span<const u8> bytes);
+		void save(const std::filesystem::path& path) const;
+		std::vector<u8> serialize() const;
+	};
+} // namespace Nova
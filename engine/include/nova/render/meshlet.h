@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/math/vec3.h>
+#include <nova/math/vec4.h>
+#include <nova/render/render_driver.h>
+#include <nova/render/render_structs.h>
+#include <nova/types.h>
+
+#include <span>
+#include <vector>
+
+namespace Nova {
+	/// Must match the output limits declared in meshlet.mesh
+	static constexpr u32 MESHLET_MAX_VERTICES = 64;
+	static constexpr u32 MESHLET_MAX_TRIANGLES = 124;
+
+	struct Meshlet {
+		u32 vertex_offset; // Into MeshletData::vertices
+		u32 triangle_offset; // Byte offset into MeshletData::triangles
+		u32 vertex_count;
+		u32 triangle_count;
+	};
+
+	/**
+	 * @brief Culling data for one meshlet.
+	 *
+	 * A meshlet is entirely back facing from camera position c when
+	 * dot(normalize(cone_apex - c), cone_axis.xyz) >= cone_axis.w.
+	 */
+	struct MeshletBounds {
+		Vec4<f32> sphere; // Center xyz, radius w
+		Vec4<f32> cone_apex; // w is unused
+		Vec4<f32> cone_axis; // Cutoff w
+	};
+
+	struct NOVA_API MeshletData {
+		std::vector<Meshlet> meshlets;
+		std::vector<MeshletBounds> bounds;
+		std::vector<u32> vertices; // Indices into the source vertex buffer
+		std::vector<u8> triangles; // Three local vertex indices per triangle, each meshlet padded to 4 bytes
+
+		/**
+		 * @brief Splits an indexed triangle list into meshlets, keeping the triangle order.
+		 *
+		 * Feed it a vertex cache optimized index buffer for meshlets with good locality.
+		 */
+		static MeshletData build(
+			std::span<const u32> indices,
+			std::span<const Vec3<f32>> positions,
+			u32 max_vertices = MESHLET_MAX_VERTICES,
+			u32 max_triangles = MESHLET_MAX_TRIANGLES
+		);
+
+		/// Flattens the meshlets back into a triangle list for the vertex pipeline
+		std::vector<u32> get_indices() const;
+	};
+
+	/// Push constant block of engine/shaders/meshlet.task and meshlet.mesh
+	struct MeshletPushConstants {
+		u64 meshlets;
+		u64 bounds;
+		u64 vertices;
+		u64 triangles;
+		u64 positions;
+		u64 view;
+		u32 meshlet_count;
+		u32 position_stride; // In floats
+	};
+
+	/// Per-view data the mesh path reads through MeshletPushConstants::view
+	struct MeshletView {
+		Vec4<f32> view_projection[4]; // Column major
+		Vec4<f32> camera_position; // w is unused
+		Vec4<f32> planes[6]; // Normals point into the frustum
+	};
+
+	static_assert(sizeof(Meshlet) == 16);
+	static_assert(sizeof(MeshletBounds) == 48);
+	static_assert(sizeof(MeshletPushConstants) == 56);
+	static_assert(sizeof(MeshletView) == 176);
+
+	/**
+	 * @brief GPU copy of MeshletData, drawn with task and mesh shaders when the device supports them.
+	 *
+	 * Without RenderFeature::MESH_SHADER and BUFFER_DEVICE_ADDRESS only a flattened index buffer is uploaded and
+	 * cmd_draw() falls back to an indexed draw through the classic vertex pipeline.
+	 */
+	class NOVA_API MeshletMesh {
+	  public:
+		struct DrawParams {
+			BufferID positions = nullptr; // Needs SHADER_DEVICE_ADDRESS usage on the mesh path
+			u32 position_stride = 3; // In floats
+			BufferID view = nullptr; // Holds a MeshletView, needs SHADER_DEVICE_ADDRESS usage on the mesh path
+		};
+
+		MeshletMesh(RenderDriver* driver, const MeshletData& data);
+		~MeshletMesh();
+
+		MeshletMesh(const MeshletMesh&) = delete;
+		MeshletMesh& operator=(const MeshletMesh&) = delete;
+
+		bool uses_mesh_shaders() const;
+
+		/// Records the one-time upload, call release_staging() once it has finished executing
+		void cmd_upload(CommandBufferID command_buffer);
+		void release_staging();
+
+		/**
+		 * @brief Records the draw inside a render pass using the given pipeline.
+		 *
+		 * On the mesh path the pipeline must be built from meshlet.task and meshlet.mesh with
+		 * sizeof(MeshletPushConstants) of push constants. On the vertex path the caller binds its vertex buffers.
+		 */
+		void cmd_draw(CommandBufferID command_buffer, PipelineID pipeline, const DrawParams& params);
+
+	  private:
+		struct Upload {
+			BufferID buffer;
+			u64 staging_offset;
+			u64 size;
+		};
+
+		RenderDriver* m_driver;
+		bool m_mesh_shaders;
+		u32 m_meshlet_count;
+		u32 m_index_count;
+
+		BufferID m_meshlets = nullptr;
+		BufferID m_bounds = nullptr;
+		BufferID m_vertices = nullptr;
+		BufferID m_triangles = nullptr;
+		BufferID m_indices = nullptr;
+		BufferID m_staging = nullptr;
+		std::vector<Upload> m_uploads;
+
+		BufferID _create_buffer(std::span<const u8> data, BufferUsage usage, u8* staging, u64& staging_offset);
+	};
+} // namespace Nova
@@ -6,8 +6,16 @@
 
 #pragma once
 
+#include <nova/render/render_structs.h>
+#include <nova/types.h>
+
 namespace Nova {
 	struct ComputePipelineParams {
-		// TODO
+		ShaderID shader = nullptr;
+
+		/// Bytes of push constants visible to the shader, zero for none
+		u32 push_constant_size = 0;
+
+		// TODO: Descriptor set layouts
 	};
 } // namespace Nova
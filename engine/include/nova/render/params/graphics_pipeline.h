@@ -6,11 +6,12 @@
 
 #pragma once
 
+#include <nova/core/small_vector.h>
 #include <nova/render/data_format.h>
 #include <nova/render/render_structs.h>
 #include <nova/types.h>
 
-#include <vector>
+#include <span>
 
 namespace Nova {
 	enum class CullMode { NONE, FRONT, BACK };
@@ -32,29 +33,36 @@ namespace Nova {
 	};
 
 	struct GraphicsPipelineParams {
-		std::vector<ShaderID> shaders;
-		std::vector<VertexBinding> bindings;
-		std::vector<VertexAttribute> attributes;
+		/// One per stage, at most vertex, both tessellation stages, geometry and fragment
+		FixedVector<ShaderID, 5> shaders;
+
+		/// Not copied, see make_vertex_layout() for building these during compilation
+		std::span<const VertexBinding> bindings;
+		std::span<const VertexAttribute> attributes;
+
 		PrimitiveTopology topology = PrimitiveTopology::TRIANGLE_LIST;
 
 		// TODO: Tessellation state
 
-		bool enable_depth_clamp = false;
+		bool enable_depth_clamp = false; // Requires RenderFeature::DEPTH_CLAMP
 		bool discard_primitives = false;
-		bool wireframe = false;
+		bool wireframe = false; // Requires RenderFeature::FILL_MODE_NON_SOLID
 		CullMode cull_mode = CullMode::NONE;
 		FrontFace front_face = FrontFace::COUNTER_CLOCKWISE;
 		bool enable_depth_bias = false;
 		float depth_bias_constant = 0.0f;
 		float depth_bias_clamp = 0.0f;
 		float depth_bias_slope = 0.0f;
-		float line_width = 1.0f;
+		float line_width = 1.0f; // Anything but 1.0 requires RenderFeature::WIDE_LINES
 
 		// TODO: Multisample state
 		// TODO: Depth stencil state
 		// TODO: Color blend state
 		// TODO: Dynamic state
 
+		/// Bytes of push constants visible to every graphics stage, zero for none
+		u32 push_constant_size = 0;
+
 		RenderPassID render_pass = nullptr;
 		u32 subpass = 0;
 	};
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/render/data_format.h>
+#include <nova/types.h>
+
+namespace Nova {
+	enum class TextureUsage : u32 {
+		NONE = 0,
+		TRANSFER_SRC = 1 << 0,
+		TRANSFER_DST = 1 << 1,
+		SAMPLED = 1 << 2,
+		STORAGE = 1 << 3,
+		COLOR_ATTACHMENT = 1 << 4,
+		DEPTH_STENCIL_ATTACHMENT = 1 << 5,
+	};
+
+	constexpr TextureUsage operator|(const TextureUsage p_a, const TextureUsage p_b) {
+		return static_cast<TextureUsage>(static_cast<u32>(p_a) | static_cast<u32>(p_b));
+	}
+	constexpr TextureUsage operator&(const TextureUsage p_a, const TextureUsage p_b) {
+		return static_cast<TextureUsage>(static_cast<u32>(p_a) & static_cast<u32>(p_b));
+	}
+
+	struct TextureParams {
+		u32 width = 1;
+		u32 height = 1;
+
+		/// Zero allocates the full chain down to 1x1
+		u32 mip_levels = 1;
+
+		DataFormat format = DataFormat::R8G8B8A8_UNORM;
+		TextureUsage usage = TextureUsage::SAMPLED | TextureUsage::TRANSFER_DST;
+
+		// TODO: Array layers, 3D and cube textures, MSAA
+	};
+} // namespace Nova
@@ -10,16 +10,139 @@
 #include <nova/render/render_structs.h>
 #include <nova/types.h>
 
+#include <functional>
 #include <initializer_list>
 #include <span>
 #include <string>
+#include <vector>
 
 namespace Nova {
 	class RenderDriver;
+	struct RenderDevice;
 
 	enum class DeviceVendor { UNKNOWN = 0, INTEL = 0x8086, AMD = 0x1002, NVIDIA = 0x10de };
 	enum class DeviceType { OTHER = 0, INTEGRATED = 1, DISCRETE = 2, VIRTUAL = 3, CPU = 4 };
 
+	enum class RenderFeature {
+		MULTI_DRAW_INDIRECT,
+		DRAW_INDIRECT_FIRST_INSTANCE,
+		DRAW_INDIRECT_COUNT,
+		SAMPLER_ANISOTROPY,
+		TEXTURE_COMPRESSION_BC,
+		TEXTURE_COMPRESSION_ASTC,
+		SHADER_INT64,
+		SHADER_FLOAT16,
+		TIMELINE_SEMAPHORE,
+		DESCRIPTOR_INDEXING,
+		SYNCHRONIZATION_2,
+		BUFFER_DEVICE_ADDRESS,
+		DYNAMIC_RENDERING,
+		EXTENDED_DYNAMIC_STATE,
+		MEMORY_BUDGET,
+		MESH_SHADER,
+		FILL_MODE_NON_SOLID,
+		DEPTH_CLAMP,
+		WIDE_LINES,
+		MAX
+	};
+
+	struct NOVA_API RenderFeatureSet {
+		u64 bits = 0;
+
+		constexpr RenderFeatureSet() = default;
+		constexpr explicit RenderFeatureSet(const u64 p_bits) : bits(p_bits) {}
+		constexpr RenderFeatureSet(const std::initializer_list<RenderFeature> p_features) {
+			for (const RenderFeature feature : p_features) {
+				set(feature);
+			}
+		}
+
+		static constexpr RenderFeatureSet all() {
+			return RenderFeatureSet((u64(1) << static_cast<u32>(RenderFeature::MAX)) - 1);
+		}
+
+		constexpr bool has(const RenderFeature p_feature) const {
+			return bits & (u64(1) << static_cast<u32>(p_feature));
+		}
+		constexpr bool has_all(const RenderFeatureSet& p_other) const {
+			return (bits & p_other.bits) == p_other.bits;
+		}
+		constexpr void set(const RenderFeature p_feature, const bool p_enabled = true) {
+			const u64 mask = u64(1) << static_cast<u32>(p_feature);
+			bits = p_enabled ? (bits | mask) : (bits & ~mask);
+		}
+		u32 count() const;
+
+		constexpr RenderFeatureSet operator|(const RenderFeatureSet& p_other) const {
+			return RenderFeatureSet(bits | p_other.bits);
+		}
+		constexpr RenderFeatureSet operator&(const RenderFeatureSet& p_other) const {
+			return RenderFeatureSet(bits & p_other.bits);
+		}
+		constexpr RenderFeatureSet operator~() const {
+			return RenderFeatureSet(~bits) & all();
+		}
+		constexpr bool operator==(const RenderFeatureSet&) const = default;
+	};
+
+	static_assert(static_cast<u32>(RenderFeature::MAX) <= 64, "RenderFeatureSet holds at most 64 features");
+
+	struct DeviceLimits {
+		u32 max_image_dimension_2d = 0;
+		u32 max_framebuffer_width = 0;
+		u32 max_framebuffer_height = 0;
+		u32 max_push_constants_size = 0;
+		u32 max_bound_descriptor_sets = 0;
+		u32 max_storage_buffer_range = 0;
+		u32 max_compute_shared_memory_size = 0;
+		u32 max_compute_work_group_invocations = 0;
+		u32 max_draw_indirect_count = 0;
+		u32 max_memory_allocation_count = 0;
+		u32 max_mesh_output_vertices = 0;
+		u32 max_mesh_output_primitives = 0;
+		f32 max_sampler_anisotropy = 0.0f;
+		f32 timestamp_period = 0.0f;
+	};
+
+	struct DeviceMemoryHeap {
+		u64 size = 0;
+		bool device_local = false;
+	};
+
+	struct DeviceQueueFamily {
+		u32 queue_count = 0;
+		bool graphics = false;
+		bool compute = false;
+		bool transfer = false;
+	};
+
+	/**
+	 * @brief A single weighted criterion for RenderDevice::choose_device().
+	 *
+	 * The function returns a raw, non-negative metric. Metrics are normalized against the best candidate before the
+	 * weight is applied, so scorers do not need to agree on units.
+	 */
+	struct DeviceScorer {
+		std::string name;
+		f32 weight = 1.0f;
+		std::function<f64(const RenderDevice&)> score;
+	};
+
+	struct NOVA_API DeviceScoring {
+		std::vector<DeviceScorer> scorers;
+
+		/// Compared before any scorer, only the devices in the highest tier are scored. Unset puts all in one tier
+		std::function<u32(const RenderDevice&)> tier;
+
+		/// Devices missing any of these are never chosen
+		RenderFeatureSet required_features;
+
+		/// Weight of RenderDriver::probe_device(), zero disables the probe
+		f32 probe_weight = 0.0f;
+
+		static DeviceScoring get_default(bool prefer_discrete = true);
+	};
+
 	struct NOVA_API RenderDevice {
 		std::string name;
 		DeviceVendor vendor;
@@ -27,12 +150,37 @@ namespace Nova {
 		u32 deviceID;
 		void* handle;
 
-		static u32 choose_device(RenderDriver* driver, std::span<const SurfaceID> surfaces = {});
-		static u32 choose_device(RenderDriver* driver, std::initializer_list<const SurfaceID> surfaces) {
-			return choose_device(driver, {surfaces.begin(), surfaces.end()});
+		u32 api_version = 0;
+		u32 driver_version = 0;
+		u32 subgroup_size = 0;
+		DeviceLimits limits;
+		RenderFeatureSet features;
+		std::vector<DeviceMemoryHeap> memory_heaps;
+		std::vector<DeviceQueueFamily> queue_families;
+
+		u64 get_device_local_memory() const;
+
+		static u32 choose_device(
+			RenderDriver* driver,
+			const DeviceScoring& scoring,
+			std::span<const SurfaceID> surfaces = {}
+		);
+
+		/// Scores with DeviceScoring::get_default(), prefer_discrete ranks discrete GPUs above integrated ones
+		static u32 choose_device(
+			RenderDriver* driver,
+			std::span<const SurfaceID> surfaces = {},
+			bool prefer_discrete = true
+		);
+		static u32 choose_device(
+			RenderDriver* driver,
+			std::initializer_list<const SurfaceID> surfaces,
+			bool prefer_discrete = true
+		) {
+			return choose_device(driver, {surfaces.begin(), surfaces.end()}, prefer_discrete);
 		}
-		static u32 choose_device(RenderDriver* driver, SurfaceID surface) {
-			return choose_device(driver, {surface});
+		static u32 choose_device(RenderDriver* driver, SurfaceID surface, bool prefer_discrete = true) {
+			return choose_device(driver, {surface}, prefer_discrete);
 		}
 	};
 } // namespace Nova
@@ -7,28 +7,106 @@
 #pragma once
 
 #include <nova/api.h>
+#include <nova/math/vec4.h>
 #include <nova/platform/platform_structs.h>
 #include <nova/render/params/compute_pipeline.h>
 #include <nova/render/params/graphics_pipeline.h>
+#include <nova/render/data_format.h>
 #include <nova/render/params/render_pass.h>
+#include <nova/render/params/texture.h>
 #include <nova/render/render_device.h>
 #include <nova/render/render_structs.h>
 #include <nova/types.h>
 
+#include <future>
 #include <span>
 #include <string>
 
 namespace Nova {
 	class WindowDriver;
 
+	enum class IndexType { UINT16, UINT32 };
+	enum class MemoryUsage { GPU_ONLY, CPU_TO_GPU, GPU_TO_CPU };
 	enum class PipelineType { GRAPHICS, COMPUTE };
 	enum class QueueType { UNDEFINED, GRAPHICS, COMPUTE, TRANSFER };
 	enum class RenderAPI { DX12, VULKAN };
 	enum class ShaderStage { VERTEX, FRAGMENT, GEOMETRY, TESS_CONTROL, TESS_EVAL, COMPUTE, MESH, TASK };
 
+	enum class BufferUsage : u32 {
+		NONE = 0,
+		TRANSFER_SRC = 1 << 0,
+		TRANSFER_DST = 1 << 1,
+		UNIFORM = 1 << 2,
+		STORAGE = 1 << 3,
+		INDEX = 1 << 4,
+		VERTEX = 1 << 5,
+		INDIRECT = 1 << 6,
+		SHADER_DEVICE_ADDRESS = 1 << 7,
+	};
+
+	/// How a buffer is used on either side of cmd_buffer_barrier()
+	enum class BufferAccess {
+		TRANSFER_READ,
+		TRANSFER_WRITE,
+		COMPUTE_READ,
+		COMPUTE_WRITE,
+		GRAPHICS_READ,
+		MESH_READ,
+		INDIRECT_READ,
+		INDEX_READ,
+		VERTEX_READ,
+		HOST_READ,
+		HOST_WRITE,
+	};
+
+	/// How a texture is used on either side of cmd_texture_barrier(), each access implies an image layout
+	enum class TextureAccess {
+		UNDEFINED,
+		TRANSFER_READ,
+		TRANSFER_WRITE,
+		COMPUTE_READ,
+		COMPUTE_WRITE,
+		GRAPHICS_READ,
+	};
+
+	/// Operations a format supports in optimally tiled textures, or in vertex buffers for VERTEX_BUFFER
+	enum class FormatFeature : u32 {
+		NONE = 0,
+		SAMPLED = 1 << 0,
+		LINEAR_FILTER = 1 << 1,
+		STORAGE = 1 << 2,
+		COLOR_ATTACHMENT = 1 << 3,
+		BLEND = 1 << 4,
+		DEPTH_STENCIL_ATTACHMENT = 1 << 5,
+		BLIT_SRC = 1 << 6,
+		BLIT_DST = 1 << 7,
+		TRANSFER_SRC = 1 << 8,
+		TRANSFER_DST = 1 << 9,
+		VERTEX_BUFFER = 1 << 10,
+	};
+
+	constexpr BufferUsage operator|(const BufferUsage p_a, const BufferUsage p_b) {
+		return static_cast<BufferUsage>(static_cast<u32>(p_a) | static_cast<u32>(p_b));
+	}
+	constexpr BufferUsage operator&(const BufferUsage p_a, const BufferUsage p_b) {
+		return static_cast<BufferUsage>(static_cast<u32>(p_a) & static_cast<u32>(p_b));
+	}
+	constexpr FormatFeature operator|(const FormatFeature p_a, const FormatFeature p_b) {
+		return static_cast<FormatFeature>(static_cast<u32>(p_a) | static_cast<u32>(p_b));
+	}
+	constexpr FormatFeature operator&(const FormatFeature p_a, const FormatFeature p_b) {
+		return static_cast<FormatFeature>(static_cast<u32>(p_a) & static_cast<u32>(p_b));
+	}
+
 	class NOVA_API RenderDriver {
 	  public:
 		static RenderDriver* create(RenderAPI api, WindowDriver* window_driver = nullptr);
+
+		/**
+		 * @brief Creates the driver on a background thread so instance and device enumeration can overlap with
+		 * window creation and asset loading. The window driver must outlive the returned future.
+		 */
+		static std::future<RenderDriver*> create_async(RenderAPI api, WindowDriver* window_driver = nullptr);
 		virtual ~RenderDriver() = default;
 
 		virtual RenderAPI get_api() const = 0;
@@ -39,7 +117,60 @@ namespace Nova {
 		virtual u32 get_device_count() const = 0;
 		virtual const RenderDevice& get_device(u32 index) const = 0;
 		virtual bool get_device_supports_surface(u32 index, SurfaceID surface) const = 0;
-		virtual void select_device(u32 index) = 0;
+
+		/**
+		 * @brief Returns what the device supports for a format. Queried once per device and format, then cached, so
+		 * it is cheap enough to call when choosing formats at load time.
+		 */
+		virtual FormatFeature get_format_features(u32 index, DataFormat format) const = 0;
+
+		/**
+		 * @brief Runs a short transfer benchmark on the device and returns its copy bandwidth in bytes per second.
+		 * The result is cached. Returns zero if the probe could not run.
+		 */
+		virtual f64 probe_device(u32 index) = 0;
+
+		/**
+		 * @brief Opens a logical device with only the features the engine asks for.
+		 *
+		 * Throws if any required feature is unsupported. Optional features are enabled when available; query the
+		 * result with has_feature() rather than assuming them. Several devices may be open at once, and the first
+		 * one opened becomes the current device.
+		 */
+		[[nodiscard]] virtual DeviceID open_device(
+			u32 index,
+			const RenderFeatureSet& required = {},
+			const RenderFeatureSet& optional = RenderFeatureSet::all()
+		) = 0;
+
+		/**
+		 * @brief Waits for the device and closes it. Every resource created on it must be destroyed first.
+		 */
+		virtual void close_device(DeviceID device) = 0;
+
+		/**
+		 * @brief Sets the device that new queues and resources are created on. Existing resources keep using the
+		 * device they were created on.
+		 */
+		virtual void set_current_device(DeviceID device) = 0;
+		virtual DeviceID get_current_device() const = 0;
+		virtual u32 get_device_index(DeviceID device) const = 0;
+
+		/**
+		 * @brief Opens the device and makes it current.
+		 */
+		void select_device(
+			u32 index,
+			const RenderFeatureSet& required = {},
+			const RenderFeatureSet& optional = RenderFeatureSet::all()
+		);
+
+		/// Features enabled on the current device
+		virtual const RenderFeatureSet& get_enabled_features() const = 0;
+		virtual bool has_feature(RenderFeature feature) const = 0;
+
+		/// True if the current device supports every one of the features for the format
+		bool has_format_features(DataFormat format, FormatFeature features) const;
 
 		virtual u32 choose_queue_family(QueueType type, SurfaceID surface) = 0;
 
@@ -54,6 +185,49 @@ namespace Nova {
 		virtual RenderPassID get_swapchain_render_pass(SwapchainID swapchain) const = 0;
 		virtual void destroy_swapchain(SwapchainID swapchain) = 0;
 
+		[[nodiscard]] virtual RenderTargetID create_render_target(u32 width, u32 height, DataFormat format) = 0;
+		virtual RenderPassID get_render_target_render_pass(RenderTargetID render_target) const = 0;
+		virtual std::span<const u8> get_render_target_data(RenderTargetID render_target) const = 0;
+		virtual void destroy_render_target(RenderTargetID render_target) = 0;
+
+		/**
+		 * @brief Creates an optimally tiled 2D texture in GPU memory. Throws if the format does not support the
+		 * requested usage. The contents start undefined, move the texture out of TextureAccess::UNDEFINED with
+		 * cmd_texture_barrier() before use.
+		 */
+		[[nodiscard]] virtual TextureID create_texture(const TextureParams& params) = 0;
+		virtual u32 get_texture_mip_levels(TextureID texture) const = 0;
+		virtual void destroy_texture(TextureID texture) = 0;
+
+		[[nodiscard]] virtual BufferID create_buffer(
+			u64 size,
+			BufferUsage usage,
+			MemoryUsage memory = MemoryUsage::GPU_ONLY
+		) = 0;
+		virtual void* map_buffer(BufferID buffer) = 0;
+		virtual void unmap_buffer(BufferID buffer) = 0;
+		virtual void destroy_buffer(BufferID buffer) = 0;
+
+		/**
+		 * @brief Returns the GPU address of a buffer created with SHADER_DEVICE_ADDRESS usage, for passing to shaders
+		 * through push constants or other buffers. Requires RenderFeature::BUFFER_DEVICE_ADDRESS.
+		 */
+		virtual u64 get_buffer_device_address(BufferID buffer) const = 0;
+
+		/**
+		 * @brief Copies between buffers owned by different devices through host-visible staging memory.
+		 *
+		 * Blocks until the copy has finished. Buffers that are not host visible need TRANSFER_SRC or TRANSFER_DST
+		 * usage respectively. Any work writing the source must already be complete.
+		 */
+		virtual void copy_buffer_between_devices(
+			BufferID src,
+			BufferID dst,
+			u64 size,
+			u64 src_offset = 0,
+			u64 dst_offset = 0
+		) = 0;
+
 		[[nodiscard]] virtual ShaderID create_shader(const std::span<u8> bytes, ShaderStage stage) = 0;
 		virtual void destroy_shader(ShaderID shader) = 0;
 
@@ -70,5 +244,157 @@ namespace Nova {
 		[[nodiscard]] virtual CommandBufferID create_command_buffer(CommandPoolID pool) = 0;
 		virtual void begin_command_buffer(CommandBufferID command_buffer) = 0;
 		virtual void end_command_buffer(CommandBufferID command_buffer) = 0;
+
+		virtual void cmd_begin_render_pass(
+			CommandBufferID command_buffer,
+			RenderTargetID render_target,
+			const Vec4<f32>& clear_color
+		) = 0;
+		virtual void cmd_end_render_pass(CommandBufferID command_buffer) = 0;
+		virtual void cmd_bind_pipeline(CommandBufferID command_buffer, PipelineID pipeline) = 0;
+		virtual void cmd_push_constants(
+			CommandBufferID command_buffer,
+			PipelineID pipeline,
+			std::span<const u8> data,
+			u32 offset = 0
+		) = 0;
+		virtual void cmd_bind_index_buffer(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			IndexType type,
+			u64 offset = 0
+		) = 0;
+		virtual void cmd_bind_vertex_buffer(
+			CommandBufferID command_buffer,
+			u32 binding,
+			BufferID buffer,
+			u64 offset = 0
+		) = 0;
+		virtual void cmd_set_viewport(CommandBufferID command_buffer, f32 x, f32 y, f32 width, f32 height) = 0;
+		virtual void cmd_set_scissor(CommandBufferID command_buffer, i32 x, i32 y, u32 width, u32 height) = 0;
+		virtual void cmd_draw(
+			CommandBufferID command_buffer,
+			u32 vertex_count,
+			u32 instance_count = 1,
+			u32 first_vertex = 0,
+			u32 first_instance = 0
+		) = 0;
+		virtual void cmd_draw_indexed(
+			CommandBufferID command_buffer,
+			u32 index_count,
+			u32 instance_count = 1,
+			u32 first_index = 0,
+			i32 vertex_offset = 0,
+			u32 first_instance = 0
+		) = 0;
+		virtual void cmd_draw_indexed_indirect(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			u32 draw_count,
+			u32 stride
+		) = 0;
+
+		/**
+		 * @brief Draws up to max_draw_count commands, reading the actual count from count_buffer on the GPU.
+		 * Requires RenderFeature::DRAW_INDIRECT_COUNT.
+		 */
+		virtual void cmd_draw_indexed_indirect_count(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			BufferID count_buffer,
+			u64 count_offset,
+			u32 max_draw_count,
+			u32 stride
+		) = 0;
+
+		/**
+		 * @brief Launches task shader workgroups, or mesh shader workgroups when the pipeline has no task stage.
+		 * The mesh variants require RenderFeature::MESH_SHADER, without it render through the vertex pipeline instead.
+		 */
+		virtual void cmd_draw_mesh_tasks(CommandBufferID command_buffer, u32 x, u32 y = 1, u32 z = 1) = 0;
+		virtual void cmd_draw_mesh_tasks_indirect(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			u32 draw_count,
+			u32 stride
+		) = 0;
+		virtual void cmd_draw_mesh_tasks_indirect_count(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			BufferID count_buffer,
+			u64 count_offset,
+			u32 max_draw_count,
+			u32 stride
+		) = 0;
+		virtual void cmd_dispatch(CommandBufferID command_buffer, u32 x, u32 y = 1, u32 z = 1) = 0;
+		virtual void cmd_dispatch_indirect(CommandBufferID command_buffer, BufferID buffer, u64 offset = 0) = 0;
+		virtual void cmd_copy_render_target(CommandBufferID command_buffer, RenderTargetID render_target) = 0;
+		virtual void cmd_fill_buffer(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			u64 size,
+			u32 value
+		) = 0;
+		virtual void cmd_buffer_barrier(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			BufferAccess src,
+			BufferAccess dst
+		) = 0;
+		virtual void cmd_copy_buffer(
+			CommandBufferID command_buffer,
+			BufferID src,
+			BufferID dst,
+			u64 size,
+			u64 src_offset = 0,
+			u64 dst_offset = 0
+		) = 0;
+
+		/// Transitions every mip level of the texture
+		virtual void cmd_texture_barrier(
+			CommandBufferID command_buffer,
+			TextureID texture,
+			TextureAccess src,
+			TextureAccess dst
+		) = 0;
+
+		/**
+		 * @brief Copies tightly packed texels into one mip level, which must be in TextureAccess::TRANSFER_WRITE.
+		 */
+		virtual void cmd_copy_buffer_to_texture(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			TextureID texture,
+			u32 mip_level = 0,
+			u64 buffer_offset = 0
+		) = 0;
+
+		/**
+		 * @brief Fills every mip level from the first by repeatedly halving it with blits on the GPU.
+		 *
+		 * All levels must be in TextureAccess::TRANSFER_WRITE and are left in dst. The texture needs TRANSFER_SRC and
+		 * TRANSFER_DST usage, its format needs FormatFeature::BLIT_SRC and BLIT_DST, and the command buffer must be
+		 * on a graphics queue. Formats without FormatFeature::LINEAR_FILTER are downsampled with nearest filtering.
+		 */
+		virtual void cmd_generate_mipmaps(
+			CommandBufferID command_buffer,
+			TextureID texture,
+			TextureAccess dst = TextureAccess::GRAPHICS_READ
+		) = 0;
+
+		[[nodiscard]] virtual FenceID create_fence(bool signaled = false) = 0;
+		virtual void wait_for_fence(FenceID fence) = 0;
+		virtual void reset_fence(FenceID fence) = 0;
+		virtual void destroy_fence(FenceID fence) = 0;
+
+		virtual void submit(QueueID queue, CommandBufferID command_buffer, FenceID fence = nullptr) = 0;
+
+		/// Waits for every open device
+		virtual void wait_idle() = 0;
 	};
 } // namespace Nova
@@ -7,21 +7,31 @@
 #pragma once
 
 namespace Nova {
+	struct Buffer;
 	struct CommandBuffer;
 	struct CommandPool;
+	struct Device;
+	struct Fence;
 	struct Pipeline;
 	struct Queue;
 	struct RenderPass;
+	struct RenderTarget;
 	struct Shader;
 	struct Surface;
 	struct Swapchain;
+	struct Texture;
 
+	using BufferID = Buffer*;
 	using CommandBufferID = CommandBuffer*;
 	using CommandPoolID = CommandPool*;
+	using DeviceID = Device*;
+	using FenceID = Fence*;
 	using PipelineID = Pipeline*;
 	using QueueID = Queue*;
 	using RenderPassID = RenderPass*;
+	using RenderTargetID = RenderTarget*;
 	using ShaderID = Shader*;
 	using SurfaceID = Surface*;
 	using SwapchainID = Swapchain*;
+	using TextureID = Texture*;
 } // namespace Nova
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/api.h>
+#include <nova/render/data_format.h>
+#include <nova/types.h>
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace Nova {
+	struct TextureMip {
+		u32 width = 0;
+		u32 height = 0;
+		u64 offset = 0; // Into TextureAsset::data
+		u64 size = 0;
+	};
+
+	/**
+	 * @brief Cooked texture as written by nova-cooker.
+	 *
+	 * Every mip level is stored tightly packed in the asset's format, largest first, so each one can be uploaded
+	 * with RenderDriver::cmd_copy_buffer_to_texture() at its offset.
+	 */
+	struct NOVA_API TextureAsset {
+		DataFormat format = DataFormat::UNDEFINED;
+		u32 width = 0;
+		u32 height = 0;
+		std::vector<TextureMip> mips;
+		std::vector<u8> data;
+
+		std::span<const u8> get_mip_data(u32 level) const;
+
+		static TextureAsset load(const std::filesystem::path& path);
+		static TextureAsset load(std::span<const u8> bytes);
+		void save(const std::filesystem::path& path) const;
+		std::vector<u8> serialize() const;
+	};
+} // namespace Nova
@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/math/packed.h>
+#include <nova/math/vec2.h>
+#include <nova/math/vec3.h>
+#include <nova/math/vec4.h>
+#include <nova/render/data_format.h>
+
+#include <type_traits>
+
+namespace Nova {
+	/**
+	 * @brief Format a vertex attribute of type T is fetched with, UNDEFINED if the GPU cannot fetch it directly.
+	 *
+	 * OctNormal and OctTangent are fetched as their two SNORM components and decoded in the shader.
+	 */
+	template<typename T>
+	constexpr DataFormat get_vertex_format() {
+		if constexpr (std::is_same_v<T, f32>) {
+			return DataFormat::R32_SFLOAT;
+		} else if constexpr (std::is_same_v<T, Vec2<f32>>) {
+			return DataFormat::R32G32_SFLOAT;
+		} else if constexpr (std::is_same_v<T, Vec3<f32>>) {
+			return DataFormat::R32G32B32_SFLOAT;
+		} else if constexpr (std::is_same_v<T, Vec4<f32>>) {
+			return DataFormat::R32G32B32A32_SFLOAT;
+		} else if constexpr (std::is_same_v<T, Half>) {
+			return DataFormat::R16_SFLOAT;
+		} else if constexpr (std::is_same_v<T, Half2>) {
+			return DataFormat::R16G16_SFLOAT;
+		} else if constexpr (std::is_same_v<T, Half4>) {
+			return DataFormat::R16G16B16A16_SFLOAT;
+		} else if constexpr (std::is_same_v<T, SNorm8x4>) {
+			return DataFormat::R8G8B8A8_SNORM;
+		} else if constexpr (std::is_same_v<T, UNorm8x4>) {
+			return DataFormat::R8G8B8A8_UNORM;
+		} else if constexpr (std::is_same_v<T, SNorm16x2>) {
+			return DataFormat::R16G16_SNORM;
+		} else if constexpr (std::is_same_v<T, UNorm16x2>) {
+			return DataFormat::R16G16_UNORM;
+		} else if constexpr (std::is_same_v<T, SNorm16x4>) {
+			return DataFormat::R16G16B16A16_SNORM;
+		} else if constexpr (std::is_same_v<T, UNorm16x4>) {
+			return DataFormat::R16G16B16A16_UNORM;
+		} else {
+			return DataFormat::UNDEFINED;
+		}
+	}
+} // namespace Nova
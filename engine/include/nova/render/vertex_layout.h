@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/render/data_format.h>
+#include <nova/render/params/graphics_pipeline.h>
+#include <nova/render/vertex_format.h>
+#include <nova/types.h>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+/// Describes a member of a vertex struct for Nova::make_vertex_layout(), its format comes from its type
+#define NOVA_VERTEX_MEMBER(type, member)                                                                               \
+	Nova::VertexMember {                                                                                               \
+		offsetof(type, member), sizeof(decltype(type::member)), Nova::get_vertex_format<decltype(type::member)>()     \
+	}
+
+namespace Nova {
+	struct VertexMember {
+		usize offset = 0;
+		usize size = 0;
+		DataFormat format = DataFormat::UNDEFINED;
+	};
+
+	/// Bindings and attributes for GraphicsPipelineParams, built during compilation so pipelines can reference them
+	template<usize BINDINGS, usize ATTRIBUTES>
+	struct VertexLayout {
+		std::array<VertexBinding, BINDINGS> bindings;
+		std::array<VertexAttribute, ATTRIBUTES> attributes;
+	};
+
+	/**
+	 * @brief Derives one vertex binding from the struct T and the listed members, in increasing locations.
+	 *
+	 * Compilation fails if a member has no vertex format, its format does not match its size, or members overlap.
+	 *
+	 * @code
+	 * struct Vertex {
+	 *     Vec3<f32> position;
+	 *     OctNormal normal;
+	 *     Half2 uv;
+	 * };
+	 *
+	 * static constexpr auto VERTEX_LAYOUT = make_vertex_layout<Vertex>({
+	 *     NOVA_VERTEX_MEMBER(Vertex, position),
+	 *     NOVA_VERTEX_MEMBER(Vertex, normal),
+	 *     NOVA_VERTEX_MEMBER(Vertex, uv),
+	 * });
+	 *
+	 * params.bindings = VERTEX_LAYOUT.bindings;
+	 * params.attributes = VERTEX_LAYOUT.attributes;
+	 * @endcode
+	 */
+	template<typename T, usize N>
+	consteval VertexLayout<1, N> make_vertex_layout(
+		const VertexMember (&p_members)[N],
+		const u32 p_binding = 0,
+		const InputRate p_rate = InputRate::VERTEX,
+		const u32 p_first_location = 0
+	) {
+		static_assert(std::is_standard_layout_v<T>, "offsetof() is only defined for standard layout types");
+		static_assert(std::is_trivially_copyable_v<T>, "Vertices are uploaded with memcpy()");
+
+		// A throw here stops compilation, the failing check is the one on the line the compiler points at
+		VertexLayout<1, N> layout {};
+		layout.bindings[0] = {.binding = p_binding, .stride = static_cast<u32>(sizeof(T)), .rate = p_rate};
+		for (usize i = 0; i < N; i++) {
+			const VertexMember& member = p_members[i];
+			if (member.format == DataFormat::UNDEFINED) {
+				throw std::invalid_argument("Vertex member type has no vertex format");
+			}
+			if (get_format_info(member.format).block_size != member.size) {
+				throw std::invalid_argument("Vertex member size does not match its format");
+			}
+			for (usize j = 0; j < i; j++) {
+				const VertexMember& other = p_members[j];
+				if (member.offset < other.offset + other.size && other.offset < member.offset + member.size) {
+					throw std::invalid_argument("Vertex members overlap");
+				}
+			}
+			layout.attributes[i] = {
+				.binding = p_binding,
+				.location = p_first_location + static_cast<u32>(i),
+				.offset = static_cast<u32>(member.offset),
+				.format = member.format,
+			};
+		}
+		return layout;
+	}
+
+	/// Joins layouts for separate buffers, e.g. per vertex and per instance data. Bindings and locations must differ.
+	template<usize B1, usize A1, usize B2, usize A2>
+	consteval VertexLayout<B1 + B2, A1 + A2> combine(const VertexLayout<B1, A1>& p_a, const VertexLayout<B2, A2>& p_b) {
+		VertexLayout<B1 + B2, A1 + A2> layout {};
+		for (usize i = 0; i < B1 + B2; i++) {
+			layout.bindings[i] = i < B1 ? p_a.bindings[i] : p_b.bindings[i - B1];
+			for (usize j = 0; j < i; j++) {
+				if (layout.bindings[i].binding == layout.bindings[j].binding) {
+					throw std::invalid_argument("Vertex layouts share a binding");
+				}
+			}
+		}
+		for (usize i = 0; i < A1 + A2; i++) {
+			layout.attributes[i] = i < A1 ? p_a.attributes[i] : p_b.attributes[i - A1];
+			for (usize j = 0; j < i; j++) {
+				if (layout.attributes[i].location == layout.attributes[j].location) {
+					throw std::invalid_argument("Vertex layouts share a location");
+				}
+			}
+		}
+		return layout;
+	}
+} // namespace Nova
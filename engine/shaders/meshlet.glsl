@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// Shared by meshlet.task and meshlet.mesh, layouts must match nova/render/meshlet.h.
+
+#extension GL_EXT_buffer_reference : require
+
+struct Meshlet {
+	uint vertex_offset;
+	uint triangle_offset;
+	uint vertex_count;
+	uint triangle_count;
+};
+
+struct MeshletBounds {
+	vec4 sphere;
+	vec4 cone_apex;
+	vec4 cone_axis;
+};
+
+layout(buffer_reference, std430, buffer_reference_align = 16) readonly buffer MeshletBuffer {
+	Meshlet meshlets[];
+};
+layout(buffer_reference, std430, buffer_reference_align = 16) readonly buffer BoundsBuffer {
+	MeshletBounds bounds[];
+};
+layout(buffer_reference, std430, buffer_reference_align = 4) readonly buffer IndexBuffer {
+	uint values[];
+};
+layout(buffer_reference, std430, buffer_reference_align = 4) readonly buffer PositionBuffer {
+	float values[];
+};
+layout(buffer_reference, std430, buffer_reference_align = 16) readonly buffer ViewBuffer {
+	mat4 view_projection;
+	vec4 camera_position;
+	vec4 planes[6];
+};
+
+layout(push_constant) uniform MeshletPushConstants {
+	MeshletBuffer meshlets;
+	BoundsBuffer bounds;
+	IndexBuffer vertices;
+	IndexBuffer triangles; // Packed bytes, read four at a time
+	PositionBuffer positions;
+	ViewBuffer view;
+	uint meshlet_count;
+	uint position_stride;
+} params;
+
+struct TaskPayload {
+	uint meshlets[32];
+};
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "core/async_sink.h"
+
+#include <nova/core/memory_tracker.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <string>
+
+namespace {
+	static constexpr std::chrono::microseconds MIN_BACKOFF {100};
+	static constexpr std::chrono::microseconds MAX_BACKOFF {10000};
+} // namespace
+
+using namespace Nova;
+
+AsyncSink::AsyncSink(spdlog::sink_ptr p_sink, const usize p_capacity) : m_sink(std::move(p_sink)) {
+	const usize capacity = std::bit_ceil(std::max<usize>(p_capacity, 2));
+	m_slots = std::make_unique<Slot[]>(capacity);
+	m_mask = capacity - 1;
+
+	for (usize i = 0; i < capacity; i++) {
+		m_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	m_worker = std::thread(&AsyncSink::_worker_main, this);
+}
+
+AsyncSink::~AsyncSink() {
+	{
+		std::lock_guard lock(m_mutex);
+		m_running.store(false, std::memory_order_release);
+	}
+	m_wake.notify_one();
+
+	if (m_worker.joinable()) {
+		m_worker.join();
+	}
+}
+
+void AsyncSink::log(const spdlog::details::log_msg& p_msg) {
+	// Copying the message into its slot allocates on the calling thread
+	NOVA_MEMORY_SCOPE(MemoryTag::LOGGING);
+
+	usize pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+	while (true) {
+		Slot& slot = m_slots[pos & m_mask];
+		const usize sequence = slot.sequence.load(std::memory_order_acquire);
+		const isize diff = static_cast<isize>(sequence) - static_cast<isize>(pos);
+
+		if (diff == 0) {
+			if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				slot.msg = spdlog::details::log_msg_buffer(p_msg);
+				slot.sequence.store(pos + 1, std::memory_order_release);
+				return;
+			}
+		} else if (diff < 0) {
+			// Queue is full, never stall the caller
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		} else {
+			pos = m_enqueue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void AsyncSink::flush() {
+	const usize target = m_enqueue_pos.load(std::memory_order_acquire);
+
+	{
+		std::unique_lock lock(m_mutex);
+		if (m_flush_target.load() < target) {
+			m_flush_target.store(target);
+		}
+
+		// Cut the worker's backoff short instead of waiting it out
+		m_wake.notify_one();
+		m_flushed.wait(lock, [&] { return m_written.load() >= target; });
+	}
+
+	m_sink->flush();
+}
+
+void AsyncSink::set_pattern(const std::string& p_pattern) {
+	m_sink->set_pattern(p_pattern);
+}
+
+void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> p_formatter) {
+	m_sink->set_formatter(std::move(p_formatter));
+}
+
+u64 AsyncSink::get_dropped_count() const {
+	return m_dropped.load(std::memory_order_relaxed);
+}
+
+bool AsyncSink::_pop(spdlog::details::log_msg_buffer& p_msg) {
+	const usize pos = m_dequeue_pos.load(std::memory_order_relaxed);
+	Slot& slot = m_slots[pos & m_mask];
+
+	if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+		return false;
+	}
+
+	p_msg = std::move(slot.msg);
+	slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+	m_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+	return true;
+}
+
+void AsyncSink::_worker_main() {
+	MemoryTracker::set_thread_tag(MemoryTag::LOGGING);
+
+	spdlog::details::log_msg_buffer msg;
+	std::chrono::microseconds backoff = MIN_BACKOFF;
+	u64 reported = 0;
+
+	while (true) {
+		if (_pop(msg)) {
+			m_sink->log(msg);
+			if (m_written.fetch_add(1) + 1 == m_flush_target.load()) {
+				std::lock_guard lock(m_mutex);
+				m_flushed.notify_all();
+			}
+			backoff = MIN_BACKOFF;
+			continue;
+		}
+
+		if (const u64 dropped = m_dropped.load(std::memory_order_relaxed); dropped != reported) {
+			const std::string text = "Logger queue full, dropped " + std::to_string(dropped - reported) + " messages";
+			m_sink->log(spdlog::details::log_msg(msg.logger_name, spdlog::level::warn, text));
+			reported = dropped;
+		}
+
+		if (!m_running.load(std::memory_order_acquire)) {
+			break;
+		}
+
+		{
+			std::unique_lock lock(m_mutex);
+			m_wake.wait_for(lock, backoff, [&] {
+				return m_written.load() < m_flush_target.load() || !m_running.load(std::memory_order_acquire);
+			});
+		}
+		backoff = std::min(backoff * 2, MAX_BACKOFF);
+	}
+
+	m_sink->flush();
+}
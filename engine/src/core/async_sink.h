@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/types.h>
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Nova {
+	/**
+	 * @brief Sink that hands messages to a background thread through a bounded lock-free queue.
+	 *
+	 * Producers never wait on the wrapped sink; if the queue is full the message is dropped and counted instead.
+	 */
+	class AsyncSink final : public spdlog::sinks::sink {
+	  public:
+		AsyncSink(spdlog::sink_ptr sink, usize capacity);
+		~AsyncSink() override;
+
+		AsyncSink(const AsyncSink&) = delete;
+		AsyncSink& operator=(const AsyncSink&) = delete;
+
+		void log(const spdlog::details::log_msg& msg) override;
+		void flush() override;
+		void set_pattern(const std::string& pattern) override;
+		void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+		u64 get_dropped_count() const;
+
+	  private:
+		struct Slot {
+			std::atomic<usize> sequence;
+			spdlog::details::log_msg_buffer msg;
+		};
+
+		spdlog::sink_ptr m_sink;
+		std::unique_ptr<Slot[]> m_slots;
+		usize m_mask;
+
+		alignas(64) std::atomic<usize> m_enqueue_pos = 0;
+		alignas(64) std::atomic<usize> m_dequeue_pos = 0;
+		std::atomic<usize> m_written = 0;
+		alignas(64) std::atomic<u64> m_dropped = 0;
+		std::atomic<bool> m_running = true;
+		std::thread m_worker;
+
+		// Only taken to sleep or wake, producers never lock it
+		std::mutex m_mutex;
+		std::condition_variable m_wake; // Wakes the worker from its backoff
+		std::condition_variable m_flushed; // Signalled once m_written reaches m_flush_target
+		std::atomic<usize> m_flush_target = 0;
+
+		bool _pop(spdlog::details::log_msg_buffer& msg);
+		void _worker_main();
+	};
+} // namespace Nova
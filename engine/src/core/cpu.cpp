@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/cpu.h>
+
+#include <thread>
+
+#ifdef NOVA_ARCH_X86_64
+#ifdef NOVA_COMPILER_MSVC
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace {
+#ifdef NOVA_ARCH_X86_64
+	static constexpr u64 XCR0_AVX_STATE = 0x6;
+	static constexpr u64 XCR0_AVX512_STATE = 0xE6;
+
+	void cpuid(const u32 p_leaf, const u32 p_subleaf, u32 (&p_regs)[4]) {
+#ifdef NOVA_COMPILER_MSVC
+		int regs[4];
+		__cpuidex(regs, static_cast<int>(p_leaf), static_cast<int>(p_subleaf));
+		for (int i = 0; i < 4; i++) {
+			p_regs[i] = static_cast<u32>(regs[i]);
+		}
+#else
+		__cpuid_count(p_leaf, p_subleaf, p_regs[0], p_regs[1], p_regs[2], p_regs[3]);
+#endif
+	}
+
+	u64 xgetbv() {
+#ifdef NOVA_COMPILER_MSVC
+		return _xgetbv(0);
+#else
+		u32 lo, hi;
+		__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		return (static_cast<u64>(hi) << 32) | lo;
+#endif
+	}
+#endif
+
+	Nova::CpuInfo detect() {
+		using Nova::CpuFeature;
+
+		Nova::CpuInfo info;
+		info.logical_cores = std::thread::hardware_concurrency();
+
+		const auto set = [&info](const CpuFeature p_feature, const bool p_enabled) {
+			if (p_enabled) {
+				info.features |= 1u << static_cast<u32>(p_feature);
+			}
+		};
+
+#if defined(NOVA_ARCH_X86_64)
+		u32 regs[4];
+		cpuid(0, 0, regs);
+		const u32 max_leaf = regs[0];
+
+		cpuid(1, 0, regs);
+		const u32 ecx = regs[2];
+		const u32 edx = regs[3];
+
+		// The OS must save the wider registers on context switches before AVX can be used
+		const bool os_xsave = ecx & (1u << 27);
+		const u64 xcr0 = os_xsave ? xgetbv() : 0;
+		const bool os_avx = (xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE;
+		const bool os_avx512 = (xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE;
+
+		set(CpuFeature::SSE2, edx & (1u << 26));
+		set(CpuFeature::SSSE3, ecx & (1u << 9));
+		set(CpuFeature::SSE4_1, ecx & (1u << 19));
+		set(CpuFeature::SSE4_2, ecx & (1u << 20));
+		set(CpuFeature::AVX, os_avx && (ecx & (1u << 28)));
+		set(CpuFeature::FMA, os_avx && (ecx & (1u << 12)));
+		set(CpuFeature::F16C, os_avx && (ecx & (1u << 29)));
+
+		if (max_leaf >= 7) {
+			cpuid(7, 0, regs);
+			set(CpuFeature::AVX2, os_avx && (regs[1] & (1u << 5)));
+			set(CpuFeature::AVX512F, os_avx512 && (regs[1] & (1u << 16)));
+		}
+#elif defined(NOVA_ARCH_ARM64)
+		set(CpuFeature::NEON, true);
+#endif
+
+		return info;
+	}
+} // namespace
+
+using namespace Nova;
+
+const CpuInfo& CpuInfo::get() {
+	static const CpuInfo info = detect();
+	return info;
+}
@@ -4,18 +4,38 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include "core/async_sink.h"
+
 #include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <memory>
+
+namespace {
+	static constexpr usize LOG_QUEUE_CAPACITY = 4096;
+
+	struct LoggerInstance {
+		std::unique_ptr<spdlog::logger> logger;
+
+		LoggerInstance() {
+			NOVA_MEMORY_SCOPE(Nova::MemoryTag::LOGGING);
+			auto sink = std::make_shared<Nova::AsyncSink>(
+				std::make_shared<spdlog::sinks::stdout_color_sink_mt>(),
+				LOG_QUEUE_CAPACITY
+			);
+			logger = std::make_unique<spdlog::logger>("NOVA", std::move(sink));
+			logger->set_pattern("%^[%T] %n: %v%$");
+			logger->flush_on(spdlog::level::critical);
+		}
+	};
+} // namespace
+
 using namespace Nova;
 
-std::shared_ptr<spdlog::logger> Debug::get_logger() {
-	static std::shared_ptr<spdlog::logger> s_logger;
-	if (!s_logger) {
-		s_logger = spdlog::stdout_color_mt("NOVA");
-		s_logger->set_pattern("%^[%T] %n: %v%$");
-	}
-	return s_logger;
+spdlog::logger* Debug::get_logger() {
+	static LoggerInstance s_instance;
+	return s_instance.logger.get();
 }
 
 bool Debug::is_debug() {
@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "core/work_stealing_deque.h"
+
+#include <nova/core/debug.h>
+#include <nova/core/job_system.h>
+
+#include <bit>
+#include <thread>
+
+namespace {
+	/// Rounds of failed steals a worker spins through before it sleeps
+	static constexpr u32 IDLE_ROUNDS = 64;
+
+	/// Busy job slots checked before a full pool runs a job to free one
+	static constexpr u32 ALLOCATION_PROBES = 16;
+
+	// Only one system drives a thread at a time, worker zero is the thread that created it
+	thread_local const Nova::JobSystem* t_system = nullptr;
+	thread_local u32 t_index = 0;
+} // namespace
+
+using namespace Nova;
+
+struct JobSystem::Worker {
+	static_assert(sizeof(Job) == CACHE_LINE_SIZE * 2, "Jobs should fill whole cache lines");
+	static_assert(std::has_single_bit(JOB_POOL_SIZE), "Job slots are picked with a mask");
+
+	WorkStealingDeque<Job> deque {JOB_POOL_SIZE};
+	std::unique_ptr<Job[]> jobs = std::make_unique<Job[]>(JOB_POOL_SIZE);
+	u32 next_job = 0;
+	Job* main_jobs = nullptr; // Oldest first, only used by worker zero
+	std::thread thread;
+};
+
+JobSystem::JobSystem(const u32 p_thread_count) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(t_system == nullptr);
+
+	m_thread_count = p_thread_count > 0 ? p_thread_count : std::max(CpuInfo::get().logical_cores, 1u);
+	m_workers = std::make_unique<Worker[]>(m_thread_count);
+
+	t_system = this;
+	t_index = 0;
+	for (u32 i = 1; i < m_thread_count; i++) {
+		m_workers[i].thread = std::thread(&JobSystem::_worker_main, this, i);
+	}
+	NOVA_DEBUG("Job system started with {} threads", m_thread_count);
+}
+
+JobSystem::~JobSystem() {
+	NOVA_AUTO_TRACE();
+
+	m_running.store(false, std::memory_order_release);
+	m_wake_epoch.fetch_add(1, std::memory_order_release);
+	m_wake_epoch.notify_all();
+	for (u32 i = 1; i < m_thread_count; i++) {
+		m_workers[i].thread.join();
+	}
+
+	if (t_system == this) {
+		t_system = nullptr;
+	}
+}
+
+void JobSystem::wait(const JobCounter& p_counter) {
+	NOVA_ASSERT(t_system == this);
+
+	while (!p_counter.is_done()) {
+		if (Job* job = _find_job(t_index)) {
+			_execute(*job);
+		} else {
+			std::this_thread::yield();
+		}
+	}
+}
+
+u32 JobSystem::get_thread_count() const {
+	return m_thread_count;
+}
+
+u32 JobSystem::get_thread_index() const {
+	NOVA_ASSERT(t_system == this);
+	return t_index;
+}
+
+JobSystem::Job& JobSystem::_allocate_job() {
+	NOVA_ASSERT(t_system == this);
+	Worker& worker = m_workers[t_index];
+
+	// Slots free up roughly in order, so a few busy ones in a row mean the pool is full and it is time to help out
+	while (true) {
+		for (u32 i = 0; i < ALLOCATION_PROBES; i++) {
+			Job& job = worker.jobs[worker.next_job++ & (JOB_POOL_SIZE - 1)];
+			if (!job.in_use.load(std::memory_order_acquire)) {
+				job.in_use.store(true, std::memory_order_relaxed);
+				job.next = nullptr;
+				return job;
+			}
+		}
+		if (Job* job = _find_job(t_index)) {
+			_execute(*job);
+
+			// The job just run most likely came from this pool, its slot is free again
+			if (job >= worker.jobs.get() && job < worker.jobs.get() + JOB_POOL_SIZE) {
+				job->in_use.store(true, std::memory_order_relaxed);
+				job->next = nullptr;
+				return *job;
+			}
+		} else {
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::_submit(Job& p_job) {
+	if (!m_workers[t_index].deque.push(&p_job)) {
+		_execute(p_job);
+		return;
+	}
+	_wake_one();
+}
+
+void JobSystem::_submit_after(const JobCounter& p_dependency, Job& p_job) {
+	Job* head = p_dependency.m_waiters.load(std::memory_order_relaxed);
+	do {
+		p_job.next = head;
+	} while (!p_dependency.m_waiters.compare_exchange_weak(head, &p_job, std::memory_order_seq_cst));
+
+	// Pairs with _finish(), either it takes the job with the waiters or this sees the count it left behind
+	u32 count = p_dependency.m_count.load(std::memory_order_seq_cst);
+	while (count == JobCounter::FINISHING) {
+		std::this_thread::yield();
+		count = p_dependency.m_count.load(std::memory_order_seq_cst);
+	}
+
+	// If the dependency finished before the job was added, nobody else will take the waiters
+	if (count == 0) {
+		_submit_chain(p_dependency.m_waiters.exchange(nullptr, std::memory_order_acquire));
+	}
+}
+
+void JobSystem::_submit_chain(Job* p_jobs) {
+	while (p_jobs) {
+		Job* next = p_jobs->next;
+		_submit(*p_jobs);
+		p_jobs = next;
+	}
+}
+
+void JobSystem::_submit_main(Job& p_job) {
+	Job* head = m_main_jobs.load(std::memory_order_relaxed);
+	do {
+		p_job.next = head;
+	} while (!m_main_jobs.compare_exchange_weak(head, &p_job, std::memory_order_release));
+}
+
+JobSystem::Job* JobSystem::_pop_main_job() {
+	Worker& worker = m_workers[0];
+	if (!worker.main_jobs && m_main_jobs.load(std::memory_order_relaxed)) {
+		// Reverse the newest first stack so main thread jobs run in the order they were queued
+		Job* jobs = m_main_jobs.exchange(nullptr, std::memory_order_acquire);
+		while (jobs) {
+			Job* next = jobs->next;
+			jobs->next = worker.main_jobs;
+			worker.main_jobs = jobs;
+			jobs = next;
+		}
+	}
+
+	Job* job = worker.main_jobs;
+	if (job) {
+		worker.main_jobs = job->next;
+	}
+	return job;
+}
+
+JobSystem::Job* JobSystem::_find_job(const u32 p_index) {
+	if (p_index == 0) {
+		if (Job* job = _pop_main_job()) {
+			return job;
+		}
+	}
+	if (Job* job = m_workers[p_index].deque.pop()) {
+		return job;
+	}
+	for (u32 i = 1; i < m_thread_count; i++) {
+		if (Job* job = m_workers[(p_index + i) % m_thread_count].deque.steal()) {
+			return job;
+		}
+	}
+	return nullptr;
+}
+
+void JobSystem::_execute(Job& p_job) {
+	p_job.invoke(p_job.data);
+
+	JobCounter* counter = p_job.counter;
+	p_job.in_use.store(false, std::memory_order_release);
+	if (counter) {
+		_finish(*counter);
+	}
+}
+
+void JobSystem::_finish(JobCounter& p_counter) {
+	u32 count = p_counter.m_count.load(std::memory_order_relaxed);
+	while (true) {
+		NOVA_ASSERT((count & ~JobCounter::FINISHING) > 0);
+		if (count != 1) {
+			if (p_counter.m_count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel)) {
+				return;
+			}
+		} else if (p_counter.m_count.compare_exchange_weak(count, JobCounter::FINISHING, std::memory_order_seq_cst)) {
+			break;
+		}
+	}
+
+	// The counter may be destroyed as soon as it reads zero, so take its waiters before releasing it
+	while (true) {
+		Job* waiters = p_counter.m_waiters.exchange(nullptr, std::memory_order_seq_cst);
+		count = JobCounter::FINISHING;
+		if (p_counter.m_count.compare_exchange_strong(count, 0, std::memory_order_acq_rel)) {
+			_submit_chain(waiters);
+			return;
+		}
+
+		// More jobs were added meanwhile, hand the waiters back for the last of them
+		if (waiters) {
+			Job* tail = waiters;
+			while (tail->next) {
+				tail = tail->next;
+			}
+			Job* head = p_counter.m_waiters.load(std::memory_order_relaxed);
+			do {
+				tail->next = head;
+			} while (!p_counter.m_waiters.compare_exchange_weak(head, waiters, std::memory_order_release));
+		}
+
+		// Unless those finished too, in which case this is still the last job
+		while (count != JobCounter::FINISHING) {
+			if (p_counter.m_count.compare_exchange_weak(
+					count,
+					count & ~JobCounter::FINISHING,
+					std::memory_order_acq_rel
+				)) {
+				return;
+			}
+		}
+	}
+}
+
+void JobSystem::_wake_one() {
+	// Pairs with the fence in _worker_main(), either the sleeper sees the new job or this sees the sleeper
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_sleeping.load(std::memory_order_relaxed) > 0) {
+		m_wake_epoch.fetch_add(1, std::memory_order_release);
+		m_wake_epoch.notify_one();
+	}
+}
+
+void JobSystem::_worker_main(const u32 p_index) {
+	t_system = this;
+	t_index = p_index;
+
+	u32 idle_rounds = 0;
+	while (m_running.load(std::memory_order_acquire)) {
+		if (Job* job = _find_job(p_index)) {
+			_execute(*job);
+			idle_rounds = 0;
+			continue;
+		}
+
+		if (++idle_rounds < IDLE_ROUNDS) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		m_sleeping.fetch_add(1, std::memory_order_relaxed);
+		const u32 epoch = m_wake_epoch.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (Job* job = _find_job(p_index)) {
+			m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+			_execute(*job);
+			idle_rounds = 0;
+			continue;
+		}
+
+		if (m_running.load(std::memory_order_acquire)) {
+			m_wake_epoch.wait(epoch, std::memory_order_acquire);
+		}
+		m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+		idle_rounds = 0;
+	}
+}
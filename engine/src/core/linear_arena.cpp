@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/core/linear_arena.h>
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+#ifdef NOVA_WINDOWS
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace {
+	/// Only touched pages are committed, so every thread can reserve plenty
+	static constexpr usize SCRATCH_CAPACITY = 64ull << 20;
+
+#ifdef NOVA_WINDOWS
+	static constexpr usize COMMIT_GRANULARITY = 64ull << 10;
+#else
+	static constexpr usize HUGE_PAGE_SIZE = 2ull << 20;
+#endif
+} // namespace
+
+using namespace Nova;
+
+LinearArena::LinearArena(const usize p_capacity, const bool p_huge_pages) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_capacity > 0);
+
+#ifdef NOVA_WINDOWS
+	// Large pages are committed up front and need SeLockMemoryPrivilege, without it the allocation fails
+	if (p_huge_pages) {
+		if (const usize page_size = GetLargePageMinimum()) {
+			m_capacity = (p_capacity + page_size - 1) & ~(page_size - 1);
+			m_memory = static_cast<std::byte*>(
+				VirtualAlloc(nullptr, m_capacity, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE)
+			);
+			m_huge_pages = m_memory != nullptr;
+		}
+	}
+	if (!m_memory) {
+		m_capacity = p_capacity;
+		m_memory = static_cast<std::byte*>(VirtualAlloc(nullptr, m_capacity, MEM_RESERVE, PAGE_READWRITE));
+	} else {
+		m_committed = m_capacity;
+	}
+	if (!m_memory) {
+		throw std::runtime_error("Failed to reserve arena memory");
+	}
+#else
+	m_capacity = p_huge_pages ? (p_capacity + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1) : p_capacity;
+	void* memory =
+		mmap(nullptr, m_capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (memory == MAP_FAILED) {
+		throw std::runtime_error("Failed to reserve arena memory");
+	}
+	m_memory = static_cast<std::byte*>(memory);
+
+	// Transparent huge pages, unlike MAP_HUGETLB they need no pages reserved up front
+	if (p_huge_pages) {
+		m_huge_pages = madvise(memory, m_capacity, MADV_HUGEPAGE) == 0;
+	}
+#endif
+
+	if (p_huge_pages && !m_huge_pages) {
+		NOVA_WARN("Huge pages unavailable, arena uses normal pages");
+	}
+}
+
+LinearArena::~LinearArena() {
+	NOVA_AUTO_TRACE();
+#ifdef NOVA_WINDOWS
+	VirtualFree(m_memory, 0, MEM_RELEASE);
+#else
+	munmap(m_memory, m_capacity);
+#endif
+}
+
+usize LinearArena::get_used() const {
+	return m_offset;
+}
+
+usize LinearArena::get_capacity() const {
+	return m_capacity;
+}
+
+usize LinearArena::get_peak() const {
+	return m_peak;
+}
+
+bool LinearArena::has_huge_pages() const {
+	return m_huge_pages;
+}
+
+LinearArena& LinearArena::get_scratch() {
+	thread_local LinearArena scratch(SCRATCH_CAPACITY);
+	return scratch;
+}
+
+void* LinearArena::do_allocate(const usize p_bytes, const usize p_alignment) {
+	const uptr base = reinterpret_cast<uptr>(m_memory);
+	const usize offset = ((base + m_offset + p_alignment - 1) & ~(p_alignment - 1)) - base;
+	if (offset + p_bytes > m_capacity) {
+		throw std::bad_alloc();
+	}
+
+#ifdef NOVA_WINDOWS
+	// Windows charges reserved memory against the commit limit once committed, so commit it as the arena grows
+	if (offset + p_bytes > m_committed) {
+		const usize end = (offset + p_bytes + COMMIT_GRANULARITY - 1) & ~(COMMIT_GRANULARITY - 1);
+		const usize committed = std::min(end, m_capacity);
+		if (!VirtualAlloc(m_memory + m_committed, committed - m_committed, MEM_COMMIT, PAGE_READWRITE)) {
+			throw std::bad_alloc();
+		}
+		m_committed = committed;
+	}
+#endif
+
+	m_offset = offset + p_bytes;
+	m_peak = std::max(m_peak, m_offset);
+	return m_memory + offset;
+}
+
+void LinearArena::do_deallocate(void* p_pointer, const usize p_bytes, usize) {
+	// Only the most recent allocation can be taken back, e.g. a temporary freed before anything else was allocated.
+	// Memory below the innermost scope belongs to an outer one, taking it back would move the offset below its marker
+	std::byte* pointer = static_cast<std::byte*>(p_pointer);
+	if (pointer + p_bytes == m_memory + m_offset && pointer >= m_memory + m_floor) {
+		m_offset -= p_bytes;
+	}
+}
+
+bool LinearArena::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept {
+	return this == &p_other;
+}
@@ -0,0 +1,485 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#ifdef NOVA_LINUX
+#include <cxxabi.h>
+#include <dlfcn.h>
+#endif
+
+#ifdef NOVA_COMPILER_MSVC
+#include <intrin.h>
+#define NOVA_RETURN_ADDRESS() reinterpret_cast<uptr>(_ReturnAddress())
+#else
+#define NOVA_RETURN_ADDRESS() reinterpret_cast<uptr>(__builtin_return_address(0))
+#endif
+
+namespace {
+	using Nova::MemoryTag;
+
+	static constexpr usize TAG_COUNT = static_cast<usize>(MemoryTag::MAX);
+	static constexpr std::string_view TAG_NAMES[] = {
+		"General",
+		"Render",
+		"Driver",
+		"Device",
+		"Platform",
+		"Assets",
+		"Logging",
+	};
+	static_assert(std::size(TAG_NAMES) == TAG_COUNT);
+
+#if defined(NOVA_TRACK_MEMORY) && !defined(NDEBUG)
+	static constexpr bool TRACK_CALL_SITES = true;
+#else
+	static constexpr bool TRACK_CALL_SITES = false;
+#endif
+
+	static constexpr usize CALL_SITE_CAPACITY = 4096;
+	static constexpr u16 NO_CALL_SITE = 0xffff;
+	static constexpr std::string_view BYTE_UNITS[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+
+	/// Stored in front of every tracked heap allocation, so it can be freed without being told its size
+	struct alignas(16) Header {
+		u64 size;
+		u32 offset; // From the start of the underlying malloc() block
+		u16 call_site;
+		MemoryTag tag;
+	};
+
+	// Each tag is updated from every thread, keep them on separate cache lines
+	struct alignas(64) TagCounters {
+		std::atomic<u64> live_bytes {0};
+		std::atomic<u64> live_count {0};
+		std::atomic<u64> peak_bytes {0};
+		std::atomic<u64> frame_peak_bytes {0};
+		std::atomic<u64> total_bytes {0};
+		std::atomic<u64> total_count {0};
+		std::atomic<u64> frame_bytes {0};
+		std::atomic<u64> frame_count {0};
+		std::atomic<u64> budget {0};
+
+		// Only touched by end_frame()
+		u64 last_total_bytes = 0;
+		u64 last_total_count = 0;
+		bool over_budget = false;
+	};
+
+	struct CallSite {
+		std::atomic<uptr> address {0};
+		std::atomic<MemoryTag> tag {MemoryTag::GENERAL};
+		std::atomic<u64> count {0};
+		std::atomic<u64> bytes {0};
+		std::atomic<u64> live_bytes {0};
+	};
+
+	// Constant initialized, operator new can be called before any dynamic initializer runs
+	constinit TagCounters s_tags[TAG_COUNT];
+	constinit CallSite s_call_sites[TRACK_CALL_SITES ? CALL_SITE_CAPACITY : 1];
+
+	thread_local MemoryTag t_tag = MemoryTag::GENERAL;
+	thread_local Nova::AllocationCount t_count;
+
+	void raise_peak(std::atomic<u64>& p_peak, const u64 p_value) {
+		u64 peak = p_peak.load(std::memory_order_relaxed);
+		while (p_value > peak && !p_peak.compare_exchange_weak(peak, p_value, std::memory_order_relaxed)) {}
+	}
+
+	void count_allocation(const MemoryTag p_tag, const u64 p_bytes) {
+		TagCounters& tag = s_tags[static_cast<usize>(p_tag)];
+		const u64 live = tag.live_bytes.fetch_add(p_bytes, std::memory_order_relaxed) + p_bytes;
+		tag.live_count.fetch_add(1, std::memory_order_relaxed);
+		tag.total_bytes.fetch_add(p_bytes, std::memory_order_relaxed);
+		tag.total_count.fetch_add(1, std::memory_order_relaxed);
+		raise_peak(tag.peak_bytes, live);
+		raise_peak(tag.frame_peak_bytes, live);
+	}
+
+	void count_free(const MemoryTag p_tag, const u64 p_bytes) {
+		TagCounters& tag = s_tags[static_cast<usize>(p_tag)];
+		tag.live_bytes.fetch_sub(p_bytes, std::memory_order_relaxed);
+		tag.live_count.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	/// Slot of the call site in an open addressing table that is never shrunk, NO_CALL_SITE once it is full
+	u16 find_call_site(const uptr p_address, const MemoryTag p_tag) {
+		const usize hash = static_cast<usize>((p_address >> 2) * 0x9e3779b97f4a7c15ull >> 32);
+		for (usize i = 0; i < CALL_SITE_CAPACITY; i++) {
+			const usize index = (hash + i) & (CALL_SITE_CAPACITY - 1);
+			CallSite& site = s_call_sites[index];
+			uptr address = site.address.load(std::memory_order_relaxed);
+			if (address == 0 && site.address.compare_exchange_strong(address, p_address, std::memory_order_relaxed)) {
+				site.tag.store(p_tag, std::memory_order_relaxed);
+				return static_cast<u16>(index);
+			}
+			if (address == p_address) {
+				return static_cast<u16>(index);
+			}
+		}
+		return NO_CALL_SITE;
+	}
+
+	void* allocate(const usize p_bytes, usize p_alignment, const MemoryTag p_tag, const uptr p_call_site) {
+		// Room for the header and to align the pointer after it, malloc() itself may only align to 8 bytes
+		p_alignment = std::max(p_alignment, alignof(Header));
+		std::byte* block = static_cast<std::byte*>(std::malloc(sizeof(Header) + p_alignment + p_bytes));
+		if (!block) {
+			return nullptr;
+		}
+
+		const uptr base = reinterpret_cast<uptr>(block) + sizeof(Header);
+		std::byte* pointer = block + ((base + p_alignment - 1) & ~(p_alignment - 1)) - reinterpret_cast<uptr>(block);
+		Header* header = reinterpret_cast<Header*>(pointer) - 1;
+		header->size = p_bytes;
+		header->offset = static_cast<u32>(pointer - block);
+		header->call_site = NO_CALL_SITE;
+		header->tag = p_tag;
+
+		count_allocation(p_tag, p_bytes);
+		t_count.count++;
+		t_count.bytes += p_bytes;
+
+		if constexpr (TRACK_CALL_SITES) {
+			if (p_call_site) {
+				header->call_site = find_call_site(p_call_site, p_tag);
+				if (header->call_site != NO_CALL_SITE) {
+					CallSite& site = s_call_sites[header->call_site];
+					site.count.fetch_add(1, std::memory_order_relaxed);
+					site.bytes.fetch_add(p_bytes, std::memory_order_relaxed);
+					site.live_bytes.fetch_add(p_bytes, std::memory_order_relaxed);
+				}
+			}
+		}
+		return pointer;
+	}
+
+	void deallocate(void* p_pointer) {
+		if (!p_pointer) {
+			return;
+		}
+
+		const Header* header = static_cast<const Header*>(p_pointer) - 1;
+		count_free(header->tag, header->size);
+		if constexpr (TRACK_CALL_SITES) {
+			if (header->call_site != NO_CALL_SITE) {
+				s_call_sites[header->call_site].live_bytes.fetch_sub(header->size, std::memory_order_relaxed);
+			}
+		}
+		std::free(static_cast<std::byte*>(p_pointer) - header->offset);
+	}
+
+	std::string format_bytes(const u64 p_bytes) {
+		f64 value = static_cast<f64>(p_bytes);
+		usize unit = 0;
+		while (value >= 1024.0 && unit + 1 < std::size(BYTE_UNITS)) {
+			value /= 1024.0;
+			unit++;
+		}
+		return unit == 0 ? fmt::format("{} B", p_bytes) : fmt::format("{:.2f} {}", value, BYTE_UNITS[unit]);
+	}
+
+	/// Module and offset of the address, which addr2line or a debugger can resolve, and the nearest exported symbol
+	[[maybe_unused]] std::string describe_address(const uptr p_address) {
+		std::string text = fmt::format("{:#x}", p_address);
+#ifdef NOVA_LINUX
+		Dl_info info;
+		if (dladdr(reinterpret_cast<void*>(p_address), &info) && info.dli_fname) {
+			const std::string_view module = info.dli_fname;
+			text = fmt::format(
+				"{}+{:#x}",
+				module.substr(module.find_last_of('/') + 1),
+				p_address - reinterpret_cast<uptr>(info.dli_fbase)
+			);
+			if (info.dli_sname) {
+				int status = 0;
+				char* name = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+				text += fmt::format(" ({})", status == 0 ? name : info.dli_sname);
+				std::free(name);
+			}
+		}
+#endif
+		return text;
+	}
+} // namespace
+
+using namespace Nova;
+
+void* MemoryTracker::allocate(const usize p_bytes, const usize p_alignment, const MemoryTag p_tag) {
+	return ::allocate(p_bytes, p_alignment, p_tag, 0);
+}
+
+void* MemoryTracker::reallocate(void* p_pointer, const usize p_bytes, const usize p_alignment, const MemoryTag p_tag) {
+	if (!p_pointer) {
+		return allocate(p_bytes, p_alignment, p_tag);
+	}
+	if (p_bytes == 0) {
+		deallocate(p_pointer);
+		return nullptr;
+	}
+
+	// The original allocation is left untouched if this fails
+	void* pointer = allocate(p_bytes, p_alignment, p_tag);
+	if (pointer) {
+		const Header* header = static_cast<const Header*>(p_pointer) - 1;
+		std::memcpy(pointer, p_pointer, std::min<usize>(header->size, p_bytes));
+		deallocate(p_pointer);
+	}
+	return pointer;
+}
+
+void MemoryTracker::deallocate(void* p_pointer) {
+	::deallocate(p_pointer);
+}
+
+void MemoryTracker::record_allocation(const MemoryTag p_tag, const u64 p_bytes) {
+	NOVA_ASSERT(p_tag < MemoryTag::MAX);
+	count_allocation(p_tag, p_bytes);
+}
+
+void MemoryTracker::record_free(const MemoryTag p_tag, const u64 p_bytes) {
+	NOVA_ASSERT(p_tag < MemoryTag::MAX);
+	count_free(p_tag, p_bytes);
+}
+
+MemoryTag MemoryTracker::get_thread_tag() {
+	return t_tag;
+}
+
+void MemoryTracker::set_thread_tag(const MemoryTag p_tag) {
+	NOVA_ASSERT(p_tag < MemoryTag::MAX);
+	t_tag = p_tag;
+}
+
+AllocationCount MemoryTracker::get_thread_count() {
+	return t_count;
+}
+
+bool MemoryTracker::is_tracking_heap() {
+#ifdef NOVA_TRACK_MEMORY
+	return true;
+#else
+	return false;
+#endif
+}
+
+MemoryStats MemoryTracker::get_stats(const MemoryTag p_tag) {
+	NOVA_ASSERT(p_tag < MemoryTag::MAX);
+	const TagCounters& tag = s_tags[static_cast<usize>(p_tag)];
+
+	MemoryStats stats;
+	stats.live_bytes = tag.live_bytes.load(std::memory_order_relaxed);
+	stats.live_count = tag.live_count.load(std::memory_order_relaxed);
+	stats.peak_bytes = tag.peak_bytes.load(std::memory_order_relaxed);
+	stats.total_bytes = tag.total_bytes.load(std::memory_order_relaxed);
+	stats.total_count = tag.total_count.load(std::memory_order_relaxed);
+	stats.frame_bytes = tag.frame_bytes.load(std::memory_order_relaxed);
+	stats.frame_count = tag.frame_count.load(std::memory_order_relaxed);
+	stats.budget = tag.budget.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void MemoryTracker::set_budget(const MemoryTag p_tag, const u64 p_bytes) {
+	NOVA_ASSERT(p_tag < MemoryTag::MAX);
+	s_tags[static_cast<usize>(p_tag)].budget.store(p_bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::end_frame() {
+	for (usize i = 0; i < TAG_COUNT; i++) {
+		TagCounters& tag = s_tags[i];
+
+		const u64 total_bytes = tag.total_bytes.load(std::memory_order_relaxed);
+		const u64 total_count = tag.total_count.load(std::memory_order_relaxed);
+		tag.frame_bytes.store(total_bytes - tag.last_total_bytes, std::memory_order_relaxed);
+		tag.frame_count.store(total_count - tag.last_total_count, std::memory_order_relaxed);
+		tag.last_total_bytes = total_bytes;
+		tag.last_total_count = total_count;
+
+		// The peak catches budgets exceeded only briefly during the frame
+		const u64 live = tag.live_bytes.load(std::memory_order_relaxed);
+		const u64 peak = tag.frame_peak_bytes.exchange(live, std::memory_order_relaxed);
+		const u64 budget = tag.budget.load(std::memory_order_relaxed);
+		if (budget == 0 || peak <= budget) {
+			tag.over_budget = false;
+		} else if (!tag.over_budget) {
+			tag.over_budget = true;
+			NOVA_WARN("{} memory over budget: {} of {}", TAG_NAMES[i], format_bytes(peak), format_bytes(budget));
+		}
+	}
+}
+
+std::vector<MemoryCallSite> MemoryTracker::get_top_call_sites(const usize p_count) {
+	std::vector<MemoryCallSite> sites;
+	if constexpr (TRACK_CALL_SITES) {
+		for (const CallSite& site : s_call_sites) {
+			const uptr address = site.address.load(std::memory_order_relaxed);
+			if (address == 0) {
+				continue;
+			}
+			sites.push_back({
+				.address = address,
+				.tag = site.tag.load(std::memory_order_relaxed),
+				.count = site.count.load(std::memory_order_relaxed),
+				.bytes = site.bytes.load(std::memory_order_relaxed),
+				.live_bytes = site.live_bytes.load(std::memory_order_relaxed),
+			});
+		}
+
+		const usize count = std::min(p_count, sites.size());
+		std::partial_sort(sites.begin(), sites.begin() + count, sites.end(), [](const auto& p_a, const auto& p_b) {
+			return p_a.bytes > p_b.bytes;
+		});
+		sites.resize(count);
+	}
+	return sites;
+}
+
+void MemoryTracker::log_report(const usize p_call_sites) {
+#if NOVA_ACTIVE_LOG_LEVEL <= NOVA_LOG_LEVEL_DEBUG
+	NOVA_DEBUG("Memory usage:");
+	for (usize i = 0; i < TAG_COUNT; i++) {
+		const MemoryStats stats = get_stats(static_cast<MemoryTag>(i));
+		if (stats.total_count == 0) {
+			continue;
+		}
+		NOVA_DEBUG(
+			"  {}: {} live in {} allocations, peak {}, {} allocations of {} last frame",
+			TAG_NAMES[i],
+			format_bytes(stats.live_bytes),
+			stats.live_count,
+			format_bytes(stats.peak_bytes),
+			stats.frame_count,
+			format_bytes(stats.frame_bytes)
+		);
+	}
+
+	const std::vector<MemoryCallSite> sites = get_top_call_sites(p_call_sites);
+	if (!sites.empty()) {
+		NOVA_DEBUG("Top allocation call sites:");
+	}
+	for (const MemoryCallSite& site : sites) {
+		NOVA_DEBUG(
+			"  {} in {} allocations, {} live, at {} [{}]",
+			format_bytes(site.bytes),
+			site.count,
+			format_bytes(site.live_bytes),
+			describe_address(site.address),
+			get_tag_name(site.tag)
+		);
+	}
+#else
+	(void)p_call_sites;
+#endif
+}
+
+std::string_view MemoryTracker::get_tag_name(const MemoryTag p_tag) {
+	NOVA_ASSERT(p_tag < MemoryTag::MAX);
+	return TAG_NAMES[static_cast<usize>(p_tag)];
+}
+
+#ifdef NOVA_TRACK_MEMORY
+// Replaces the global allocation functions for the whole process, each one captures its own return address
+
+void* operator new(const std::size_t p_size) {
+	if (void* pointer = allocate(p_size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, t_tag, NOVA_RETURN_ADDRESS())) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t p_size) {
+	if (void* pointer = allocate(p_size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, t_tag, NOVA_RETURN_ADDRESS())) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new(const std::size_t p_size, const std::nothrow_t&) noexcept {
+	return allocate(p_size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, t_tag, NOVA_RETURN_ADDRESS());
+}
+
+void* operator new[](const std::size_t p_size, const std::nothrow_t&) noexcept {
+	return allocate(p_size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, t_tag, NOVA_RETURN_ADDRESS());
+}
+
+void* operator new(const std::size_t p_size, const std::align_val_t p_align) {
+	if (void* pointer = allocate(p_size, static_cast<usize>(p_align), t_tag, NOVA_RETURN_ADDRESS())) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t p_size, const std::align_val_t p_align) {
+	if (void* pointer = allocate(p_size, static_cast<usize>(p_align), t_tag, NOVA_RETURN_ADDRESS())) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new(const std::size_t p_size, const std::align_val_t p_align, const std::nothrow_t&) noexcept {
+	return allocate(p_size, static_cast<usize>(p_align), t_tag, NOVA_RETURN_ADDRESS());
+}
+
+void* operator new[](const std::size_t p_size, const std::align_val_t p_align, const std::nothrow_t&) noexcept {
+	return allocate(p_size, static_cast<usize>(p_align), t_tag, NOVA_RETURN_ADDRESS());
+}
+
+void operator delete(void* p_pointer) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete[](void* p_pointer) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete(void* p_pointer, std::size_t) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete[](void* p_pointer, std::size_t) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete(void* p_pointer, std::align_val_t) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete[](void* p_pointer, std::align_val_t) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete(void* p_pointer, std::size_t, std::align_val_t) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete[](void* p_pointer, std::size_t, std::align_val_t) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete(void* p_pointer, const std::nothrow_t&) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete[](void* p_pointer, const std::nothrow_t&) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete(void* p_pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+	deallocate(p_pointer);
+}
+
+void operator delete[](void* p_pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+	deallocate(p_pointer);
+}
+#endif
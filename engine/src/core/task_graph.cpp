@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/core/task_graph.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Nova;
+
+TaskGraph::TaskGraph(JobSystem& p_jobs) : m_jobs(p_jobs) {}
+
+TaskGraph::~TaskGraph() {
+	wait_idle();
+}
+
+TaskID TaskGraph::add_task(std::string p_name, Function p_function, const bool p_main_thread) {
+	NOVA_ASSERT(m_frame_count == 0);
+	NOVA_ASSERT(p_function);
+
+	const TaskID id = static_cast<TaskID>(m_tasks.size());
+	Task& task = m_tasks.emplace_back();
+	task.name = std::move(p_name);
+	task.function = std::move(p_function);
+	task.main_thread = p_main_thread;
+	task.previous_dependencies.push_back(id);
+	return id;
+}
+
+void TaskGraph::add_dependency(const TaskID p_task, const TaskID p_dependency) {
+	NOVA_ASSERT(m_frame_count == 0);
+	NOVA_ASSERT(p_task < m_tasks.size() && p_dependency < m_tasks.size());
+	NOVA_ASSERT(p_task != p_dependency);
+
+	std::vector<TaskID>& dependencies = m_tasks[p_task].dependencies;
+	if (std::ranges::find(dependencies, p_dependency) == dependencies.end()) {
+		dependencies.push_back(p_dependency);
+	}
+}
+
+void TaskGraph::add_previous_frame_dependency(const TaskID p_task, const TaskID p_dependency) {
+	NOVA_ASSERT(m_frame_count == 0);
+	NOVA_ASSERT(p_task < m_tasks.size() && p_dependency < m_tasks.size());
+
+	std::vector<TaskID>& dependencies = m_tasks[p_task].previous_dependencies;
+	if (std::ranges::find(dependencies, p_dependency) == dependencies.end()) {
+		dependencies.push_back(p_dependency);
+	}
+}
+
+void TaskGraph::execute() {
+	NOVA_ASSERT(m_jobs.get_thread_index() == 0);
+
+	if (m_frame_count == 0) {
+		_compile();
+	}
+
+	Frame& frame = m_frames[m_frame_count % std::size(m_frames)];
+	frame.index = m_frame_count++;
+	frame.start = Clock::now();
+
+	// Dependencies are started first, so their counters are already raised when a task checks them
+	for (const TaskID task : m_order) {
+		m_jobs.run([this, &frame, task] { _schedule(frame, task); }, &frame.done[task]);
+	}
+
+	while (m_frame_count - m_finished_count >= MAX_FRAMES_IN_FLIGHT) {
+		_finish_frame();
+	}
+}
+
+void TaskGraph::wait_idle() {
+	while (m_finished_count < m_frame_count) {
+		_finish_frame();
+	}
+}
+
+u32 TaskGraph::get_task_count() const {
+	return static_cast<u32>(m_tasks.size());
+}
+
+const std::string& TaskGraph::get_task_name(const TaskID p_task) const {
+	NOVA_ASSERT(p_task < m_tasks.size());
+	return m_tasks[p_task].name;
+}
+
+u64 TaskGraph::get_frame_count() const {
+	return m_frame_count;
+}
+
+const TaskTiming& TaskGraph::get_task_timing(const TaskID p_task) const {
+	NOVA_ASSERT(p_task < m_timings.size());
+	return m_timings[p_task];
+}
+
+f64 TaskGraph::get_frame_time_ms() const {
+	return m_frame_time_ms;
+}
+
+void TaskGraph::_compile() {
+	NOVA_AUTO_TRACE();
+
+	// Kahn's algorithm, tasks without pending dependencies are appended in the order they were added
+	const usize count = m_tasks.size();
+	std::vector<u32> pending(count);
+	std::vector<std::vector<TaskID>> dependents(count);
+	for (TaskID task = 0; task < count; task++) {
+		pending[task] = static_cast<u32>(m_tasks[task].dependencies.size());
+		for (const TaskID dependency : m_tasks[task].dependencies) {
+			dependents[dependency].push_back(task);
+		}
+	}
+
+	m_order.clear();
+	m_order.reserve(count);
+	for (TaskID task = 0; task < count; task++) {
+		if (pending[task] == 0) {
+			m_order.push_back(task);
+		}
+	}
+	for (usize i = 0; i < m_order.size(); i++) {
+		for (const TaskID dependent : dependents[m_order[i]]) {
+			if (--pending[dependent] == 0) {
+				m_order.push_back(dependent);
+			}
+		}
+	}
+
+	if (m_order.size() != count) {
+		const auto task = std::ranges::find_if(pending, [](const u32 p_pending) { return p_pending > 0; });
+		const std::string& name = m_tasks[static_cast<usize>(task - pending.begin())].name;
+		throw std::runtime_error("Task graph has a dependency cycle through task: " + name);
+	}
+
+	for (Frame& frame : m_frames) {
+		frame.done = std::make_unique<JobCounter[]>(count);
+		frame.task_start.resize(count);
+		frame.task_end.resize(count);
+	}
+	m_timings.assign(count, {});
+}
+
+void TaskGraph::_schedule(Frame& p_frame, const TaskID p_task) {
+	const Task& task = m_tasks[p_task];
+
+	// Waits for one unfinished dependency at a time, by checking again in a job that runs once it finishes
+	for (const TaskID dependency : task.dependencies) {
+		if (!p_frame.done[dependency].is_done()) {
+			m_jobs.run_after(
+				p_frame.done[dependency],
+				[this, &p_frame, p_task] { _schedule(p_frame, p_task); },
+				&p_frame.done[p_task]
+			);
+			return;
+		}
+	}
+
+	if (p_frame.index > 0) {
+		Frame& previous = m_frames[(p_frame.index - 1) % std::size(m_frames)];
+		for (const TaskID dependency : task.previous_dependencies) {
+			if (!previous.done[dependency].is_done()) {
+				m_jobs.run_after(
+					previous.done[dependency],
+					[this, &p_frame, p_task] { _schedule(p_frame, p_task); },
+					&p_frame.done[p_task]
+				);
+				return;
+			}
+		}
+	}
+
+	if (task.main_thread && m_jobs.get_thread_index() != 0) {
+		m_jobs.run_on_main([this, &p_frame, p_task] { _run(p_frame, p_task); }, &p_frame.done[p_task]);
+		return;
+	}
+	_run(p_frame, p_task);
+}
+
+void TaskGraph::_run(Frame& p_frame, const TaskID p_task) {
+	p_frame.task_start[p_task] = Clock::now();
+	m_tasks[p_task].function(p_frame.index);
+	p_frame.task_end[p_task] = Clock::now();
+}
+
+void TaskGraph::_finish_frame() {
+	Frame& frame = m_frames[m_finished_count % std::size(m_frames)];
+	for (const TaskID task : m_order) {
+		m_jobs.wait(frame.done[task]);
+	}
+
+	using Milliseconds = std::chrono::duration<f64, std::milli>;
+	Clock::time_point end = frame.start;
+	for (TaskID task = 0; task < m_tasks.size(); task++) {
+		m_timings[task].start_ms = Milliseconds(frame.task_start[task] - frame.start).count();
+		m_timings[task].duration_ms = Milliseconds(frame.task_end[task] - frame.task_start[task]).count();
+		end = std::max(end, frame.task_end[task]);
+	}
+	m_frame_time_ms = Milliseconds(end - frame.start).count();
+	m_finished_count++;
+}
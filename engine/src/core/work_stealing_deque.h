@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <nova/core/cpu.h>
+#include <nova/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+
+namespace Nova {
+	/**
+	 * @brief Fixed capacity Chase-Lev deque of pointers.
+	 *
+	 * Only the owning thread may push and pop, at the bottom. Any thread may steal from the top. Memory orderings
+	 * follow Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models" (2013), except that every store
+	 * to the bottom index releases instead of push() using a fence. Thieves reading any of those stores still see
+	 * the items pushed before it, and ThreadSanitizer can follow it.
+	 */
+	template<typename T>
+	class WorkStealingDeque {
+	  public:
+		explicit WorkStealingDeque(const usize p_capacity) {
+			const usize capacity = std::bit_ceil(std::max<usize>(p_capacity, 2));
+			m_items = std::make_unique<std::atomic<T*>[]>(capacity);
+			m_mask = capacity - 1;
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		/// Returns false when the deque is full
+		bool push(T* p_item) {
+			const isize bottom = m_bottom.load(std::memory_order_relaxed);
+			const isize top = m_top.load(std::memory_order_acquire);
+			if (bottom - top > static_cast<isize>(m_mask)) {
+				return false;
+			}
+			m_items[bottom & m_mask].store(p_item, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// Takes the most recently pushed item, nullptr if empty
+		T* pop() {
+			const isize bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_release);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			isize top = m_top.load(std::memory_order_relaxed);
+
+			if (top > bottom) {
+				m_bottom.store(bottom + 1, std::memory_order_release);
+				return nullptr;
+			}
+
+			T* item = m_items[bottom & m_mask].load(std::memory_order_relaxed);
+			if (top == bottom) {
+				// Last item, race the thieves for it
+				if (!m_top.compare_exchange_strong(
+						top,
+						top + 1,
+						std::memory_order_seq_cst,
+						std::memory_order_relaxed
+					)) {
+					item = nullptr;
+				}
+				m_bottom.store(bottom + 1, std::memory_order_release);
+			}
+			return item;
+		}
+
+		/// Takes the oldest item, nullptr if empty or another thread won the race for it
+		T* steal() {
+			isize top = m_top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const isize bottom = m_bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom) {
+				return nullptr;
+			}
+
+			T* item = m_items[top & m_mask].load(std::memory_order_relaxed);
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				return nullptr;
+			}
+			return item;
+		}
+
+	  private:
+		std::unique_ptr<std::atomic<T*>[]> m_items;
+		usize m_mask;
+
+		alignas(CACHE_LINE_SIZE) std::atomic<isize> m_top = 0;
+		alignas(CACHE_LINE_SIZE) std::atomic<isize> m_bottom = 0;
+	};
+} // namespace Nova
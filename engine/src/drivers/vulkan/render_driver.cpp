@@ -11,6 +11,9 @@
 #include "drivers/vulkan/render_structs.h"
 
 #include <nova/core/debug.h>
+#include <nova/core/linear_arena.h>
+#include <nova/core/memory_tracker.h>
+#include <nova/core/timer.h>
 #include <nova/platform/window_driver.h>
 #include <nova/render/render_device.h>
 #include <nova/version.h>
@@ -18,14 +21,73 @@
 
 #include <algorithm>
 #include <bit>
+#include <chrono>
+#include <cstring>
 #include <format>
+#include <iterator>
 #include <limits>
 #include <string_view>
 
 namespace {
 	static constexpr u32 MAX_QUEUES_PER_FAMILY = 2;
+	static constexpr VkDeviceSize PROBE_BUFFER_SIZE = 16 * 1024 * 1024;
+	static constexpr u32 PROBE_COPY_COUNT = 8;
+	static constexpr u64 PROBE_TIMEOUT_NS = 2'000'000'000;
+	static constexpr VkDeviceSize STAGING_CHUNK_SIZE = 32 * 1024 * 1024;
 	static constexpr std::string_view VALIDATION_LAYER = "VK_LAYER_KHRONOS_validation";
 
+	// Marks a cached DeviceInfo::format_features entry, FormatFeature never uses the top bit
+	static constexpr u32 FORMAT_FEATURES_CACHED = 1u << 31;
+
+	// Indexed by Nova::RenderFeature
+	static constexpr std::string_view FEATURE_NAME_MAP[] = {
+		"multi draw indirect",
+		"draw indirect first instance",
+		"draw indirect count",
+		"sampler anisotropy",
+		"BC texture compression",
+		"ASTC texture compression",
+		"shader int64",
+		"shader float16",
+		"timeline semaphore",
+		"descriptor indexing",
+		"synchronization2",
+		"buffer device address",
+		"dynamic rendering",
+		"extended dynamic state",
+		"memory budget",
+		"mesh shader",
+		"fill mode non-solid",
+		"depth clamp",
+		"wide lines",
+	};
+
+	// Device extension needed on a Vulkan 1.2 device, indexed by Nova::RenderFeature
+	static constexpr const char* FEATURE_EXTENSION_MAP[] = {
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
+		nullptr,
+		VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+		VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+		VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+		VK_EXT_MESH_SHADER_EXTENSION_NAME,
+		nullptr,
+		nullptr,
+		nullptr,
+	};
+
+	static_assert(std::size(FEATURE_NAME_MAP) == static_cast<usize>(Nova::RenderFeature::MAX));
+	static_assert(std::size(FEATURE_EXTENSION_MAP) == static_cast<usize>(Nova::RenderFeature::MAX));
+
 	static constexpr VkShaderStageFlagBits VK_SHADER_STAGE_MAP[] = {
 		VK_SHADER_STAGE_VERTEX_BIT,
 		VK_SHADER_STAGE_FRAGMENT_BIT,
@@ -37,6 +99,9 @@ namespace {
 		VK_SHADER_STAGE_TASK_BIT_EXT
 	};
 
+	static constexpr VkShaderStageFlags MESH_PIPELINE_STAGES = VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT
+		| VK_SHADER_STAGE_FRAGMENT_BIT;
+
 	static constexpr VkPrimitiveTopology VK_PRIMITIVE_TOPOLOGY_MAP[] = {
 		VK_PRIMITIVE_TOPOLOGY_POINT_LIST,
 		VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
@@ -61,6 +126,123 @@ namespace {
 		VK_VERTEX_INPUT_RATE_INSTANCE,
 	};
 
+	// Indexed by bit position in Nova::BufferUsage
+	static constexpr VkBufferUsageFlagBits VK_BUFFER_USAGE_MAP[] = {
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+		VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+		VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+		VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+		VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+	};
+
+	// Indexed by Nova::BufferAccess
+	static constexpr VkPipelineStageFlags VK_BUFFER_ACCESS_STAGE_MAP[] = {
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+		VK_PIPELINE_STAGE_TASK_SHADER_BIT_EXT | VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT,
+		VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+		VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+		VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+		VK_PIPELINE_STAGE_HOST_BIT,
+		VK_PIPELINE_STAGE_HOST_BIT,
+	};
+	static constexpr VkAccessFlags VK_BUFFER_ACCESS_MASK_MAP[] = {
+		VK_ACCESS_TRANSFER_READ_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT,
+		VK_ACCESS_SHADER_READ_BIT,
+		VK_ACCESS_SHADER_WRITE_BIT,
+		VK_ACCESS_SHADER_READ_BIT,
+		VK_ACCESS_SHADER_READ_BIT,
+		VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+		VK_ACCESS_INDEX_READ_BIT,
+		VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+		VK_ACCESS_HOST_READ_BIT,
+		VK_ACCESS_HOST_WRITE_BIT,
+	};
+
+	static constexpr VkIndexType VK_INDEX_TYPE_MAP[] = {
+		VK_INDEX_TYPE_UINT16,
+		VK_INDEX_TYPE_UINT32,
+	};
+
+	// Image usage and the format support it needs, indexed by bit position in Nova::TextureUsage
+	static constexpr VkImageUsageFlagBits VK_TEXTURE_USAGE_MAP[] = {
+		VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+		VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+		VK_IMAGE_USAGE_SAMPLED_BIT,
+		VK_IMAGE_USAGE_STORAGE_BIT,
+		VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+		VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+	};
+	static constexpr Nova::FormatFeature TEXTURE_USAGE_FEATURE_MAP[] = {
+		Nova::FormatFeature::TRANSFER_SRC,
+		Nova::FormatFeature::TRANSFER_DST,
+		Nova::FormatFeature::SAMPLED,
+		Nova::FormatFeature::STORAGE,
+		Nova::FormatFeature::COLOR_ATTACHMENT,
+		Nova::FormatFeature::DEPTH_STENCIL_ATTACHMENT,
+	};
+
+	static_assert(std::size(VK_TEXTURE_USAGE_MAP) == std::size(TEXTURE_USAGE_FEATURE_MAP));
+
+	// Optimal tiling features, indexed by bit position in Nova::FormatFeature up to VERTEX_BUFFER
+	static constexpr VkFormatFeatureFlagBits VK_FORMAT_FEATURE_MAP[] = {
+		VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT,
+		VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT,
+		VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT,
+		VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT,
+		VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT,
+		VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT,
+		VK_FORMAT_FEATURE_BLIT_SRC_BIT,
+		VK_FORMAT_FEATURE_BLIT_DST_BIT,
+		VK_FORMAT_FEATURE_TRANSFER_SRC_BIT,
+		VK_FORMAT_FEATURE_TRANSFER_DST_BIT,
+	};
+
+	// Indexed by Nova::TextureAccess
+	static constexpr VkPipelineStageFlags VK_TEXTURE_ACCESS_STAGE_MAP[] = {
+		VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+	};
+	static constexpr VkAccessFlags VK_TEXTURE_ACCESS_MASK_MAP[] = {
+		0,
+		VK_ACCESS_TRANSFER_READ_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT,
+		VK_ACCESS_SHADER_READ_BIT,
+		VK_ACCESS_SHADER_WRITE_BIT,
+		VK_ACCESS_SHADER_READ_BIT,
+	};
+	static constexpr VkImageLayout VK_TEXTURE_ACCESS_LAYOUT_MAP[] = {
+		VK_IMAGE_LAYOUT_UNDEFINED,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_IMAGE_LAYOUT_GENERAL,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+	};
+
+	// Required and preferred memory properties, indexed by Nova::MemoryUsage
+	static constexpr VkMemoryPropertyFlags VK_MEMORY_REQUIRED_MAP[] = {
+		0,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+	};
+	static constexpr VkMemoryPropertyFlags VK_MEMORY_PREFERRED_MAP[] = {
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+		0,
+		VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+	};
+
 	static constexpr VkQueueFlagBits VK_QUEUE_FLAGS_MAP[] = {
 		static_cast<VkQueueFlagBits>(0),
 		VK_QUEUE_GRAPHICS_BIT,
@@ -289,23 +471,127 @@ namespace {
 		VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,
 		VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM
 	};
+
+	static_assert(std::size(VK_FORMAT_MAP) == static_cast<usize>(Nova::DataFormat::MAX));
+
+	static VkImageAspectFlags get_aspect_mask(const Nova::DataFormatInfo& p_info) {
+		VkImageAspectFlags aspect = 0;
+		if (p_info.has(Nova::FormatFlags::DEPTH)) {
+			aspect |= VK_IMAGE_ASPECT_DEPTH_BIT;
+		}
+		if (p_info.has(Nova::FormatFlags::STENCIL)) {
+			aspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+		}
+		return aspect ? aspect : VK_IMAGE_ASPECT_COLOR_BIT;
+	}
+
+	static void record_texture_barrier(
+		VkCommandBuffer p_command_buffer,
+		const Nova::Texture& p_texture,
+		const u32 p_base_level,
+		const u32 p_level_count,
+		const Nova::TextureAccess p_src,
+		const Nova::TextureAccess p_dst
+	) {
+		NOVA_ASSERT(p_dst != Nova::TextureAccess::UNDEFINED);
+
+		VkImageMemoryBarrier barrier {};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_TEXTURE_ACCESS_MASK_MAP[static_cast<int>(p_src)];
+		barrier.dstAccessMask = VK_TEXTURE_ACCESS_MASK_MAP[static_cast<int>(p_dst)];
+		barrier.oldLayout = VK_TEXTURE_ACCESS_LAYOUT_MAP[static_cast<int>(p_src)];
+		barrier.newLayout = VK_TEXTURE_ACCESS_LAYOUT_MAP[static_cast<int>(p_dst)];
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = p_texture.image;
+		barrier.subresourceRange.aspectMask = p_texture.aspect;
+		barrier.subresourceRange.baseMipLevel = p_base_level;
+		barrier.subresourceRange.levelCount = p_level_count;
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = 1;
+
+		vkCmdPipelineBarrier(
+			p_command_buffer,
+			VK_TEXTURE_ACCESS_STAGE_MAP[static_cast<int>(p_src)],
+			VK_TEXTURE_ACCESS_STAGE_MAP[static_cast<int>(p_dst)],
+			0,
+			0,
+			nullptr,
+			0,
+			nullptr,
+			1,
+			&barrier
+		);
+	}
+
+	// Host memory the driver allocates for the engine's objects is counted as MemoryTag::DRIVER
+	static VKAPI_ATTR void* VKAPI_CALL
+	allocate_host(void*, const size_t p_size, const size_t p_alignment, VkSystemAllocationScope) {
+		return Nova::MemoryTracker::allocate(p_size, p_alignment, Nova::MemoryTag::DRIVER);
+	}
+
+	static VKAPI_ATTR void* VKAPI_CALL reallocate_host(
+		void*,
+		void* p_original,
+		const size_t p_size,
+		const size_t p_alignment,
+		VkSystemAllocationScope
+	) {
+		return Nova::MemoryTracker::reallocate(p_original, p_size, p_alignment, Nova::MemoryTag::DRIVER);
+	}
+
+	static VKAPI_ATTR void VKAPI_CALL free_host(void*, void* p_memory) {
+		Nova::MemoryTracker::deallocate(p_memory);
+	}
+
+	// Memory the driver allocates itself, e.g. for executable code, and only reports
+	static VKAPI_ATTR void VKAPI_CALL
+	report_internal_allocation(void*, const size_t p_size, VkInternalAllocationType, VkSystemAllocationScope) {
+		Nova::MemoryTracker::record_allocation(Nova::MemoryTag::DRIVER, p_size);
+	}
+
+	static VKAPI_ATTR void VKAPI_CALL
+	report_internal_free(void*, const size_t p_size, VkInternalAllocationType, VkSystemAllocationScope) {
+		Nova::MemoryTracker::record_free(Nova::MemoryTag::DRIVER, p_size);
+	}
+
+	static constexpr VkAllocationCallbacks TRACKED_ALLOCATOR = {
+		.pUserData = nullptr,
+		.pfnAllocation = &allocate_host,
+		.pfnReallocation = &reallocate_host,
+		.pfnFree = &free_host,
+		.pfnInternalAllocation = &report_internal_allocation,
+		.pfnInternalFree = &report_internal_free,
+	};
 } // namespace
 
 using namespace Nova;
 
 VulkanRenderDriver::VulkanRenderDriver(WindowDriver* p_driver) : m_window_driver(p_driver) {
 	NOVA_AUTO_TRACE();
-	_check_version();
-	_check_extensions();
-	_check_layers();
-	_init_instance();
-	_init_hardware();
+	{
+		NOVA_SCOPED_TIMER("Vulkan version check");
+		_check_version();
+	}
+	{
+		NOVA_SCOPED_TIMER("Vulkan extension and layer check");
+		_check_extensions();
+		_check_layers();
+	}
+	{
+		NOVA_SCOPED_TIMER("Vulkan instance creation");
+		_init_instance();
+	}
+	{
+		NOVA_SCOPED_TIMER("Vulkan device enumeration");
+		_init_hardware();
+	}
 }
 
 VulkanRenderDriver::~VulkanRenderDriver() {
 	NOVA_AUTO_TRACE();
-	if (m_device) {
-		vkDestroyDevice(m_device, get_allocator(VK_OBJECT_TYPE_DEVICE));
+	while (!m_open_devices.empty()) {
+		close_device(m_open_devices.back());
 	}
 	if (m_instance) {
 		vkDestroyInstance(m_instance, get_allocator(VK_OBJECT_TYPE_INSTANCE));
@@ -343,6 +629,7 @@ u32 VulkanRenderDriver::get_device_count() const {
 
 const RenderDevice& VulkanRenderDriver::get_device(const u32 p_index) const {
 	NOVA_ASSERT(p_index < m_devices.size());
+	std::call_once(m_device_info[p_index].described_once, &VulkanRenderDriver::_describe_device, this, p_index);
 	return m_devices[p_index];
 }
 
@@ -352,9 +639,7 @@ bool VulkanRenderDriver::get_device_supports_surface(const u32 p_index, SurfaceI
 	NOVA_ASSERT(p_surface);
 
 	VkPhysicalDevice physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
-
-	u32 count;
-	vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+	const u32 count = static_cast<u32>(_get_device_queue_families(p_index).size());
 
 	for (u32 i = 0; i < count; i++) {
 		VkBool32 supports_present = VK_FALSE;
@@ -370,65 +655,325 @@ bool VulkanRenderDriver::get_device_supports_surface(const u32 p_index, SurfaceI
 	return false;
 }
 
-void VulkanRenderDriver::select_device(const u32 p_index) {
-	NOVA_AUTO_TRACE();
-	NOVA_ASSERT(!m_device);
+FormatFeature VulkanRenderDriver::get_format_features(const u32 p_index, const DataFormat p_format) const {
 	NOVA_ASSERT(p_index < m_devices.size());
+	NOVA_ASSERT(static_cast<usize>(p_format) < std::size(VK_FORMAT_MAP));
 
-	NOVA_INFO("Using device: {}", m_devices[p_index].name);
-	m_physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
+	// Racing threads at worst query the same format twice and store the same bits
+	std::atomic<u32>& cached = m_device_info[p_index].format_features[static_cast<int>(p_format)];
+	if (const u32 bits = cached.load(std::memory_order_relaxed); bits & FORMAT_FEATURES_CACHED) {
+		return static_cast<FormatFeature>(bits & ~FORMAT_FEATURES_CACHED);
+	}
+
+	VkFormatProperties properties {};
+	vkGetPhysicalDeviceFormatProperties(
+		static_cast<VkPhysicalDevice>(m_devices[p_index].handle),
+		VK_FORMAT_MAP[static_cast<int>(p_format)],
+		&properties
+	);
 
-	_check_device_extensions();
-	_check_device_features();
-	_check_device_capabilities();
+	u32 features = 0;
+	for (u32 i = 0; i < std::size(VK_FORMAT_FEATURE_MAP); i++) {
+		if (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_MAP[i]) {
+			features |= 1u << i;
+		}
+	}
+	if (properties.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) {
+		features |= static_cast<u32>(FormatFeature::VERTEX_BUFFER);
+	}
 
-	std::vector<VkDeviceQueueCreateInfo> queues;
-	_init_queues(queues);
-	_init_device(queues);
+	cached.store(features | FORMAT_FEATURES_CACHED, std::memory_order_relaxed);
+	return static_cast<FormatFeature>(features);
 }
 
-u32 VulkanRenderDriver::choose_queue_family(QueueType p_type, SurfaceID p_surface) {
+f64 VulkanRenderDriver::probe_device(const u32 p_index) {
 	NOVA_AUTO_TRACE();
-	NOVA_ASSERT(!m_queue_families.empty());
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(p_index < m_devices.size());
 
-	const VkQueueFlags mask = VK_QUEUE_FLAGS_MAP[static_cast<int>(p_type)];
+	DeviceInfo& info = m_device_info[p_index];
+	if (info.probe_bandwidth) {
+		return *info.probe_bandwidth;
+	}
+	info.probe_bandwidth = 0.0;
 
-	u32 best_index = std::numeric_limits<u32>::max();
-	u32 best_score = std::numeric_limits<u32>::max();
+	NOVA_SCOPED_TIMER("Vulkan device probe");
+	VkPhysicalDevice physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
 
-	for (const auto [index, flags] : m_queue_families) {
-		if ((flags & mask) != mask) {
-			continue;
+	// Graphics and compute families always support transfers
+	const auto& families = _get_device_queue_families(p_index);
+	u32 family = std::numeric_limits<u32>::max();
+	for (u32 i = 0; i < families.size(); i++) {
+		if (families[i].queueCount && (families[i].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+			family = i;
+			break;
 		}
-		if (p_surface) {
-			VkBool32 supports_present = VK_FALSE;
-			if (vkGetPhysicalDeviceSurfaceSupportKHR(m_physical_device, index, p_surface->handle, &supports_present)
-				!= VK_SUCCESS) {
+	}
+	if (family == std::numeric_limits<u32>::max()) {
+		return 0.0;
+	}
+
+	const float priority = 1.0f;
+	VkDeviceQueueCreateInfo queue_create {};
+	queue_create.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+	queue_create.queueFamilyIndex = family;
+	queue_create.queueCount = 1;
+	queue_create.pQueuePriorities = &priority;
+
+	VkDeviceCreateInfo device_create {};
+	device_create.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+	device_create.queueCreateInfoCount = 1;
+	device_create.pQueueCreateInfos = &queue_create;
+
+	VkDevice device = VK_NULL_HANDLE;
+	if (vkCreateDevice(physical_device, &device_create, get_allocator(VK_OBJECT_TYPE_DEVICE), &device) != VK_SUCCESS) {
+		NOVA_WARN("Failed to create probe device for {}", m_devices[p_index].name);
+		return 0.0;
+	}
+
+	VkQueue queue;
+	vkGetDeviceQueue(device, family, 0, &queue);
+
+	const auto& memory_properties = _get_device_memory_properties(p_index);
+	VkBuffer buffers[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+	VkDeviceMemory memory[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+	VkCommandPool pool = VK_NULL_HANDLE;
+	VkFence fence = VK_NULL_HANDLE;
+	bool ok = true;
+
+	for (u32 i = 0; i < 2 && ok; i++) {
+		VkBufferCreateInfo buffer_create {};
+		buffer_create.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		buffer_create.size = PROBE_BUFFER_SIZE;
+		buffer_create.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+		buffer_create.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		ok = vkCreateBuffer(device, &buffer_create, get_allocator(VK_OBJECT_TYPE_BUFFER), &buffers[i]) == VK_SUCCESS;
+		if (!ok) {
+			break;
+		}
+
+		VkMemoryRequirements requirements;
+		vkGetBufferMemoryRequirements(device, buffers[i], &requirements);
+
+		u32 type = std::numeric_limits<u32>::max();
+		for (u32 j = 0; j < memory_properties.memoryTypeCount; j++) {
+			if (!(requirements.memoryTypeBits & (1u << j))) {
 				continue;
 			}
-			if (!supports_present) {
-				continue;
+			if (type == std::numeric_limits<u32>::max()
+				|| (memory_properties.memoryTypes[j].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
+				type = j;
+				if (memory_properties.memoryTypes[j].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) {
+					break;
+				}
 			}
 		}
 
-		u32 score = std::popcount(flags);
-		if (score < best_score) {
-			best_index = index;
-			best_score = score;
+		VkMemoryAllocateInfo alloc {};
+		alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		alloc.allocationSize = requirements.size;
+		alloc.memoryTypeIndex = type;
+		ok = type != std::numeric_limits<u32>::max()
+			&& _allocate_memory(device, alloc, memory[i]) == VK_SUCCESS
+			&& vkBindBufferMemory(device, buffers[i], memory[i], 0) == VK_SUCCESS;
+	}
+
+	VkCommandBuffer cmd = VK_NULL_HANDLE;
+	if (ok) {
+		VkCommandPoolCreateInfo pool_create {};
+		pool_create.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		pool_create.queueFamilyIndex = family;
+		ok = vkCreateCommandPool(device, &pool_create, get_allocator(VK_OBJECT_TYPE_COMMAND_POOL), &pool) == VK_SUCCESS;
+	}
+	if (ok) {
+		VkCommandBufferAllocateInfo cmd_alloc {};
+		cmd_alloc.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		cmd_alloc.commandPool = pool;
+		cmd_alloc.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		cmd_alloc.commandBufferCount = 1;
+		ok = vkAllocateCommandBuffers(device, &cmd_alloc, &cmd) == VK_SUCCESS;
+	}
+	if (ok) {
+		VkFenceCreateInfo fence_create {};
+		fence_create.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		ok = vkCreateFence(device, &fence_create, get_allocator(VK_OBJECT_TYPE_FENCE), &fence) == VK_SUCCESS;
+	}
+
+	if (ok) {
+		VkCommandBufferBeginInfo begin {};
+		begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		vkBeginCommandBuffer(cmd, &begin);
+
+		VkBufferCopy region {};
+		region.size = PROBE_BUFFER_SIZE;
+
+		VkMemoryBarrier barrier {};
+		barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+		// Ping-pong between the buffers so every copy depends on the previous one
+		for (u32 i = 0; i < PROBE_COPY_COUNT; i++) {
+			vkCmdCopyBuffer(cmd, buffers[i % 2], buffers[(i + 1) % 2], 1, &region);
+			vkCmdPipelineBarrier(
+				cmd,
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				0,
+				1,
+				&barrier,
+				0,
+				nullptr,
+				0,
+				nullptr
+			);
+		}
+		vkEndCommandBuffer(cmd);
+
+		VkSubmitInfo submit {};
+		submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submit.commandBufferCount = 1;
+		submit.pCommandBuffers = &cmd;
+
+		const auto start = std::chrono::steady_clock::now();
+		ok = vkQueueSubmit(queue, 1, &submit, fence) == VK_SUCCESS
+			&& vkWaitForFences(device, 1, &fence, VK_TRUE, PROBE_TIMEOUT_NS) == VK_SUCCESS;
+		const std::chrono::duration<f64> elapsed = std::chrono::steady_clock::now() - start;
+
+		if (ok && elapsed.count() > 0.0) {
+			info.probe_bandwidth = static_cast<f64>(PROBE_BUFFER_SIZE) * PROBE_COPY_COUNT / elapsed.count();
 		}
 	}
 
-	return best_index;
+	if (!ok) {
+		NOVA_WARN("Device probe failed for {}", m_devices[p_index].name);
+	}
+
+	vkDeviceWaitIdle(device);
+	if (fence) {
+		vkDestroyFence(device, fence, get_allocator(VK_OBJECT_TYPE_FENCE));
+	}
+	if (pool) {
+		vkDestroyCommandPool(device, pool, get_allocator(VK_OBJECT_TYPE_COMMAND_POOL));
+	}
+	for (u32 i = 0; i < 2; i++) {
+		if (buffers[i]) {
+			vkDestroyBuffer(device, buffers[i], get_allocator(VK_OBJECT_TYPE_BUFFER));
+		}
+		if (memory[i]) {
+			_free_memory(device, memory[i]);
+		}
+	}
+	vkDestroyDevice(device, get_allocator(VK_OBJECT_TYPE_DEVICE));
+
+	NOVA_INFO("Device probe: {} copies {:.2f} GB/s", m_devices[p_index].name, *info.probe_bandwidth / 1e9);
+	return *info.probe_bandwidth;
+}
+
+DeviceID VulkanRenderDriver::open_device(
+	const u32 p_index,
+	const RenderFeatureSet& p_required,
+	const RenderFeatureSet& p_optional
+) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(p_index < m_devices.size());
+
+	NOVA_SCOPED_TIMER("Vulkan device selection");
+
+	NOVA_INFO("Using device: {}", m_devices[p_index].name);
+	Device* device = new Device();
+	device->index = p_index;
+	device->physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
+	device->memory_properties = _get_device_memory_properties(p_index);
+
+	try {
+		FeatureChain chain = {};
+		_check_device_capabilities(*device);
+		_check_device_features(*device, chain, p_required, p_optional);
+		_check_device_extensions(*device);
+
+		std::vector<VkDeviceQueueCreateInfo> queues;
+		_init_queues(*device, queues);
+		{
+			NOVA_SCOPED_TIMER("Vulkan device creation");
+			_init_device(*device, chain, queues);
+		}
+	} catch (...) {
+		delete device;
+		throw;
+	}
+
+	m_open_devices.push_back(device);
+	if (!m_current_device) {
+		m_current_device = device;
+	}
+	return device;
+}
+
+void VulkanRenderDriver::close_device(DeviceID p_device) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_device);
+
+	auto it = std::find(m_open_devices.begin(), m_open_devices.end(), p_device);
+	NOVA_ASSERT(it != m_open_devices.end());
+	m_open_devices.erase(it);
+
+	vkDeviceWaitIdle(p_device->handle); // TODO: Check result
+	if (p_device->transfer_fence) {
+		vkDestroyFence(p_device->handle, p_device->transfer_fence, get_allocator(VK_OBJECT_TYPE_FENCE));
+	}
+	if (p_device->transfer_pool) {
+		vkDestroyCommandPool(p_device->handle, p_device->transfer_pool, get_allocator(VK_OBJECT_TYPE_COMMAND_POOL));
+	}
+	vkDestroyDevice(p_device->handle, get_allocator(VK_OBJECT_TYPE_DEVICE));
+
+	if (m_current_device == p_device) {
+		m_current_device = m_open_devices.empty() ? nullptr : m_open_devices.front();
+	}
+	delete p_device;
+}
+
+void VulkanRenderDriver::set_current_device(DeviceID p_device) {
+	NOVA_ASSERT(p_device);
+	NOVA_ASSERT(std::find(m_open_devices.begin(), m_open_devices.end(), p_device) != m_open_devices.end());
+	m_current_device = p_device;
+}
+
+DeviceID VulkanRenderDriver::get_current_device() const {
+	return m_current_device;
+}
+
+u32 VulkanRenderDriver::get_device_index(DeviceID p_device) const {
+	NOVA_ASSERT(p_device);
+	return p_device->index;
+}
+
+const RenderFeatureSet& VulkanRenderDriver::get_enabled_features() const {
+	NOVA_ASSERT(m_current_device);
+	return m_current_device->enabled_features;
+}
+
+bool VulkanRenderDriver::has_feature(const RenderFeature p_feature) const {
+	NOVA_ASSERT(m_current_device);
+	return m_current_device->enabled_features.has(p_feature);
+}
+
+u32 VulkanRenderDriver::choose_queue_family(QueueType p_type, SurfaceID p_surface) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(m_current_device);
+	return _choose_queue_family(*m_current_device, p_type, p_surface);
 }
 
 QueueID VulkanRenderDriver::get_queue(u32 p_queue_family) {
 	NOVA_AUTO_TRACE();
-	NOVA_ASSERT(!m_queues.empty());
+	NOVA_ASSERT(m_current_device);
 
 	QueueID best_queue = nullptr;
 	u32 best_usage = std::numeric_limits<u32>::max();
 
-	for (Queue& queue : m_queues) {
+	for (Queue& queue : m_current_device->queues) {
 		if (queue.family_index != p_queue_family) {
 			continue;
 		}
@@ -467,15 +1012,20 @@ void VulkanRenderDriver::destroy_surface(SurfaceID p_surface) {
 
 SwapchainID VulkanRenderDriver::create_swapchain(SurfaceID p_surface) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
 	NOVA_ASSERT(p_surface);
 
+	Device& device = *m_current_device;
 	Swapchain* swapchain = new Swapchain();
 	swapchain->surface = p_surface;
+	swapchain->device = m_current_device;
 
+	ScratchScope scratch;
 	u32 count;
-	vkGetPhysicalDeviceSurfaceFormatsKHR(m_physical_device, p_surface->handle, &count, nullptr); // TODO: Check result
-	std::vector<VkSurfaceFormatKHR> formats(count);
-	vkGetPhysicalDeviceSurfaceFormatsKHR(m_physical_device, p_surface->handle, &count, formats.data()); // TODO: Check result
+	vkGetPhysicalDeviceSurfaceFormatsKHR(device.physical_device, p_surface->handle, &count, nullptr); // TODO: Check result
+	std::pmr::vector<VkSurfaceFormatKHR> formats(count, scratch.get_resource());
+	vkGetPhysicalDeviceSurfaceFormatsKHR(device.physical_device, p_surface->handle, &count, formats.data()); // TODO: Check result
 
 	const VkFormat preferred_format = VK_FORMAT_B8G8R8A8_UNORM; // TODO: Get from config?
 	const VkFormat fallback_format = VK_FORMAT_R8G8B8A8_UNORM; // TODO: Get from config?
@@ -526,7 +1076,13 @@ SwapchainID VulkanRenderDriver::create_swapchain(SurfaceID p_surface) {
 	pass_create.pSubpasses = &subpass;
 
 	swapchain->render_pass = new RenderPass();
-	if (vkCreateRenderPass(m_device, &pass_create, get_allocator(VK_OBJECT_TYPE_RENDER_PASS), &swapchain->render_pass->handle)
+	swapchain->render_pass->device = m_current_device;
+	if (vkCreateRenderPass(
+			device.handle,
+			&pass_create,
+			get_allocator(VK_OBJECT_TYPE_RENDER_PASS),
+			&swapchain->render_pass->handle
+		)
 		!= VK_SUCCESS) {
 		throw std::runtime_error("Failed to create render pass");
 	}
@@ -539,14 +1095,14 @@ SwapchainID VulkanRenderDriver::create_swapchain(SurfaceID p_surface) {
 
 void VulkanRenderDriver::resize_swapchain(SwapchainID p_swapchain) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
 	NOVA_ASSERT(p_swapchain);
 
+	const Device& device = *p_swapchain->device;
 	Surface* surface = p_swapchain->surface;
 
-	// TODO: Release old swapchain resources
-
 	VkSurfaceCapabilitiesKHR capabilities;
-	if (vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_physical_device, surface->handle, &capabilities) != VK_SUCCESS) {
+	if (vkGetPhysicalDeviceSurfaceCapabilitiesKHR(device.physical_device, surface->handle, &capabilities) != VK_SUCCESS) {
 		throw std::runtime_error("Failed to get surface capabilities");
 	}
 
@@ -570,16 +1126,17 @@ void VulkanRenderDriver::resize_swapchain(SwapchainID p_swapchain) {
 		image_count = capabilities.maxImageCount;
 	}
 
+	ScratchScope scratch;
 	u32 present_mode_count;
 	vkGetPhysicalDeviceSurfacePresentModesKHR(
-		m_physical_device,
+		device.physical_device,
 		surface->handle,
 		&present_mode_count,
 		nullptr
 	); // TODO: Check result
-	std::vector<VkPresentModeKHR> present_modes(present_mode_count);
+	std::pmr::vector<VkPresentModeKHR> present_modes(present_mode_count, scratch.get_resource());
 	vkGetPhysicalDeviceSurfacePresentModesKHR(
-		m_physical_device,
+		device.physical_device,
 		surface->handle,
 		&present_mode_count,
 		present_modes.data()
@@ -606,16 +1163,24 @@ void VulkanRenderDriver::resize_swapchain(SwapchainID p_swapchain) {
 	swap_create.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR; // TODO: Support transparent windows
 	swap_create.presentMode = present_mode;
 	swap_create.clipped = VK_TRUE;
-	swap_create.oldSwapchain = VK_NULL_HANDLE; // TODO: Handle old swapchain
+	swap_create.oldSwapchain = p_swapchain->handle;
 
-	if (vkCreateSwapchainKHR(m_device, &swap_create, get_allocator(VK_OBJECT_TYPE_SWAPCHAIN_KHR), &p_swapchain->handle)
+	VkSwapchainKHR handle;
+	if (vkCreateSwapchainKHR(device.handle, &swap_create, get_allocator(VK_OBJECT_TYPE_SWAPCHAIN_KHR), &handle)
 		!= VK_SUCCESS) {
 		throw std::runtime_error("Failed to create swapchain");
 	}
 
-	vkGetSwapchainImagesKHR(m_device, p_swapchain->handle, &image_count, nullptr); // TODO: Check result
+	// The old swapchain is retired once passed as oldSwapchain, the caller has to make sure it is no longer in use
+	_release_swapchain_images(*p_swapchain);
+	if (p_swapchain->handle) {
+		vkDestroySwapchainKHR(device.handle, p_swapchain->handle, get_allocator(VK_OBJECT_TYPE_SWAPCHAIN_KHR));
+	}
+	p_swapchain->handle = handle;
+
+	vkGetSwapchainImagesKHR(device.handle, p_swapchain->handle, &image_count, nullptr); // TODO: Check result
 	p_swapchain->images.resize(image_count);
-	vkGetSwapchainImagesKHR(m_device, p_swapchain->handle, &image_count, p_swapchain->images.data()); // TODO: Check result
+	vkGetSwapchainImagesKHR(device.handle, p_swapchain->handle, &image_count, p_swapchain->images.data()); // TODO: Check result
 
 	VkImageViewCreateInfo view_create {};
 	view_create.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -634,7 +1199,12 @@ void VulkanRenderDriver::resize_swapchain(SwapchainID p_swapchain) {
 	p_swapchain->image_views.resize(image_count);
 	for (u32 i = 0; i < image_count; i++) {
 		view_create.image = p_swapchain->images[i];
-		if (vkCreateImageView(m_device, &view_create, get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW), &p_swapchain->image_views[i])
+		if (vkCreateImageView(
+				device.handle,
+				&view_create,
+				get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW),
+				&p_swapchain->image_views[i]
+			)
 			!= VK_SUCCESS) {
 			throw std::runtime_error("Failed to create image view");
 		}
@@ -652,7 +1222,7 @@ void VulkanRenderDriver::resize_swapchain(SwapchainID p_swapchain) {
 	for (u32 i = 0; i < image_count; i++) {
 		fb_create.pAttachments = &p_swapchain->image_views[i];
 		if (vkCreateFramebuffer(
-				m_device,
+				device.handle,
 				&fb_create,
 				get_allocator(VK_OBJECT_TYPE_FRAMEBUFFER),
 				&p_swapchain->framebuffers[i]
@@ -672,14 +1242,10 @@ void VulkanRenderDriver::destroy_swapchain(SwapchainID p_swapchain) {
 	NOVA_AUTO_TRACE();
 	NOVA_ASSERT(p_swapchain);
 
-	for (const auto& framebuffer : p_swapchain->framebuffers) {
-		vkDestroyFramebuffer(m_device, framebuffer, get_allocator(VK_OBJECT_TYPE_FRAMEBUFFER));
-	}
-	for (const auto& image_view : p_swapchain->image_views) {
-		vkDestroyImageView(m_device, image_view, get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW));
-	}
+	VkDevice device = p_swapchain->device->handle;
+	_release_swapchain_images(*p_swapchain);
 	if (p_swapchain->handle) {
-		vkDestroySwapchainKHR(m_device, p_swapchain->handle, get_allocator(VK_OBJECT_TYPE_SWAPCHAIN_KHR));
+		vkDestroySwapchainKHR(device, p_swapchain->handle, get_allocator(VK_OBJECT_TYPE_SWAPCHAIN_KHR));
 	}
 	if (p_swapchain->render_pass) {
 		destroy_render_pass(p_swapchain->render_pass);
@@ -688,77 +1254,623 @@ void VulkanRenderDriver::destroy_swapchain(SwapchainID p_swapchain) {
 	delete p_swapchain;
 }
 
-ShaderID VulkanRenderDriver::create_shader(const std::span<u8> p_bytes, ShaderStage p_stage) {
+RenderTargetID VulkanRenderDriver::create_render_target(const u32 p_width, const u32 p_height, const DataFormat p_format) {
 	NOVA_AUTO_TRACE();
-	NOVA_ASSERT(!p_bytes.empty());
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
+	NOVA_ASSERT(p_width > 0 && p_height > 0);
+
+	const DataFormatInfo& info = get_format_info(p_format);
+	const FormatFeature required = FormatFeature::COLOR_ATTACHMENT | FormatFeature::TRANSFER_SRC;
+	if (info.block_width != 1 || info.block_height != 1 || info.block_size == 0 || info.is_depth_stencil()
+		|| (get_format_features(m_current_device->index, p_format) & required) != required) {
+		throw std::runtime_error("Unsupported render target format");
+	}
 
-	Shader* shader = new Shader();
-	shader->stage = p_stage; // TODO: Get from shader code
-	shader->name = "main"; // TODO: Get from shader code
+	const VkFormat format = VK_FORMAT_MAP[static_cast<int>(p_format)];
+
+	const Device& device = *m_current_device;
+	RenderTarget* target = new RenderTarget();
+	target->device = m_current_device;
+	target->format = format;
+	target->width = p_width;
+	target->height = p_height;
+
+	VkImageCreateInfo image_create {};
+	image_create.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	image_create.imageType = VK_IMAGE_TYPE_2D;
+	image_create.format = format;
+	image_create.extent = {p_width, p_height, 1};
+	image_create.mipLevels = 1;
+	image_create.arrayLayers = 1;
+	image_create.samples = VK_SAMPLE_COUNT_1_BIT; // TODO: Support MSAA
+	image_create.tiling = VK_IMAGE_TILING_OPTIMAL;
+	image_create.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	image_create.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	image_create.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	if (vkCreateImage(device.handle, &image_create, get_allocator(VK_OBJECT_TYPE_IMAGE), &target->image) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to create render target image");
+	}
 
-	VkShaderModuleCreateInfo create {};
-	create.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-	create.codeSize = p_bytes.size();
-	create.pCode = reinterpret_cast<const u32*>(p_bytes.data());
+	VkMemoryRequirements requirements;
+	vkGetImageMemoryRequirements(device.handle, target->image, &requirements);
+
+	VkMemoryAllocateInfo alloc {};
+	alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc.allocationSize = requirements.size;
+	alloc.memoryTypeIndex = _find_memory_type(device, requirements.memoryTypeBits, 0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
-	if (vkCreateShaderModule(m_device, &create, get_allocator(VK_OBJECT_TYPE_SHADER_MODULE), &shader->handle)
+	if (_allocate_memory(device.handle, alloc, target->memory) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to allocate render target memory");
+	}
+	vkBindImageMemory(device.handle, target->image, target->memory, 0); // TODO: Check result
+
+	VkAttachmentDescription attachment {};
+	attachment.format = format;
+	attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+	attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+	attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+	attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+	attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	attachment.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+	VkAttachmentReference color_ref {};
+	color_ref.attachment = 0;
+	color_ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+	VkSubpassDescription subpass {};
+	subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+	subpass.colorAttachmentCount = 1;
+	subpass.pColorAttachments = &color_ref;
+
+	// Order the pass against readback copies of the previous and current contents
+	VkSubpassDependency dependencies[2] {};
+	dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+	dependencies[0].dstSubpass = 0;
+	dependencies[0].srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+	dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+	dependencies[0].srcAccessMask = 0;
+	dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+	dependencies[1].srcSubpass = 0;
+	dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+	dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+	dependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+	dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+	dependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+	VkRenderPassCreateInfo pass_create {};
+	pass_create.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+	pass_create.attachmentCount = 1;
+	pass_create.pAttachments = &attachment;
+	pass_create.subpassCount = 1;
+	pass_create.pSubpasses = &subpass;
+	pass_create.dependencyCount = 2;
+	pass_create.pDependencies = dependencies;
+
+	target->render_pass = new RenderPass();
+	target->render_pass->device = m_current_device;
+	if (vkCreateRenderPass(
+			device.handle,
+			&pass_create,
+			get_allocator(VK_OBJECT_TYPE_RENDER_PASS),
+			&target->render_pass->handle
+		)
 		!= VK_SUCCESS) {
-		throw std::runtime_error("Failed to create shader module");
+		throw std::runtime_error("Failed to create render pass");
 	}
 
-	return shader;
-}
+	VkImageViewCreateInfo view_create {};
+	view_create.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	view_create.image = target->image;
+	view_create.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	view_create.format = format;
+	view_create.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	view_create.subresourceRange.baseMipLevel = 0;
+	view_create.subresourceRange.levelCount = 1;
+	view_create.subresourceRange.baseArrayLayer = 0;
+	view_create.subresourceRange.layerCount = 1;
 
-void VulkanRenderDriver::destroy_shader(ShaderID p_shader) {
-	NOVA_AUTO_TRACE();
-	NOVA_ASSERT(p_shader);
-	if (p_shader->handle) {
-		vkDestroyShaderModule(m_device, p_shader->handle, get_allocator(VK_OBJECT_TYPE_SHADER_MODULE));
+	if (vkCreateImageView(device.handle, &view_create, get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW), &target->view) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to create image view");
 	}
-	delete p_shader;
+
+	VkFramebufferCreateInfo fb_create {};
+	fb_create.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+	fb_create.renderPass = target->render_pass->handle;
+	fb_create.attachmentCount = 1;
+	fb_create.pAttachments = &target->view;
+	fb_create.width = p_width;
+	fb_create.height = p_height;
+	fb_create.layers = 1;
+
+	if (vkCreateFramebuffer(device.handle, &fb_create, get_allocator(VK_OBJECT_TYPE_FRAMEBUFFER), &target->framebuffer)
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to create framebuffer");
+	}
+
+	target->readback_size = info.get_size(p_width, p_height);
+	_create_buffer(
+		device,
+		target->readback_size,
+		VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+		target->readback_buffer,
+		target->readback_memory
+	);
+
+	if (vkMapMemory(device.handle, target->readback_memory, 0, VK_WHOLE_SIZE, 0, &target->readback_data) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to map readback memory");
+	}
+
+	return target;
 }
 
-RenderPassID VulkanRenderDriver::create_render_pass(RenderPassParams& p_params) {
-	NOVA_AUTO_TRACE();
-	NOVA_WARN("{}() not implemented", NOVA_FUNC_NAME);
-	RenderPass* render_pass = new RenderPass();
-	(void)p_params;
-	return render_pass;
+RenderPassID VulkanRenderDriver::get_render_target_render_pass(RenderTargetID p_render_target) const {
+	NOVA_ASSERT(p_render_target);
+	return p_render_target->render_pass;
 }
 
-void VulkanRenderDriver::destroy_render_pass(RenderPassID p_render_pass) {
+std::span<const u8> VulkanRenderDriver::get_render_target_data(RenderTargetID p_render_target) const {
+	NOVA_ASSERT(p_render_target);
+	return {static_cast<const u8*>(p_render_target->readback_data), p_render_target->readback_size};
+}
+
+void VulkanRenderDriver::destroy_render_target(RenderTargetID p_render_target) {
 	NOVA_AUTO_TRACE();
-	NOVA_ASSERT(p_render_pass);
-	if (p_render_pass->handle) {
-		vkDestroyRenderPass(m_device, p_render_pass->handle, get_allocator(VK_OBJECT_TYPE_RENDER_PASS));
+	NOVA_ASSERT(p_render_target);
+
+	VkDevice device = p_render_target->device->handle;
+	if (p_render_target->readback_data) {
+		vkUnmapMemory(device, p_render_target->readback_memory);
 	}
-	delete p_render_pass;
+	if (p_render_target->readback_buffer) {
+		vkDestroyBuffer(device, p_render_target->readback_buffer, get_allocator(VK_OBJECT_TYPE_BUFFER));
+	}
+	if (p_render_target->readback_memory) {
+		_free_memory(device, p_render_target->readback_memory);
+	}
+	if (p_render_target->framebuffer) {
+		vkDestroyFramebuffer(device, p_render_target->framebuffer, get_allocator(VK_OBJECT_TYPE_FRAMEBUFFER));
+	}
+	if (p_render_target->view) {
+		vkDestroyImageView(device, p_render_target->view, get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW));
+	}
+	if (p_render_target->image) {
+		vkDestroyImage(device, p_render_target->image, get_allocator(VK_OBJECT_TYPE_IMAGE));
+	}
+	if (p_render_target->memory) {
+		_free_memory(device, p_render_target->memory);
+	}
+	if (p_render_target->render_pass) {
+		destroy_render_pass(p_render_target->render_pass);
+	}
+
+	delete p_render_target;
 }
 
-PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params) {
+TextureID VulkanRenderDriver::create_texture(const TextureParams& p_params) {
 	NOVA_AUTO_TRACE();
-	NOVA_ASSERT(p_params.render_pass);
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
+	NOVA_ASSERT(p_params.width > 0 && p_params.height > 0);
+
+	const u32 max_levels = static_cast<u32>(std::bit_width(std::max(p_params.width, p_params.height)));
+	const u32 mip_levels = p_params.mip_levels == 0 ? max_levels : p_params.mip_levels;
+	if (mip_levels > max_levels) {
+		throw std::runtime_error("Texture has more mip levels than its size allows");
+	}
 
-	std::vector<VkPipelineShaderStageCreateInfo> shader_stages;
-	for (const auto& shader : p_params.shaders) {
-		VkPipelineShaderStageCreateInfo stage_create {};
-		stage_create.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-		stage_create.stage = VK_SHADER_STAGE_MAP[static_cast<int>(shader->stage)];
-		stage_create.module = shader->handle;
-		stage_create.pName = shader->name.c_str();
-		// TODO: Get specialization info from shader
-		shader_stages.push_back(stage_create);
+	VkImageUsageFlags usage = 0;
+	FormatFeature required = FormatFeature::NONE;
+	for (u32 i = 0; i < std::size(VK_TEXTURE_USAGE_MAP); i++) {
+		if (static_cast<u32>(p_params.usage) & (1u << i)) {
+			usage |= VK_TEXTURE_USAGE_MAP[i];
+			required = required | TEXTURE_USAGE_FEATURE_MAP[i];
+		}
 	}
 
-	std::vector<VkVertexInputBindingDescription> vertex_bindings;
-	for (const auto& binding : p_params.bindings) {
-		VkVertexInputBindingDescription binding_desc {};
-		binding_desc.binding = binding.binding;
-		binding_desc.stride = binding.stride;
-		binding_desc.inputRate = VK_VERTEX_INPUT_RATE_MAP[static_cast<int>(binding.rate)];
+	if ((get_format_features(m_current_device->index, p_params.format) & required) != required) {
+		throw std::runtime_error("Texture format does not support the requested usage");
+	}
+
+	const Device& device = *m_current_device;
+	const VkFormat format = VK_FORMAT_MAP[static_cast<int>(p_params.format)];
+
+	Texture* texture = new Texture();
+	texture->aspect = get_aspect_mask(get_format_info(p_params.format));
+	texture->format = p_params.format;
+	texture->usage = p_params.usage;
+	texture->width = p_params.width;
+	texture->height = p_params.height;
+	texture->mip_levels = mip_levels;
+	texture->device = m_current_device;
+
+	VkImageCreateInfo image_create {};
+	image_create.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	image_create.imageType = VK_IMAGE_TYPE_2D;
+	image_create.format = format;
+	image_create.extent = {p_params.width, p_params.height, 1};
+	image_create.mipLevels = mip_levels;
+	image_create.arrayLayers = 1;
+	image_create.samples = VK_SAMPLE_COUNT_1_BIT;
+	image_create.tiling = VK_IMAGE_TILING_OPTIMAL;
+	image_create.usage = usage;
+	image_create.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	image_create.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	if (vkCreateImage(device.handle, &image_create, get_allocator(VK_OBJECT_TYPE_IMAGE), &texture->image) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to create texture image");
+	}
+
+	VkMemoryRequirements requirements;
+	vkGetImageMemoryRequirements(device.handle, texture->image, &requirements);
+
+	VkMemoryAllocateInfo alloc {};
+	alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc.allocationSize = requirements.size;
+	alloc.memoryTypeIndex = _find_memory_type(device, requirements.memoryTypeBits, 0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	if (_allocate_memory(device.handle, alloc, texture->memory) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to allocate texture memory");
+	}
+	vkBindImageMemory(device.handle, texture->image, texture->memory, 0); // TODO: Check result
+
+	VkImageViewCreateInfo view_create {};
+	view_create.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	view_create.image = texture->image;
+	view_create.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	view_create.format = format;
+	view_create.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+	view_create.subresourceRange.aspectMask = texture->aspect;
+	view_create.subresourceRange.baseMipLevel = 0;
+	view_create.subresourceRange.levelCount = mip_levels;
+	view_create.subresourceRange.baseArrayLayer = 0;
+	view_create.subresourceRange.layerCount = 1;
+
+	if (vkCreateImageView(device.handle, &view_create, get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW), &texture->view)
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to create texture image view");
+	}
+
+	return texture;
+}
+
+u32 VulkanRenderDriver::get_texture_mip_levels(TextureID p_texture) const {
+	NOVA_ASSERT(p_texture);
+	return p_texture->mip_levels;
+}
+
+void VulkanRenderDriver::destroy_texture(TextureID p_texture) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_texture);
+
+	VkDevice device = p_texture->device->handle;
+	if (p_texture->view) {
+		vkDestroyImageView(device, p_texture->view, get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW));
+	}
+	if (p_texture->image) {
+		vkDestroyImage(device, p_texture->image, get_allocator(VK_OBJECT_TYPE_IMAGE));
+	}
+	if (p_texture->memory) {
+		_free_memory(device, p_texture->memory);
+	}
+
+	delete p_texture;
+}
+
+BufferID VulkanRenderDriver::create_buffer(const u64 p_size, const BufferUsage p_usage, const MemoryUsage p_memory) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
+	NOVA_ASSERT(p_size > 0);
+
+	VkBufferUsageFlags usage = 0;
+	for (u32 i = 0; i < std::size(VK_BUFFER_USAGE_MAP); i++) {
+		if (static_cast<u32>(p_usage) & (1u << i)) {
+			usage |= VK_BUFFER_USAGE_MAP[i];
+		}
+	}
+
+	if ((usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+		&& !m_current_device->enabled_features.has(RenderFeature::BUFFER_DEVICE_ADDRESS)) {
+		throw std::runtime_error("Buffer device address is not enabled on this device");
+	}
+
+	Buffer* buffer = new Buffer();
+	buffer->size = p_size;
+	buffer->device = m_current_device;
+
+	const VkMemoryPropertyFlags flags = _create_buffer(
+		*m_current_device,
+		p_size,
+		usage,
+		VK_MEMORY_REQUIRED_MAP[static_cast<int>(p_memory)],
+		VK_MEMORY_PREFERRED_MAP[static_cast<int>(p_memory)],
+		buffer->handle,
+		buffer->memory
+	);
+
+	// Unified memory devices often hand out mappable memory even for GPU_ONLY buffers
+	buffer->host_visible = (flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && (flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+	if (usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
+		VkBufferDeviceAddressInfo info {};
+		info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+		info.buffer = buffer->handle;
+		buffer->address = vkGetBufferDeviceAddress(m_current_device->handle, &info);
+	}
+
+	return buffer;
+}
+
+void* VulkanRenderDriver::map_buffer(BufferID p_buffer) {
+	NOVA_ASSERT(p_buffer);
+	if (!p_buffer->host_visible) {
+		throw std::runtime_error("Buffer memory is not host visible");
+	}
+	if (!p_buffer->mapped
+		&& vkMapMemory(p_buffer->device->handle, p_buffer->memory, 0, VK_WHOLE_SIZE, 0, &p_buffer->mapped)
+			!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to map buffer memory");
+	}
+	return p_buffer->mapped;
+}
+
+void VulkanRenderDriver::unmap_buffer(BufferID p_buffer) {
+	NOVA_ASSERT(p_buffer);
+	if (p_buffer->mapped) {
+		vkUnmapMemory(p_buffer->device->handle, p_buffer->memory);
+		p_buffer->mapped = nullptr;
+	}
+}
+
+void VulkanRenderDriver::destroy_buffer(BufferID p_buffer) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_buffer);
+	unmap_buffer(p_buffer);
+	if (p_buffer->handle) {
+		vkDestroyBuffer(p_buffer->device->handle, p_buffer->handle, get_allocator(VK_OBJECT_TYPE_BUFFER));
+	}
+	if (p_buffer->memory) {
+		_free_memory(p_buffer->device->handle, p_buffer->memory);
+	}
+	delete p_buffer;
+}
+
+u64 VulkanRenderDriver::get_buffer_device_address(BufferID p_buffer) const {
+	NOVA_ASSERT(p_buffer);
+	NOVA_ASSERT(p_buffer->address);
+	return p_buffer->address;
+}
+
+void VulkanRenderDriver::copy_buffer_between_devices(
+	BufferID p_src,
+	BufferID p_dst,
+	const u64 p_size,
+	const u64 p_src_offset,
+	const u64 p_dst_offset
+) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_src);
+	NOVA_ASSERT(p_dst);
+	NOVA_ASSERT(p_src_offset + p_size <= p_src->size);
+	NOVA_ASSERT(p_dst_offset + p_size <= p_dst->size);
+
+	if (p_size == 0) {
+		return;
+	}
+
+	Device& src_device = *p_src->device;
+	Device& dst_device = *p_dst->device;
+	const VkDeviceSize chunk_size = std::min<VkDeviceSize>(p_size, STAGING_CHUNK_SIZE);
+
+	// Host visible buffers are accessed in place, the others go through a staging buffer on their own device
+	VkBuffer staging[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+	VkDeviceMemory staging_memory[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+	void* staging_data[2] = {nullptr, nullptr};
+
+	const bool src_mapped = p_src->mapped != nullptr;
+	const bool dst_mapped = p_dst->mapped != nullptr;
+	const u8* src_data = nullptr;
+	u8* dst_data = nullptr;
+
+	if (p_src->host_visible) {
+		src_data = static_cast<const u8*>(map_buffer(p_src)) + p_src_offset;
+	} else {
+		_create_buffer(
+			src_device,
+			chunk_size,
+			VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+			staging[0],
+			staging_memory[0]
+		);
+		vkMapMemory(src_device.handle, staging_memory[0], 0, VK_WHOLE_SIZE, 0, &staging_data[0]); // TODO: Check result
+	}
+
+	if (p_dst->host_visible) {
+		dst_data = static_cast<u8*>(map_buffer(p_dst)) + p_dst_offset;
+	} else {
+		_create_buffer(
+			dst_device,
+			chunk_size,
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			0,
+			staging[1],
+			staging_memory[1]
+		);
+		vkMapMemory(dst_device.handle, staging_memory[1], 0, VK_WHOLE_SIZE, 0, &staging_data[1]); // TODO: Check result
+	}
+
+	// TODO: Double buffer the staging memory so both devices can copy at the same time
+	for (u64 offset = 0; offset < p_size; offset += chunk_size) {
+		const VkDeviceSize size = std::min<VkDeviceSize>(chunk_size, p_size - offset);
+
+		const u8* chunk = nullptr;
+		if (src_data) {
+			chunk = src_data + offset;
+		} else {
+			VkBufferCopy region {};
+			region.srcOffset = p_src_offset + offset;
+			region.dstOffset = 0;
+			region.size = size;
+			_copy_buffer_immediate(src_device, p_src->handle, staging[0], region);
+			chunk = static_cast<const u8*>(staging_data[0]);
+		}
+
+		if (dst_data) {
+			std::memcpy(dst_data + offset, chunk, size);
+		} else {
+			std::memcpy(staging_data[1], chunk, size);
+			VkBufferCopy region {};
+			region.srcOffset = 0;
+			region.dstOffset = p_dst_offset + offset;
+			region.size = size;
+			_copy_buffer_immediate(dst_device, staging[1], p_dst->handle, region);
+		}
+	}
+
+	const Device* staging_devices[2] = {&src_device, &dst_device};
+	for (u32 i = 0; i < 2; i++) {
+		if (staging_data[i]) {
+			vkUnmapMemory(staging_devices[i]->handle, staging_memory[i]);
+		}
+		if (staging[i]) {
+			vkDestroyBuffer(staging_devices[i]->handle, staging[i], get_allocator(VK_OBJECT_TYPE_BUFFER));
+		}
+		if (staging_memory[i]) {
+			_free_memory(staging_devices[i]->handle, staging_memory[i]);
+		}
+	}
+
+	if (p_src->host_visible && !src_mapped) {
+		unmap_buffer(p_src);
+	}
+	if (p_dst->host_visible && !dst_mapped) {
+		unmap_buffer(p_dst);
+	}
+}
+
+ShaderID VulkanRenderDriver::create_shader(const std::span<u8> p_bytes, ShaderStage p_stage) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
+	NOVA_ASSERT(!p_bytes.empty());
+
+	Shader* shader = new Shader();
+	shader->stage = p_stage; // TODO: Get from shader code
+	shader->name = "main"; // TODO: Get from shader code
+	shader->device = m_current_device;
+
+	VkShaderModuleCreateInfo create {};
+	create.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+	create.codeSize = p_bytes.size();
+	create.pCode = reinterpret_cast<const u32*>(p_bytes.data());
+
+	if (vkCreateShaderModule(
+			m_current_device->handle,
+			&create,
+			get_allocator(VK_OBJECT_TYPE_SHADER_MODULE),
+			&shader->handle
+		)
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to create shader module");
+	}
+
+	return shader;
+}
+
+void VulkanRenderDriver::destroy_shader(ShaderID p_shader) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_shader);
+	VkDevice device = p_shader->device->handle;
+	if (p_shader->handle) {
+		vkDestroyShaderModule(device, p_shader->handle, get_allocator(VK_OBJECT_TYPE_SHADER_MODULE));
+	}
+	delete p_shader;
+}
+
+RenderPassID VulkanRenderDriver::create_render_pass(RenderPassParams& p_params) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_WARN("{}() not implemented", NOVA_FUNC_NAME);
+	RenderPass* render_pass = new RenderPass();
+	render_pass->device = m_current_device;
+	(void)p_params;
+	return render_pass;
+}
+
+void VulkanRenderDriver::destroy_render_pass(RenderPassID p_render_pass) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_render_pass);
+	VkDevice device = p_render_pass->device->handle;
+	if (p_render_pass->handle) {
+		vkDestroyRenderPass(device, p_render_pass->handle, get_allocator(VK_OBJECT_TYPE_RENDER_PASS));
+	}
+	delete p_render_pass;
+}
+
+PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
+	NOVA_ASSERT(p_params.render_pass);
+
+	// Mesh pipelines generate their own primitives, so vertex input and input assembly state are ignored
+	const bool mesh = std::any_of(p_params.shaders.begin(), p_params.shaders.end(), [](ShaderID p_shader) {
+		return p_shader->stage == ShaderStage::MESH;
+	});
+	if (mesh && !m_current_device->enabled_features.has(RenderFeature::MESH_SHADER)) {
+		throw std::runtime_error("Mesh shaders are not enabled on this device");
+	}
+	if (p_params.wireframe && !m_current_device->enabled_features.has(RenderFeature::FILL_MODE_NON_SOLID)) {
+		throw std::runtime_error("Wireframe rasterization is not enabled on this device");
+	}
+	if (p_params.enable_depth_clamp && !m_current_device->enabled_features.has(RenderFeature::DEPTH_CLAMP)) {
+		throw std::runtime_error("Depth clamp is not enabled on this device");
+	}
+	if (p_params.line_width != 1.0f && !m_current_device->enabled_features.has(RenderFeature::WIDE_LINES)) {
+		throw std::runtime_error("Wide lines are not enabled on this device");
+	}
+
+	// The create infos only live until the pipeline is created
+	ScratchScope scratch;
+
+	std::pmr::vector<VkPipelineShaderStageCreateInfo> shader_stages(scratch.get_resource());
+	shader_stages.reserve(p_params.shaders.size());
+	for (const auto& shader : p_params.shaders) {
+		VkPipelineShaderStageCreateInfo stage_create {};
+		stage_create.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		stage_create.stage = VK_SHADER_STAGE_MAP[static_cast<int>(shader->stage)];
+		stage_create.module = shader->handle;
+		stage_create.pName = shader->name.c_str();
+		// TODO: Get specialization info from shader
+		shader_stages.push_back(stage_create);
+	}
+
+	std::pmr::vector<VkVertexInputBindingDescription> vertex_bindings(scratch.get_resource());
+	vertex_bindings.reserve(p_params.bindings.size());
+	for (const auto& binding : p_params.bindings) {
+		VkVertexInputBindingDescription binding_desc {};
+		binding_desc.binding = binding.binding;
+		binding_desc.stride = binding.stride;
+		binding_desc.inputRate = VK_VERTEX_INPUT_RATE_MAP[static_cast<int>(binding.rate)];
 		vertex_bindings.push_back(binding_desc);
 	}
-	std::vector<VkVertexInputAttributeDescription> vertex_attributes;
+	std::pmr::vector<VkVertexInputAttributeDescription> vertex_attributes(scratch.get_resource());
+	vertex_attributes.reserve(p_params.attributes.size());
 	for (const auto& attribute : p_params.attributes) {
 		VkVertexInputAttributeDescription attribute_desc {};
 		attribute_desc.binding = attribute.binding;
@@ -807,7 +1919,7 @@ PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params)
 	// TODO: Depth stencil state
 
 	// TODO: Properly set up color blend state
-	std::vector<VkPipelineColorBlendAttachmentState> attachments;
+	std::pmr::vector<VkPipelineColorBlendAttachmentState> attachments(scratch.get_resource());
 	attachments.emplace_back();
 	attachments.back().colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT
 		| VK_COLOR_COMPONENT_A_BIT;
@@ -823,7 +1935,7 @@ PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params)
 	color_blend.blendConstants[2] = 0.0f;
 	color_blend.blendConstants[3] = 0.0f;
 
-	std::vector<VkDynamicState> dynamic_states;
+	std::pmr::vector<VkDynamicState> dynamic_states(scratch.get_resource());
 	dynamic_states.push_back(VK_DYNAMIC_STATE_VIEWPORT);
 	dynamic_states.push_back(VK_DYNAMIC_STATE_SCISSOR);
 	// TODO: Add more dynamic states
@@ -833,13 +1945,31 @@ PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params)
 	dynamic_state.pDynamicStates = dynamic_states.data();
 
 	Pipeline* pipeline = new Pipeline();
+	pipeline->type = PipelineType::GRAPHICS;
+	pipeline->device = m_current_device;
+
+	// ALL_GRAPHICS does not cover the mesh stages, and they may not be named unless the feature is enabled
+	if (p_params.push_constant_size) {
+		pipeline->push_constant_stages = mesh ? MESH_PIPELINE_STAGES : VK_SHADER_STAGE_ALL_GRAPHICS;
+	}
+
+	VkPushConstantRange push_constants {};
+	push_constants.stageFlags = pipeline->push_constant_stages;
+	push_constants.offset = 0;
+	push_constants.size = p_params.push_constant_size;
 
 	// TODO: Move this to the shader
 	VkPipelineLayoutCreateInfo layout_create {};
 	layout_create.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 	layout_create.setLayoutCount = 0; // TODO: Add descriptor sets
-	layout_create.pushConstantRangeCount = 0; // TODO: Add push constants
-	if (vkCreatePipelineLayout(m_device, &layout_create, get_allocator(VK_OBJECT_TYPE_PIPELINE_LAYOUT), &pipeline->layout)
+	layout_create.pushConstantRangeCount = p_params.push_constant_size ? 1 : 0;
+	layout_create.pPushConstantRanges = &push_constants;
+	if (vkCreatePipelineLayout(
+			m_current_device->handle,
+			&layout_create,
+			get_allocator(VK_OBJECT_TYPE_PIPELINE_LAYOUT),
+			&pipeline->layout
+		)
 		!= VK_SUCCESS) {
 		throw std::runtime_error("Failed to create pipeline layout");
 	}
@@ -848,8 +1978,8 @@ PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params)
 	pipeline_create.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
 	pipeline_create.stageCount = static_cast<u32>(shader_stages.size());
 	pipeline_create.pStages = shader_stages.data();
-	pipeline_create.pVertexInputState = &vertex_input;
-	pipeline_create.pInputAssemblyState = &input_assembly;
+	pipeline_create.pVertexInputState = mesh ? nullptr : &vertex_input;
+	pipeline_create.pInputAssemblyState = mesh ? nullptr : &input_assembly;
 	pipeline_create.pTessellationState = nullptr; // TODO: Add tessellation state
 	pipeline_create.pViewportState = &viewport;
 	pipeline_create.pRasterizationState = &rasterization;
@@ -862,7 +1992,7 @@ PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params)
 	pipeline_create.subpass = p_params.subpass;
 
 	if (vkCreateGraphicsPipelines(
-			m_device,
+			m_current_device->handle,
 			VK_NULL_HANDLE,
 			1,
 			&pipeline_create,
@@ -878,13 +2008,52 @@ PipelineID VulkanRenderDriver::create_pipeline(GraphicsPipelineParams& p_params)
 
 PipelineID VulkanRenderDriver::create_pipeline(ComputePipelineParams& p_params) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
+	NOVA_ASSERT(p_params.shader);
+	NOVA_ASSERT(p_params.shader->stage == ShaderStage::COMPUTE);
+
 	Pipeline* pipeline = new Pipeline();
-	(void)p_params;
+	pipeline->type = PipelineType::COMPUTE;
+	pipeline->device = m_current_device;
+	pipeline->push_constant_stages = p_params.push_constant_size ? VK_SHADER_STAGE_COMPUTE_BIT : 0;
+
+	VkPushConstantRange push_constants {};
+	push_constants.stageFlags = pipeline->push_constant_stages;
+	push_constants.offset = 0;
+	push_constants.size = p_params.push_constant_size;
+
+	VkPipelineLayoutCreateInfo layout_create {};
+	layout_create.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	layout_create.setLayoutCount = 0; // TODO: Add descriptor sets
+	layout_create.pushConstantRangeCount = p_params.push_constant_size ? 1 : 0;
+	layout_create.pPushConstantRanges = &push_constants;
+	if (vkCreatePipelineLayout(
+			m_current_device->handle,
+			&layout_create,
+			get_allocator(VK_OBJECT_TYPE_PIPELINE_LAYOUT),
+			&pipeline->layout
+		)
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to create pipeline layout");
+	}
 
 	VkComputePipelineCreateInfo create {};
 	create.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
-
-	if (vkCreateComputePipelines(m_device, VK_NULL_HANDLE, 1, &create, get_allocator(VK_OBJECT_TYPE_PIPELINE), &pipeline->handle)
+	create.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	create.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+	create.stage.module = p_params.shader->handle;
+	create.stage.pName = p_params.shader->name.c_str();
+	create.layout = pipeline->layout;
+
+	if (vkCreateComputePipelines(
+			m_current_device->handle,
+			VK_NULL_HANDLE,
+			1,
+			&create,
+			get_allocator(VK_OBJECT_TYPE_PIPELINE),
+			&pipeline->handle
+		)
 		!= VK_SUCCESS) {
 		throw std::runtime_error("Failed to create compute pipeline");
 	}
@@ -894,26 +2063,30 @@ PipelineID VulkanRenderDriver::create_pipeline(ComputePipelineParams& p_params)
 void VulkanRenderDriver::destroy_pipeline(PipelineID p_pipeline) {
 	NOVA_AUTO_TRACE();
 	NOVA_ASSERT(p_pipeline);
+	VkDevice device = p_pipeline->device->handle;
 	if (p_pipeline->layout) {
-		vkDestroyPipelineLayout(m_device, p_pipeline->layout, get_allocator(VK_OBJECT_TYPE_PIPELINE_LAYOUT));
+		vkDestroyPipelineLayout(device, p_pipeline->layout, get_allocator(VK_OBJECT_TYPE_PIPELINE_LAYOUT));
 	}
 	if (p_pipeline->handle) {
-		vkDestroyPipeline(m_device, p_pipeline->handle, get_allocator(VK_OBJECT_TYPE_PIPELINE));
+		vkDestroyPipeline(device, p_pipeline->handle, get_allocator(VK_OBJECT_TYPE_PIPELINE));
 	}
 	delete p_pipeline;
 }
 
 CommandPoolID VulkanRenderDriver::create_command_pool(QueueID p_queue) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
 	NOVA_ASSERT(p_queue);
 	CommandPool* pool = new CommandPool();
+	pool->device = p_queue->device;
 
+	VkDevice device = pool->device->handle;
 	VkCommandPoolCreateInfo create {};
 	create.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
 	create.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; // TODO: Support other pool type
 	create.queueFamilyIndex = p_queue->family_index;
 
-	if (vkCreateCommandPool(m_device, &create, get_allocator(VK_OBJECT_TYPE_COMMAND_POOL), &pool->handle) != VK_SUCCESS) {
+	if (vkCreateCommandPool(device, &create, get_allocator(VK_OBJECT_TYPE_COMMAND_POOL), &pool->handle) != VK_SUCCESS) {
 		throw std::runtime_error("Failed to create command pool");
 	}
 
@@ -923,8 +2096,9 @@ CommandPoolID VulkanRenderDriver::create_command_pool(QueueID p_queue) {
 void VulkanRenderDriver::destroy_command_pool(CommandPoolID p_command_pool) {
 	NOVA_AUTO_TRACE();
 	NOVA_ASSERT(p_command_pool);
+	VkDevice device = p_command_pool->device->handle;
 	if (p_command_pool->handle) {
-		vkDestroyCommandPool(m_device, p_command_pool->handle, get_allocator(VK_OBJECT_TYPE_COMMAND_POOL));
+		vkDestroyCommandPool(device, p_command_pool->handle, get_allocator(VK_OBJECT_TYPE_COMMAND_POOL));
 	}
 	for (const CommandBufferID buffer : p_command_pool->allocated_buffers) {
 		delete buffer;
@@ -934,8 +2108,10 @@ void VulkanRenderDriver::destroy_command_pool(CommandPoolID p_command_pool) {
 
 CommandBufferID VulkanRenderDriver::create_command_buffer(CommandPoolID p_pool) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
 	NOVA_ASSERT(p_pool);
 	CommandBuffer* buffer = new CommandBuffer();
+	buffer->device = p_pool->device;
 
 	VkCommandBufferAllocateInfo alloc {};
 	alloc.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -943,7 +2119,7 @@ CommandBufferID VulkanRenderDriver::create_command_buffer(CommandPoolID p_pool)
 	alloc.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY; // TODO: Support other buffer levels
 	alloc.commandBufferCount = 1;
 
-	if (vkAllocateCommandBuffers(m_device, &alloc, &buffer->handle) != VK_SUCCESS) {
+	if (vkAllocateCommandBuffers(p_pool->device->handle, &alloc, &buffer->handle) != VK_SUCCESS) {
 		throw std::runtime_error("Failed to allocate command buffer");
 	}
 
@@ -964,14 +2140,552 @@ void VulkanRenderDriver::end_command_buffer(CommandBufferID p_command_buffer) {
 	vkEndCommandBuffer(p_command_buffer->handle);
 }
 
+void VulkanRenderDriver::cmd_begin_render_pass(
+	CommandBufferID p_command_buffer,
+	RenderTargetID p_render_target,
+	const Vec4<f32>& p_clear_color
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_render_target);
+
+	VkClearValue clear {};
+	clear.color.float32[0] = p_clear_color.r;
+	clear.color.float32[1] = p_clear_color.g;
+	clear.color.float32[2] = p_clear_color.b;
+	clear.color.float32[3] = p_clear_color.a;
+
+	VkRenderPassBeginInfo info {};
+	info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	info.renderPass = p_render_target->render_pass->handle;
+	info.framebuffer = p_render_target->framebuffer;
+	info.renderArea.offset = {0, 0};
+	info.renderArea.extent = {p_render_target->width, p_render_target->height};
+	info.clearValueCount = 1;
+	info.pClearValues = &clear;
+
+	vkCmdBeginRenderPass(p_command_buffer->handle, &info, VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void VulkanRenderDriver::cmd_end_render_pass(CommandBufferID p_command_buffer) {
+	NOVA_ASSERT(p_command_buffer);
+	vkCmdEndRenderPass(p_command_buffer->handle);
+}
+
+void VulkanRenderDriver::cmd_bind_pipeline(CommandBufferID p_command_buffer, PipelineID p_pipeline) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_pipeline);
+	const VkPipelineBindPoint bind_point = p_pipeline->type == PipelineType::COMPUTE ? VK_PIPELINE_BIND_POINT_COMPUTE
+																					: VK_PIPELINE_BIND_POINT_GRAPHICS;
+	vkCmdBindPipeline(p_command_buffer->handle, bind_point, p_pipeline->handle);
+}
+
+void VulkanRenderDriver::cmd_push_constants(
+	CommandBufferID p_command_buffer,
+	PipelineID p_pipeline,
+	const std::span<const u8> p_data,
+	const u32 p_offset
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_pipeline);
+	NOVA_ASSERT(p_pipeline->push_constant_stages);
+	vkCmdPushConstants(
+		p_command_buffer->handle,
+		p_pipeline->layout,
+		p_pipeline->push_constant_stages,
+		p_offset,
+		static_cast<u32>(p_data.size()),
+		p_data.data()
+	);
+}
+
+void VulkanRenderDriver::cmd_bind_index_buffer(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	const IndexType p_type,
+	const u64 p_offset
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	vkCmdBindIndexBuffer(p_command_buffer->handle, p_buffer->handle, p_offset, VK_INDEX_TYPE_MAP[static_cast<int>(p_type)]);
+}
+
+void VulkanRenderDriver::cmd_bind_vertex_buffer(
+	CommandBufferID p_command_buffer,
+	const u32 p_binding,
+	BufferID p_buffer,
+	const u64 p_offset
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	const VkDeviceSize offset = p_offset;
+	vkCmdBindVertexBuffers(p_command_buffer->handle, p_binding, 1, &p_buffer->handle, &offset);
+}
+
+void VulkanRenderDriver::cmd_set_viewport(
+	CommandBufferID p_command_buffer,
+	const f32 p_x,
+	const f32 p_y,
+	const f32 p_width,
+	const f32 p_height
+) {
+	NOVA_ASSERT(p_command_buffer);
+	VkViewport viewport {};
+	viewport.x = p_x;
+	viewport.y = p_y;
+	viewport.width = p_width;
+	viewport.height = p_height;
+	viewport.minDepth = 0.0f;
+	viewport.maxDepth = 1.0f;
+	vkCmdSetViewport(p_command_buffer->handle, 0, 1, &viewport);
+}
+
+void VulkanRenderDriver::cmd_set_scissor(
+	CommandBufferID p_command_buffer,
+	const i32 p_x,
+	const i32 p_y,
+	const u32 p_width,
+	const u32 p_height
+) {
+	NOVA_ASSERT(p_command_buffer);
+	VkRect2D scissor {};
+	scissor.offset = {p_x, p_y};
+	scissor.extent = {p_width, p_height};
+	vkCmdSetScissor(p_command_buffer->handle, 0, 1, &scissor);
+}
+
+void VulkanRenderDriver::cmd_draw(
+	CommandBufferID p_command_buffer,
+	const u32 p_vertex_count,
+	const u32 p_instance_count,
+	const u32 p_first_vertex,
+	const u32 p_first_instance
+) {
+	NOVA_ASSERT(p_command_buffer);
+	vkCmdDraw(p_command_buffer->handle, p_vertex_count, p_instance_count, p_first_vertex, p_first_instance);
+}
+
+void VulkanRenderDriver::cmd_draw_indexed(
+	CommandBufferID p_command_buffer,
+	const u32 p_index_count,
+	const u32 p_instance_count,
+	const u32 p_first_index,
+	const i32 p_vertex_offset,
+	const u32 p_first_instance
+) {
+	NOVA_ASSERT(p_command_buffer);
+	vkCmdDrawIndexed(
+		p_command_buffer->handle,
+		p_index_count,
+		p_instance_count,
+		p_first_index,
+		p_vertex_offset,
+		p_first_instance
+	);
+}
+
+void VulkanRenderDriver::cmd_draw_indexed_indirect(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	const u64 p_offset,
+	const u32 p_draw_count,
+	const u32 p_stride
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	vkCmdDrawIndexedIndirect(p_command_buffer->handle, p_buffer->handle, p_offset, p_draw_count, p_stride);
+}
+
+void VulkanRenderDriver::cmd_draw_indexed_indirect_count(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	const u64 p_offset,
+	BufferID p_count_buffer,
+	const u64 p_count_offset,
+	const u32 p_max_draw_count,
+	const u32 p_stride
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	NOVA_ASSERT(p_count_buffer);
+	NOVA_ASSERT(p_buffer->device->enabled_features.has(RenderFeature::DRAW_INDIRECT_COUNT));
+	vkCmdDrawIndexedIndirectCount(
+		p_command_buffer->handle,
+		p_buffer->handle,
+		p_offset,
+		p_count_buffer->handle,
+		p_count_offset,
+		p_max_draw_count,
+		p_stride
+	);
+}
+
+void VulkanRenderDriver::cmd_draw_mesh_tasks(
+	CommandBufferID p_command_buffer,
+	const u32 p_x,
+	const u32 p_y,
+	const u32 p_z
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_command_buffer->device->draw_mesh_tasks);
+	p_command_buffer->device->draw_mesh_tasks(p_command_buffer->handle, p_x, p_y, p_z);
+}
+
+void VulkanRenderDriver::cmd_draw_mesh_tasks_indirect(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	const u64 p_offset,
+	const u32 p_draw_count,
+	const u32 p_stride
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	NOVA_ASSERT(p_command_buffer->device->draw_mesh_tasks_indirect);
+	p_command_buffer->device
+		->draw_mesh_tasks_indirect(p_command_buffer->handle, p_buffer->handle, p_offset, p_draw_count, p_stride);
+}
+
+void VulkanRenderDriver::cmd_draw_mesh_tasks_indirect_count(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	const u64 p_offset,
+	BufferID p_count_buffer,
+	const u64 p_count_offset,
+	const u32 p_max_draw_count,
+	const u32 p_stride
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	NOVA_ASSERT(p_count_buffer);
+	NOVA_ASSERT(p_command_buffer->device->draw_mesh_tasks_indirect_count);
+	NOVA_ASSERT(p_buffer->device->enabled_features.has(RenderFeature::DRAW_INDIRECT_COUNT));
+	p_command_buffer->device->draw_mesh_tasks_indirect_count(
+		p_command_buffer->handle,
+		p_buffer->handle,
+		p_offset,
+		p_count_buffer->handle,
+		p_count_offset,
+		p_max_draw_count,
+		p_stride
+	);
+}
+
+void VulkanRenderDriver::cmd_dispatch(CommandBufferID p_command_buffer, const u32 p_x, const u32 p_y, const u32 p_z) {
+	NOVA_ASSERT(p_command_buffer);
+	vkCmdDispatch(p_command_buffer->handle, p_x, p_y, p_z);
+}
+
+void VulkanRenderDriver::cmd_dispatch_indirect(CommandBufferID p_command_buffer, BufferID p_buffer, const u64 p_offset) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	vkCmdDispatchIndirect(p_command_buffer->handle, p_buffer->handle, p_offset);
+}
+
+void VulkanRenderDriver::cmd_copy_render_target(CommandBufferID p_command_buffer, RenderTargetID p_render_target) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_render_target);
+
+	// The render pass leaves the image in TRANSFER_SRC_OPTIMAL
+	VkBufferImageCopy region {};
+	region.bufferOffset = 0;
+	region.bufferRowLength = 0;
+	region.bufferImageHeight = 0;
+	region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	region.imageSubresource.mipLevel = 0;
+	region.imageSubresource.baseArrayLayer = 0;
+	region.imageSubresource.layerCount = 1;
+	region.imageOffset = {0, 0, 0};
+	region.imageExtent = {p_render_target->width, p_render_target->height, 1};
+
+	vkCmdCopyImageToBuffer(
+		p_command_buffer->handle,
+		p_render_target->image,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		p_render_target->readback_buffer,
+		1,
+		&region
+	);
+
+	VkBufferMemoryBarrier barrier {};
+	barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.buffer = p_render_target->readback_buffer;
+	barrier.offset = 0;
+	barrier.size = VK_WHOLE_SIZE;
+
+	vkCmdPipelineBarrier(
+		p_command_buffer->handle,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_HOST_BIT,
+		0,
+		0,
+		nullptr,
+		1,
+		&barrier,
+		0,
+		nullptr
+	);
+}
+
+void VulkanRenderDriver::cmd_fill_buffer(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	const u64 p_offset,
+	const u64 p_size,
+	const u32 p_value
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	vkCmdFillBuffer(p_command_buffer->handle, p_buffer->handle, p_offset, p_size, p_value);
+}
+
+void VulkanRenderDriver::cmd_buffer_barrier(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	const BufferAccess p_src,
+	const BufferAccess p_dst
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+
+	VkBufferMemoryBarrier barrier {};
+	barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_BUFFER_ACCESS_MASK_MAP[static_cast<int>(p_src)];
+	barrier.dstAccessMask = VK_BUFFER_ACCESS_MASK_MAP[static_cast<int>(p_dst)];
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.buffer = p_buffer->handle;
+	barrier.offset = 0;
+	barrier.size = VK_WHOLE_SIZE;
+
+	vkCmdPipelineBarrier(
+		p_command_buffer->handle,
+		VK_BUFFER_ACCESS_STAGE_MAP[static_cast<int>(p_src)],
+		VK_BUFFER_ACCESS_STAGE_MAP[static_cast<int>(p_dst)],
+		0,
+		0,
+		nullptr,
+		1,
+		&barrier,
+		0,
+		nullptr
+	);
+}
+
+void VulkanRenderDriver::cmd_copy_buffer(
+	CommandBufferID p_command_buffer,
+	BufferID p_src,
+	BufferID p_dst,
+	const u64 p_size,
+	const u64 p_src_offset,
+	const u64 p_dst_offset
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_src);
+	NOVA_ASSERT(p_dst);
+	NOVA_ASSERT(p_src->device == p_dst->device);
+
+	VkBufferCopy region {};
+	region.srcOffset = p_src_offset;
+	region.dstOffset = p_dst_offset;
+	region.size = p_size;
+	vkCmdCopyBuffer(p_command_buffer->handle, p_src->handle, p_dst->handle, 1, &region);
+}
+
+void VulkanRenderDriver::cmd_texture_barrier(
+	CommandBufferID p_command_buffer,
+	TextureID p_texture,
+	const TextureAccess p_src,
+	const TextureAccess p_dst
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_texture);
+	record_texture_barrier(p_command_buffer->handle, *p_texture, 0, p_texture->mip_levels, p_src, p_dst);
+}
+
+void VulkanRenderDriver::cmd_copy_buffer_to_texture(
+	CommandBufferID p_command_buffer,
+	BufferID p_buffer,
+	TextureID p_texture,
+	const u32 p_mip_level,
+	const u64 p_buffer_offset
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_buffer);
+	NOVA_ASSERT(p_texture);
+	NOVA_ASSERT(p_buffer->device == p_texture->device);
+	NOVA_ASSERT(p_mip_level < p_texture->mip_levels);
+
+	VkBufferImageCopy region {};
+	region.bufferOffset = p_buffer_offset;
+	region.bufferRowLength = 0;
+	region.bufferImageHeight = 0;
+	region.imageSubresource.aspectMask = p_texture->aspect;
+	region.imageSubresource.mipLevel = p_mip_level;
+	region.imageSubresource.baseArrayLayer = 0;
+	region.imageSubresource.layerCount = 1;
+	region.imageOffset = {0, 0, 0};
+	region.imageExtent.width = std::max(p_texture->width >> p_mip_level, 1u);
+	region.imageExtent.height = std::max(p_texture->height >> p_mip_level, 1u);
+	region.imageExtent.depth = 1;
+
+	vkCmdCopyBufferToImage(
+		p_command_buffer->handle,
+		p_buffer->handle,
+		p_texture->image,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		1,
+		&region
+	);
+}
+
+void VulkanRenderDriver::cmd_generate_mipmaps(
+	CommandBufferID p_command_buffer,
+	TextureID p_texture,
+	const TextureAccess p_dst
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_texture);
+
+	const TextureUsage transfer = TextureUsage::TRANSFER_SRC | TextureUsage::TRANSFER_DST;
+	if ((p_texture->usage & transfer) != transfer) {
+		throw std::runtime_error("Mip generation needs TRANSFER_SRC and TRANSFER_DST texture usage");
+	}
+
+	const FormatFeature supported = get_format_features(p_texture->device->index, p_texture->format);
+	const FormatFeature blit = FormatFeature::BLIT_SRC | FormatFeature::BLIT_DST;
+	if ((supported & blit) != blit) {
+		throw std::runtime_error("Texture format does not support blits");
+	}
+
+	// TODO: Compute downsampler for formats that cannot be blitted, once storage images can be bound
+	const VkFilter filter = (supported & FormatFeature::LINEAR_FILTER) == FormatFeature::LINEAR_FILTER
+		? VK_FILTER_LINEAR
+		: VK_FILTER_NEAREST;
+	const u32 levels = p_texture->mip_levels;
+	VkCommandBuffer cmd = p_command_buffer->handle;
+
+	i32 width = static_cast<i32>(p_texture->width);
+	i32 height = static_cast<i32>(p_texture->height);
+
+	for (u32 level = 1; level < levels; level++) {
+		// Each level is read as soon as it has been written, so the chain is transitioned one level at a time
+		record_texture_barrier(cmd, *p_texture, level - 1, 1, TextureAccess::TRANSFER_WRITE, TextureAccess::TRANSFER_READ);
+
+		const i32 next_width = std::max(width / 2, 1);
+		const i32 next_height = std::max(height / 2, 1);
+
+		VkImageBlit region {};
+		region.srcSubresource.aspectMask = p_texture->aspect;
+		region.srcSubresource.mipLevel = level - 1;
+		region.srcSubresource.baseArrayLayer = 0;
+		region.srcSubresource.layerCount = 1;
+		region.srcOffsets[0] = {0, 0, 0};
+		region.srcOffsets[1] = {width, height, 1};
+		region.dstSubresource.aspectMask = p_texture->aspect;
+		region.dstSubresource.mipLevel = level;
+		region.dstSubresource.baseArrayLayer = 0;
+		region.dstSubresource.layerCount = 1;
+		region.dstOffsets[0] = {0, 0, 0};
+		region.dstOffsets[1] = {next_width, next_height, 1};
+
+		vkCmdBlitImage(
+			cmd,
+			p_texture->image,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			p_texture->image,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			1,
+			&region,
+			filter
+		);
+
+		width = next_width;
+		height = next_height;
+	}
+
+	// Every level but the last was a blit source
+	if (levels > 1) {
+		record_texture_barrier(cmd, *p_texture, 0, levels - 1, TextureAccess::TRANSFER_READ, p_dst);
+	}
+	record_texture_barrier(cmd, *p_texture, levels - 1, 1, TextureAccess::TRANSFER_WRITE, p_dst);
+}
+
+FenceID VulkanRenderDriver::create_fence(const bool p_signaled) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_ASSERT(m_current_device);
+	Fence* fence = new Fence();
+	fence->device = m_current_device;
+
+	VkFenceCreateInfo create {};
+	create.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	create.flags = p_signaled ? VK_FENCE_CREATE_SIGNALED_BIT : 0;
+
+	if (vkCreateFence(m_current_device->handle, &create, get_allocator(VK_OBJECT_TYPE_FENCE), &fence->handle)
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to create fence");
+	}
+
+	return fence;
+}
+
+void VulkanRenderDriver::wait_for_fence(FenceID p_fence) {
+	NOVA_ASSERT(p_fence);
+	VkDevice device = p_fence->device->handle;
+	if (vkWaitForFences(device, 1, &p_fence->handle, VK_TRUE, std::numeric_limits<u64>::max()) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to wait for fence");
+	}
+}
+
+void VulkanRenderDriver::reset_fence(FenceID p_fence) {
+	NOVA_ASSERT(p_fence);
+	vkResetFences(p_fence->device->handle, 1, &p_fence->handle); // TODO: Check result
+}
+
+void VulkanRenderDriver::destroy_fence(FenceID p_fence) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_fence);
+	VkDevice device = p_fence->device->handle;
+	if (p_fence->handle) {
+		vkDestroyFence(device, p_fence->handle, get_allocator(VK_OBJECT_TYPE_FENCE));
+	}
+	delete p_fence;
+}
+
+void VulkanRenderDriver::submit(QueueID p_queue, CommandBufferID p_command_buffer, FenceID p_fence) {
+	NOVA_ASSERT(p_queue);
+	NOVA_ASSERT(p_command_buffer);
+
+	VkSubmitInfo info {};
+	info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	info.commandBufferCount = 1;
+	info.pCommandBuffers = &p_command_buffer->handle;
+	// TODO: Support semaphores
+
+	if (vkQueueSubmit(p_queue->handle, 1, &info, p_fence ? p_fence->handle : VK_NULL_HANDLE) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to submit command buffer");
+	}
+}
+
+void VulkanRenderDriver::wait_idle() {
+	NOVA_AUTO_TRACE();
+	for (const DeviceID device : m_open_devices) {
+		vkDeviceWaitIdle(device->handle); // TODO: Check result
+	}
+}
+
 VkInstance VulkanRenderDriver::get_instance() const {
 	return m_instance;
 }
 
-VkAllocationCallbacks* VulkanRenderDriver::get_allocator(const VkObjectType p_type) const {
-	// TODO: Add custom allocator
+const VkAllocationCallbacks* VulkanRenderDriver::get_allocator(const VkObjectType p_type) const {
+	// Every object type shares the tracking allocator for now. Without heap tracking the rest of the heap isn't
+	// counted either, so the driver keeps its own allocator instead of paying a header and indirect call each time
 	(void)p_type;
-	return nullptr;
+	return MemoryTracker::is_tracking_heap() ? &TRACKED_ALLOCATOR : nullptr;
 }
 
 void VulkanRenderDriver::_check_version() const {
@@ -995,15 +2709,20 @@ void VulkanRenderDriver::_check_extensions() {
 	NOVA_AUTO_TRACE();
 
 	u32 count;
-	std::unordered_map<std::string_view, bool> requested; // <extension, required>
+	ScratchScope scratch;
+	std::pmr::unordered_map<std::string_view, bool> requested(scratch.get_resource()); // <extension, required>
 
-	const auto surface_extension = m_window_driver->get_surface_extension();
-	if (!surface_extension) {
-		throw std::runtime_error("Could not determine required surface extension");
-	}
+	if (m_window_driver) {
+		const auto surface_extension = m_window_driver->get_surface_extension();
+		if (!surface_extension) {
+			throw std::runtime_error("Could not determine required surface extension");
+		}
 
-	requested[VK_KHR_SURFACE_EXTENSION_NAME] = true;
-	requested[surface_extension] = true;
+		requested[VK_KHR_SURFACE_EXTENSION_NAME] = true;
+		requested[surface_extension] = true;
+	} else {
+		NOVA_INFO("No window driver, running headless");
+	}
 
 	// Add optional extensions
 	if (Debug::is_debug()) {
@@ -1013,7 +2732,7 @@ void VulkanRenderDriver::_check_extensions() {
 
 	// Get available extensions
 	vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr); // TODO: Check result
-	std::vector<VkExtensionProperties> available(count);
+	std::pmr::vector<VkExtensionProperties> available(count, scratch.get_resource());
 	vkEnumerateInstanceExtensionProperties(nullptr, &count, available.data()); // TODO: Check result
 
 	// Check found extensions
@@ -1049,9 +2768,10 @@ void VulkanRenderDriver::_check_layers() {
 	}
 
 	// Get available layers
+	ScratchScope scratch;
 	u32 count;
 	vkEnumerateInstanceLayerProperties(&count, nullptr);
-	std::vector<VkLayerProperties> available(count);
+	std::pmr::vector<VkLayerProperties> available(count, scratch.get_resource());
 	vkEnumerateInstanceLayerProperties(&count, available.data());
 
 	// Check found layers
@@ -1093,24 +2813,31 @@ void VulkanRenderDriver::_init_instance() {
 void VulkanRenderDriver::_init_hardware() {
 	NOVA_AUTO_TRACE();
 
+	ScratchScope scratch;
 	u32 count;
 	vkEnumeratePhysicalDevices(m_instance, &count, nullptr); // TODO: Check result
-	std::vector<VkPhysicalDevice> devices(count);
+	std::pmr::vector<VkPhysicalDevice> devices(count, scratch.get_resource());
 	vkEnumeratePhysicalDevices(m_instance, &count, devices.data()); // TODO: Check result
 
 	m_devices.reserve(count);
+	m_device_info = std::make_unique<DeviceInfo[]>(count);
+	for (u32 i = 0; i < count; i++) {
+		m_device_info[i].format_features = std::make_unique<std::atomic<u32>[]>(std::size(VK_FORMAT_MAP));
+	}
 
 	for (const auto& device : devices) {
 		VkPhysicalDeviceProperties properties;
 		vkGetPhysicalDeviceProperties(device, &properties);
 
-		m_devices.emplace_back<RenderDevice>({
-			.name = properties.deviceName,
-			.vendor = static_cast<DeviceVendor>(properties.vendorID),
-			.type = static_cast<DeviceType>(properties.deviceType),
-			.deviceID = properties.deviceID,
-			.handle = device,
-		});
+		// Limits, memory, queues and features are filled in by _describe_device() on first access
+		RenderDevice& render_device = m_devices.emplace_back();
+		render_device.name = properties.deviceName;
+		render_device.vendor = static_cast<DeviceVendor>(properties.vendorID);
+		render_device.type = static_cast<DeviceType>(properties.deviceType);
+		render_device.deviceID = properties.deviceID;
+		render_device.handle = device;
+		render_device.api_version = properties.apiVersion;
+		render_device.driver_version = properties.driverVersion;
 
 		NOVA_INFO("Found device: {}", properties.deviceName);
 	}
@@ -1120,24 +2847,220 @@ void VulkanRenderDriver::_init_hardware() {
 	}
 }
 
-void VulkanRenderDriver::_check_device_extensions() {
+const VulkanRenderDriver::FeatureChain& VulkanRenderDriver::_get_device_features(const u32 p_index) const {
+	NOVA_ASSERT(p_index < m_devices.size());
+	DeviceInfo& info = m_device_info[p_index];
+	std::call_once(info.features_once, [&] {
+		VkPhysicalDevice physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
+		info.features = {};
+		_link_features(info.features, p_index, RenderFeatureSet::all());
+		vkGetPhysicalDeviceFeatures2(physical_device, &info.features.core);
+	});
+	return info.features;
+}
+
+const VkPhysicalDeviceMemoryProperties& VulkanRenderDriver::_get_device_memory_properties(const u32 p_index) const {
+	NOVA_ASSERT(p_index < m_devices.size());
+	DeviceInfo& info = m_device_info[p_index];
+	std::call_once(info.memory_properties_once, [&] {
+		VkPhysicalDevice physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
+		vkGetPhysicalDeviceMemoryProperties(physical_device, &info.memory_properties);
+	});
+	return info.memory_properties;
+}
+
+const std::vector<VkQueueFamilyProperties>& VulkanRenderDriver::_get_device_queue_families(const u32 p_index) const {
+	NOVA_ASSERT(p_index < m_devices.size());
+	DeviceInfo& info = m_device_info[p_index];
+	std::call_once(info.queue_families_once, [&] {
+		VkPhysicalDevice physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
+		u32 count;
+		vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+		info.queue_families.resize(count);
+		vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &count, info.queue_families.data());
+	});
+	return info.queue_families;
+}
+
+const std::vector<VkExtensionProperties>& VulkanRenderDriver::_get_device_extensions(const u32 p_index) const {
+	NOVA_ASSERT(p_index < m_devices.size());
+	DeviceInfo& info = m_device_info[p_index];
+	std::call_once(info.extensions_once, [&] {
+		VkPhysicalDevice physical_device = static_cast<VkPhysicalDevice>(m_devices[p_index].handle);
+		u32 count;
+		vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &count, nullptr); // TODO: Check result
+		info.extensions.resize(count);
+		vkEnumerateDeviceExtensionProperties(
+			physical_device,
+			nullptr,
+			&count,
+			info.extensions.data()
+		); // TODO: Check result
+	});
+	return info.extensions;
+}
+
+bool VulkanRenderDriver::_has_device_extension(const u32 p_index, const std::string_view p_name) const {
+	const auto& extensions = _get_device_extensions(p_index);
+	return std::any_of(extensions.begin(), extensions.end(), [p_name](const VkExtensionProperties& p_extension) {
+		return p_name == p_extension.extensionName;
+	});
+}
+
+void VulkanRenderDriver::_link_features(
+	FeatureChain& p_chain,
+	const u32 p_index,
+	const RenderFeatureSet& p_features
+) const {
+	void** next = &p_chain.core.pNext;
+	const auto link = [&next](auto& p_struct, const VkStructureType p_type) {
+		p_struct.sType = p_type;
+		p_struct.pNext = nullptr;
+		*next = &p_struct;
+		next = &p_struct.pNext;
+	};
+
+	// Extension structs may only be chained when the device exposes the extension
+	const auto wants = [&](const RenderFeature p_feature) {
+		const char* extension = FEATURE_EXTENSION_MAP[static_cast<int>(p_feature)];
+		return p_features.has(p_feature) && (!extension || _has_device_extension(p_index, extension));
+	};
+
+	p_chain.core.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+	p_chain.core.pNext = nullptr;
+
+	if (m_devices[p_index].api_version >= VK_API_VERSION_1_2) {
+		link(p_chain.vulkan12, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES);
+	}
+	if (wants(RenderFeature::SYNCHRONIZATION_2)) {
+		link(p_chain.synchronization2, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR);
+	}
+	if (wants(RenderFeature::DYNAMIC_RENDERING)) {
+		link(p_chain.dynamic_rendering, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
+	}
+	if (wants(RenderFeature::EXTENDED_DYNAMIC_STATE)) {
+		link(p_chain.extended_dynamic_state, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT);
+	}
+	if (wants(RenderFeature::MESH_SHADER)) {
+		link(p_chain.mesh_shader, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT);
+	}
+}
+
+void VulkanRenderDriver::_describe_device(const u32 p_index) const {
 	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_index < m_devices.size());
 
-	std::unordered_map<std::string_view, bool> requested; // <extension, required>
-	requested[VK_KHR_SWAPCHAIN_EXTENSION_NAME] = true;
-	// TODO: Add other device extensions
+	RenderDevice& device = m_devices[p_index];
+	VkPhysicalDevice physical_device = static_cast<VkPhysicalDevice>(device.handle);
 
-	// Get available extensions
-	u32 count;
-	vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &count, nullptr); // TODO: Check result
-	std::vector<VkExtensionProperties> available(count);
-	vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &count, available.data()); // TODO: Check result
+	VkPhysicalDeviceSubgroupProperties subgroup {};
+	subgroup.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+
+	VkPhysicalDeviceMeshShaderPropertiesEXT mesh_shader {};
+	mesh_shader.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT;
+	if (_has_device_extension(p_index, VK_EXT_MESH_SHADER_EXTENSION_NAME)) {
+		subgroup.pNext = &mesh_shader;
+	}
+
+	VkPhysicalDeviceProperties2 properties2 {};
+	properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+	properties2.pNext = &subgroup;
+	vkGetPhysicalDeviceProperties2(physical_device, &properties2);
+
+	const VkPhysicalDeviceProperties& properties = properties2.properties;
+	const VkPhysicalDeviceLimits& limits = properties.limits;
+
+	device.subgroup_size = subgroup.subgroupSize;
+
+	device.limits.max_image_dimension_2d = limits.maxImageDimension2D;
+	device.limits.max_framebuffer_width = limits.maxFramebufferWidth;
+	device.limits.max_framebuffer_height = limits.maxFramebufferHeight;
+	device.limits.max_push_constants_size = limits.maxPushConstantsSize;
+	device.limits.max_bound_descriptor_sets = limits.maxBoundDescriptorSets;
+	device.limits.max_storage_buffer_range = limits.maxStorageBufferRange;
+	device.limits.max_compute_shared_memory_size = limits.maxComputeSharedMemorySize;
+	device.limits.max_compute_work_group_invocations = limits.maxComputeWorkGroupInvocations;
+	device.limits.max_draw_indirect_count = limits.maxDrawIndirectCount;
+	device.limits.max_memory_allocation_count = limits.maxMemoryAllocationCount;
+	device.limits.max_sampler_anisotropy = limits.maxSamplerAnisotropy;
+	device.limits.timestamp_period = limits.timestampPeriod;
+	device.limits.max_mesh_output_vertices = mesh_shader.maxMeshOutputVertices;
+	device.limits.max_mesh_output_primitives = mesh_shader.maxMeshOutputPrimitives;
+
+	const auto& memory = _get_device_memory_properties(p_index);
+	device.memory_heaps.clear();
+	for (u32 i = 0; i < memory.memoryHeapCount; i++) {
+		device.memory_heaps.push_back({
+			.size = memory.memoryHeaps[i].size,
+			.device_local = (memory.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0,
+		});
+	}
+
+	device.queue_families.clear();
+	for (const auto& family : _get_device_queue_families(p_index)) {
+		device.queue_families.push_back({
+			.queue_count = family.queueCount,
+			.graphics = (family.queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0,
+			.compute = (family.queueFlags & VK_QUEUE_COMPUTE_BIT) != 0,
+			.transfer = (family.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0,
+		});
+	}
+
+	// Structs for missing extensions are never chained, so their members stay zeroed
+	const FeatureChain& chain = _get_device_features(p_index);
+	const VkPhysicalDeviceFeatures& core = chain.core.features;
+	const VkPhysicalDeviceVulkan12Features& vulkan12 = chain.vulkan12;
+
+	device.features = {};
+	device.features.set(RenderFeature::MULTI_DRAW_INDIRECT, core.multiDrawIndirect);
+	device.features.set(RenderFeature::DRAW_INDIRECT_FIRST_INSTANCE, core.drawIndirectFirstInstance);
+	device.features.set(RenderFeature::DRAW_INDIRECT_COUNT, vulkan12.drawIndirectCount);
+	device.features.set(RenderFeature::SAMPLER_ANISOTROPY, core.samplerAnisotropy);
+	device.features.set(RenderFeature::TEXTURE_COMPRESSION_BC, core.textureCompressionBC);
+	device.features.set(RenderFeature::TEXTURE_COMPRESSION_ASTC, core.textureCompressionASTC_LDR);
+	device.features.set(RenderFeature::SHADER_INT64, core.shaderInt64);
+	device.features.set(RenderFeature::SHADER_FLOAT16, vulkan12.shaderFloat16);
+	device.features.set(RenderFeature::TIMELINE_SEMAPHORE, vulkan12.timelineSemaphore);
+	device.features.set(
+		RenderFeature::DESCRIPTOR_INDEXING,
+		vulkan12.descriptorIndexing && vulkan12.runtimeDescriptorArray && vulkan12.descriptorBindingPartiallyBound
+			&& vulkan12.shaderSampledImageArrayNonUniformIndexing
+	);
+	device.features.set(RenderFeature::SYNCHRONIZATION_2, chain.synchronization2.synchronization2);
+	device.features.set(RenderFeature::BUFFER_DEVICE_ADDRESS, vulkan12.bufferDeviceAddress);
+	device.features.set(RenderFeature::DYNAMIC_RENDERING, chain.dynamic_rendering.dynamicRendering);
+	device.features.set(RenderFeature::EXTENDED_DYNAMIC_STATE, chain.extended_dynamic_state.extendedDynamicState);
+	device.features.set(
+		RenderFeature::MEMORY_BUDGET,
+		_has_device_extension(p_index, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)
+	);
+	device.features.set(RenderFeature::MESH_SHADER, chain.mesh_shader.taskShader && chain.mesh_shader.meshShader);
+	device.features.set(RenderFeature::FILL_MODE_NON_SOLID, core.fillModeNonSolid);
+	device.features.set(RenderFeature::DEPTH_CLAMP, core.depthClamp);
+	device.features.set(RenderFeature::WIDE_LINES, core.wideLines);
+}
+
+void VulkanRenderDriver::_check_device_extensions(Device& p_device) {
+	NOVA_AUTO_TRACE();
+
+	ScratchScope scratch;
+	std::pmr::unordered_map<std::string_view, bool> requested(scratch.get_resource()); // <extension, required>
+	if (m_window_driver) {
+		requested[VK_KHR_SWAPCHAIN_EXTENSION_NAME] = true;
+	}
+
+	// Features were already checked against the device, so their extensions must exist
+	for (u32 i = 0; i < static_cast<u32>(RenderFeature::MAX); i++) {
+		if (FEATURE_EXTENSION_MAP[i] && p_device.enabled_features.has(static_cast<RenderFeature>(i))) {
+			requested[FEATURE_EXTENSION_MAP[i]] = true;
+		}
+	}
 
 	// Check found extensions
-	for (const auto& extension : available) {
+	for (const auto& extension : _get_device_extensions(p_device.index)) {
 		if (auto it = requested.find(extension.extensionName); it != requested.end()) {
 			NOVA_INFO("Using device extension: {}", extension.extensionName);
-			m_device_extensions.push_back(it->first.data());
+			p_device.extensions.push_back(it->first.data());
 			requested.erase(it);
 		}
 	}
@@ -1157,29 +3080,98 @@ void VulkanRenderDriver::_check_device_extensions() {
 	}
 }
 
-void VulkanRenderDriver::_check_device_features() {
+void VulkanRenderDriver::_check_device_features(
+	Device& p_device,
+	FeatureChain& p_chain,
+	const RenderFeatureSet& p_required,
+	const RenderFeatureSet& p_optional
+) {
 	NOVA_AUTO_TRACE();
 
-	vkGetPhysicalDeviceFeatures(m_physical_device, &m_features);
-	// TODO: Check required features
-	// TODO: Disable unwanted features
+	const RenderFeatureSet& supported = get_device(p_device.index).features;
 
-	NOVA_WARN("{}() not implemented", NOVA_FUNC_NAME);
+	// Check required features
+	const RenderFeatureSet missing = p_required & ~supported;
+	for (u32 i = 0; i < static_cast<u32>(RenderFeature::MAX); i++) {
+		if (missing.has(static_cast<RenderFeature>(i))) {
+			NOVA_ERROR("Required device feature not supported: {}", FEATURE_NAME_MAP[i]);
+		}
+	}
+	if (missing.bits) {
+		throw std::runtime_error("Failed to find required device features");
+	}
+
+	p_device.enabled_features = (p_required | p_optional) & supported;
+	for (u32 i = 0; i < static_cast<u32>(RenderFeature::MAX); i++) {
+		const RenderFeature feature = static_cast<RenderFeature>(i);
+		if (p_device.enabled_features.has(feature)) {
+			NOVA_INFO("Using device feature: {}", FEATURE_NAME_MAP[i]);
+		} else if (p_optional.has(feature) && !p_required.has(feature)) {
+			NOVA_DEBUG("Optional device feature not supported: {}", FEATURE_NAME_MAP[i]);
+		}
+	}
+
+	// Only enable what was negotiated, everything else stays off
+	const FeatureChain& available = _get_device_features(p_device.index);
+	const auto has = [&p_device](const RenderFeature p_feature) { return p_device.enabled_features.has(p_feature); };
+
+	p_chain = {};
+	_link_features(p_chain, p_device.index, p_device.enabled_features);
+
+	VkPhysicalDeviceFeatures& core = p_chain.core.features;
+	core.multiDrawIndirect = has(RenderFeature::MULTI_DRAW_INDIRECT);
+	core.drawIndirectFirstInstance = has(RenderFeature::DRAW_INDIRECT_FIRST_INSTANCE);
+	core.samplerAnisotropy = has(RenderFeature::SAMPLER_ANISOTROPY);
+	core.textureCompressionBC = has(RenderFeature::TEXTURE_COMPRESSION_BC);
+	core.textureCompressionASTC_LDR = has(RenderFeature::TEXTURE_COMPRESSION_ASTC);
+	core.shaderInt64 = has(RenderFeature::SHADER_INT64);
+	core.fillModeNonSolid = has(RenderFeature::FILL_MODE_NON_SOLID);
+	core.depthClamp = has(RenderFeature::DEPTH_CLAMP);
+	core.wideLines = has(RenderFeature::WIDE_LINES);
+
+	VkPhysicalDeviceVulkan12Features& vulkan12 = p_chain.vulkan12;
+	vulkan12.drawIndirectCount = has(RenderFeature::DRAW_INDIRECT_COUNT);
+	vulkan12.shaderFloat16 = has(RenderFeature::SHADER_FLOAT16);
+	vulkan12.timelineSemaphore = has(RenderFeature::TIMELINE_SEMAPHORE);
+	vulkan12.bufferDeviceAddress = has(RenderFeature::BUFFER_DEVICE_ADDRESS);
+
+	if (has(RenderFeature::DESCRIPTOR_INDEXING)) {
+		const VkPhysicalDeviceVulkan12Features& source = available.vulkan12;
+		vulkan12.descriptorIndexing = VK_TRUE;
+		vulkan12.runtimeDescriptorArray = source.runtimeDescriptorArray;
+		vulkan12.descriptorBindingPartiallyBound = source.descriptorBindingPartiallyBound;
+		vulkan12.descriptorBindingVariableDescriptorCount = source.descriptorBindingVariableDescriptorCount;
+		vulkan12.shaderSampledImageArrayNonUniformIndexing = source.shaderSampledImageArrayNonUniformIndexing;
+		vulkan12.shaderStorageBufferArrayNonUniformIndexing = source.shaderStorageBufferArrayNonUniformIndexing;
+		vulkan12.shaderStorageImageArrayNonUniformIndexing = source.shaderStorageImageArrayNonUniformIndexing;
+		vulkan12.descriptorBindingSampledImageUpdateAfterBind = source.descriptorBindingSampledImageUpdateAfterBind;
+		vulkan12.descriptorBindingStorageBufferUpdateAfterBind = source.descriptorBindingStorageBufferUpdateAfterBind;
+		vulkan12.descriptorBindingStorageImageUpdateAfterBind = source.descriptorBindingStorageImageUpdateAfterBind;
+		vulkan12.descriptorBindingUpdateUnusedWhilePending = source.descriptorBindingUpdateUnusedWhilePending;
+	}
+
+	p_chain.synchronization2.synchronization2 = has(RenderFeature::SYNCHRONIZATION_2);
+	p_chain.dynamic_rendering.dynamicRendering = has(RenderFeature::DYNAMIC_RENDERING);
+	p_chain.extended_dynamic_state.extendedDynamicState = has(RenderFeature::EXTENDED_DYNAMIC_STATE);
+	p_chain.mesh_shader.taskShader = has(RenderFeature::MESH_SHADER);
+	p_chain.mesh_shader.meshShader = has(RenderFeature::MESH_SHADER);
 }
 
-void VulkanRenderDriver::_check_device_capabilities() {
+void VulkanRenderDriver::_check_device_capabilities(const Device& p_device) {
 	NOVA_AUTO_TRACE();
-	NOVA_WARN("{}() not implemented", NOVA_FUNC_NAME);
-	// TODO: Check device capabilities
+
+	const RenderDevice& device = get_device(p_device.index);
+	if (device.api_version < VK_API_VERSION_1_2) {
+		throw std::runtime_error("Device does not support Vulkan 1.2");
+	}
+	// TODO: Check limits against the renderer's needs once they are known
 }
 
-void VulkanRenderDriver::_init_queues(std::vector<VkDeviceQueueCreateInfo>& p_queues) {
+void VulkanRenderDriver::_init_queues(Device& p_device, std::vector<VkDeviceQueueCreateInfo>& p_queues) {
 	NOVA_AUTO_TRACE();
 
-	u32 count;
-	vkGetPhysicalDeviceQueueFamilyProperties(m_physical_device, &count, nullptr);
-	std::vector<VkQueueFamilyProperties> available(count);
-	vkGetPhysicalDeviceQueueFamilyProperties(m_physical_device, &count, available.data());
+	const auto& available = _get_device_queue_families(p_device.index);
+	const u32 count = static_cast<u32>(available.size());
 
 	constexpr VkQueueFlags QUEUE_MASK = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
 	static float s_priority = 1.0f;
@@ -1203,13 +3195,14 @@ void VulkanRenderDriver::_init_queues(std::vector<VkDeviceQueueCreateInfo>& p_qu
 		create.pQueuePriorities = &s_priority;
 
 		p_queues.push_back(create);
-		m_queue_families[i] = available[i].queueFlags;
+		p_device.queue_families[i] = available[i].queueFlags;
 
 		for (u32 j = 0; j < create.queueCount; j++) {
 			Queue queue;
 			queue.family_index = i;
 			queue.queue_index = j;
-			m_queues.push_back(queue);
+			queue.device = &p_device;
+			p_device.queues.push_back(queue);
 		}
 	}
 
@@ -1218,26 +3211,301 @@ void VulkanRenderDriver::_init_queues(std::vector<VkDeviceQueueCreateInfo>& p_qu
 	}
 }
 
-void VulkanRenderDriver::_init_device(const std::vector<VkDeviceQueueCreateInfo>& p_queues) {
+void VulkanRenderDriver::_init_device(
+	Device& p_device,
+	const FeatureChain& p_chain,
+	const std::vector<VkDeviceQueueCreateInfo>& p_queues
+) {
 	NOVA_AUTO_TRACE();
 
 	VkDeviceCreateInfo create {};
 	create.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
 	create.enabledLayerCount = static_cast<u32>(m_layers.size());
 	create.ppEnabledLayerNames = m_layers.data();
-	create.enabledExtensionCount = static_cast<u32>(m_device_extensions.size());
-	create.ppEnabledExtensionNames = m_device_extensions.data();
+	create.enabledExtensionCount = static_cast<u32>(p_device.extensions.size());
+	create.ppEnabledExtensionNames = p_device.extensions.data();
 	create.queueCreateInfoCount = static_cast<u32>(p_queues.size());
 	create.pQueueCreateInfos = p_queues.data();
-	create.pEnabledFeatures = &m_features;
+	create.pNext = &p_chain.core;
+	create.pEnabledFeatures = nullptr;
 
-	if (vkCreateDevice(m_physical_device, &create, get_allocator(VK_OBJECT_TYPE_DEVICE), &m_device) != VK_SUCCESS) {
+	if (vkCreateDevice(p_device.physical_device, &create, get_allocator(VK_OBJECT_TYPE_DEVICE), &p_device.handle)
+		!= VK_SUCCESS) {
 		throw std::runtime_error("Failed to create VkDevice");
 	}
 
-	for (Queue& queue : m_queues) {
-		vkGetDeviceQueue(m_device, queue.family_index, queue.queue_index, &queue.handle);
+	for (Queue& queue : p_device.queues) {
+		vkGetDeviceQueue(p_device.handle, queue.family_index, queue.queue_index, &queue.handle);
+	}
+
+	if (p_device.enabled_features.has(RenderFeature::MESH_SHADER)) {
+		p_device.draw_mesh_tasks = reinterpret_cast<PFN_vkCmdDrawMeshTasksEXT>(
+			vkGetDeviceProcAddr(p_device.handle, "vkCmdDrawMeshTasksEXT")
+		);
+		p_device.draw_mesh_tasks_indirect = reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectEXT>(
+			vkGetDeviceProcAddr(p_device.handle, "vkCmdDrawMeshTasksIndirectEXT")
+		);
+		p_device.draw_mesh_tasks_indirect_count = reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectCountEXT>(
+			vkGetDeviceProcAddr(p_device.handle, "vkCmdDrawMeshTasksIndirectCountEXT")
+		);
+		if (!p_device.draw_mesh_tasks || !p_device.draw_mesh_tasks_indirect || !p_device.draw_mesh_tasks_indirect_count) {
+			throw std::runtime_error("Failed to load mesh shader commands");
+		}
+	}
+}
+
+void VulkanRenderDriver::_init_transfer(Device& p_device) {
+	NOVA_AUTO_TRACE();
+
+	// Share the graphics family so buffers used for rendering never need an ownership transfer
+	// TODO: Use a dedicated transfer family with queue ownership transfers
+	const u32 family = _choose_queue_family(p_device, QueueType::GRAPHICS, nullptr);
+	for (Queue& queue : p_device.queues) {
+		if (queue.family_index == family) {
+			p_device.transfer_queue = &queue;
+			break;
+		}
+	}
+	if (!p_device.transfer_queue) {
+		throw std::runtime_error("Failed to find a transfer queue");
+	}
+
+	VkCommandPoolCreateInfo pool_create {};
+	pool_create.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	pool_create.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+	pool_create.queueFamilyIndex = family;
+
+	if (vkCreateCommandPool(
+			p_device.handle,
+			&pool_create,
+			get_allocator(VK_OBJECT_TYPE_COMMAND_POOL),
+			&p_device.transfer_pool
+		)
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to create transfer command pool");
+	}
+
+	VkCommandBufferAllocateInfo alloc {};
+	alloc.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	alloc.commandPool = p_device.transfer_pool;
+	alloc.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	alloc.commandBufferCount = 1;
+
+	if (vkAllocateCommandBuffers(p_device.handle, &alloc, &p_device.transfer_command_buffer) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to allocate transfer command buffer");
+	}
+
+	VkFenceCreateInfo fence_create {};
+	fence_create.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	if (vkCreateFence(p_device.handle, &fence_create, get_allocator(VK_OBJECT_TYPE_FENCE), &p_device.transfer_fence)
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to create transfer fence");
 	}
 }
 
+u32 VulkanRenderDriver::_choose_queue_family(const Device& p_device, QueueType p_type, SurfaceID p_surface) const {
+	NOVA_ASSERT(!p_device.queue_families.empty());
+
+	const VkQueueFlags mask = VK_QUEUE_FLAGS_MAP[static_cast<int>(p_type)];
+
+	u32 best_index = std::numeric_limits<u32>::max();
+	u32 best_score = std::numeric_limits<u32>::max();
+
+	for (const auto [index, flags] : p_device.queue_families) {
+		if ((flags & mask) != mask) {
+			continue;
+		}
+		if (p_surface) {
+			VkBool32 supports_present = VK_FALSE;
+			if (vkGetPhysicalDeviceSurfaceSupportKHR(p_device.physical_device, index, p_surface->handle, &supports_present)
+				!= VK_SUCCESS) {
+				continue;
+			}
+			if (!supports_present) {
+				continue;
+			}
+		}
+
+		u32 score = std::popcount(flags);
+		if (score < best_score) {
+			best_index = index;
+			best_score = score;
+		}
+	}
+
+	return best_index;
+}
+
+u32 VulkanRenderDriver::_find_memory_type(
+	const Device& p_device,
+	const u32 p_type_bits,
+	const VkMemoryPropertyFlags p_required,
+	const VkMemoryPropertyFlags p_preferred
+) const {
+	u32 fallback = std::numeric_limits<u32>::max();
+
+	for (u32 i = 0; i < p_device.memory_properties.memoryTypeCount; i++) {
+		if (!(p_type_bits & (1u << i))) {
+			continue;
+		}
+		const VkMemoryPropertyFlags flags = p_device.memory_properties.memoryTypes[i].propertyFlags;
+		if ((flags & p_required) != p_required) {
+			continue;
+		}
+		if ((flags & p_preferred) == p_preferred) {
+			return i;
+		}
+		if (fallback == std::numeric_limits<u32>::max()) {
+			fallback = i;
+		}
+	}
+
+	if (fallback == std::numeric_limits<u32>::max()) {
+		throw std::runtime_error("Failed to find a suitable memory type");
+	}
+
+	return fallback;
+}
+
+VkMemoryPropertyFlags VulkanRenderDriver::_create_buffer(
+	const Device& p_device,
+	const VkDeviceSize p_size,
+	const VkBufferUsageFlags p_usage,
+	const VkMemoryPropertyFlags p_required,
+	const VkMemoryPropertyFlags p_preferred,
+	VkBuffer& p_buffer,
+	VkDeviceMemory& p_memory
+) {
+	VkBufferCreateInfo create {};
+	create.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	create.size = p_size;
+	create.usage = p_usage;
+	create.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	if (vkCreateBuffer(p_device.handle, &create, get_allocator(VK_OBJECT_TYPE_BUFFER), &p_buffer) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to create buffer");
+	}
+
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(p_device.handle, p_buffer, &requirements);
+
+	VkMemoryAllocateInfo alloc {};
+	alloc.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc.allocationSize = requirements.size;
+	alloc.memoryTypeIndex = _find_memory_type(p_device, requirements.memoryTypeBits, p_required, p_preferred);
+
+	VkMemoryAllocateFlagsInfo flags {};
+	flags.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+	flags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+	if (p_usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
+		alloc.pNext = &flags;
+	}
+
+	if (_allocate_memory(p_device.handle, alloc, p_memory) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to allocate buffer memory");
+	}
+	vkBindBufferMemory(p_device.handle, p_buffer, p_memory, 0); // TODO: Check result
+
+	return p_device.memory_properties.memoryTypes[alloc.memoryTypeIndex].propertyFlags;
+}
+
+VkResult VulkanRenderDriver::_allocate_memory(
+	VkDevice p_device,
+	const VkMemoryAllocateInfo& p_alloc,
+	VkDeviceMemory& p_memory
+) {
+	const VkResult result =
+		vkAllocateMemory(p_device, &p_alloc, get_allocator(VK_OBJECT_TYPE_DEVICE_MEMORY), &p_memory);
+	if (result == VK_SUCCESS) {
+		std::lock_guard lock(m_memory_mutex);
+		m_memory_sizes[{p_device, p_memory}] = p_alloc.allocationSize;
+		MemoryTracker::record_allocation(MemoryTag::DEVICE, p_alloc.allocationSize);
+	}
+	return result;
+}
+
+void VulkanRenderDriver::_free_memory(VkDevice p_device, VkDeviceMemory p_memory) {
+	vkFreeMemory(p_device, p_memory, get_allocator(VK_OBJECT_TYPE_DEVICE_MEMORY));
+	std::lock_guard lock(m_memory_mutex);
+	if (const auto it = m_memory_sizes.find({p_device, p_memory}); it != m_memory_sizes.end()) {
+		MemoryTracker::record_free(MemoryTag::DEVICE, it->second);
+		m_memory_sizes.erase(it);
+	}
+}
+
+void VulkanRenderDriver::_copy_buffer_immediate(
+	Device& p_device,
+	VkBuffer p_src,
+	VkBuffer p_dst,
+	const VkBufferCopy& p_region
+) {
+	if (!p_device.transfer_pool) {
+		_init_transfer(p_device);
+	}
+
+	VkCommandBuffer cmd = p_device.transfer_command_buffer;
+	vkResetCommandPool(p_device.handle, p_device.transfer_pool, 0); // TODO: Check result
+
+	VkCommandBufferBeginInfo begin {};
+	begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	vkBeginCommandBuffer(cmd, &begin); // TODO: Check result
+
+	vkCmdCopyBuffer(cmd, p_src, p_dst, 1, &p_region);
+
+	// Staging readbacks are read by the host as soon as the fence signals
+	VkBufferMemoryBarrier barrier {};
+	barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.buffer = p_dst;
+	barrier.offset = p_region.dstOffset;
+	barrier.size = p_region.size;
+
+	vkCmdPipelineBarrier(
+		cmd,
+		VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_HOST_BIT,
+		0,
+		0,
+		nullptr,
+		1,
+		&barrier,
+		0,
+		nullptr
+	);
+	vkEndCommandBuffer(cmd); // TODO: Check result
+
+	VkSubmitInfo submit {};
+	submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit.commandBufferCount = 1;
+	submit.pCommandBuffers = &cmd;
+
+	if (vkQueueSubmit(p_device.transfer_queue->handle, 1, &submit, p_device.transfer_fence) != VK_SUCCESS) {
+		throw std::runtime_error("Failed to submit transfer");
+	}
+	if (vkWaitForFences(p_device.handle, 1, &p_device.transfer_fence, VK_TRUE, std::numeric_limits<u64>::max())
+		!= VK_SUCCESS) {
+		throw std::runtime_error("Failed to wait for transfer");
+	}
+	vkResetFences(p_device.handle, 1, &p_device.transfer_fence); // TODO: Check result
+}
+
+void VulkanRenderDriver::_release_swapchain_images(Swapchain& p_swapchain) {
+	VkDevice device = p_swapchain.device->handle;
+	for (const auto& framebuffer : p_swapchain.framebuffers) {
+		vkDestroyFramebuffer(device, framebuffer, get_allocator(VK_OBJECT_TYPE_FRAMEBUFFER));
+	}
+	for (const auto& image_view : p_swapchain.image_views) {
+		vkDestroyImageView(device, image_view, get_allocator(VK_OBJECT_TYPE_IMAGE_VIEW));
+	}
+
+	p_swapchain.framebuffers.clear();
+	p_swapchain.image_views.clear();
+	p_swapchain.images.clear();
+}
+
 #endif // NOVA_VULKAN
@@ -12,7 +12,14 @@
 
 #include <vulkan/vulkan.h>
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Nova {
@@ -29,7 +36,19 @@ namespace Nova {
 		u32 get_device_count() const override;
 		const RenderDevice& get_device(u32 index) const override;
 		bool get_device_supports_surface(u32 index, SurfaceID surface) const override;
-		void select_device(u32 index) override;
+		FormatFeature get_format_features(u32 index, DataFormat format) const override;
+		f64 probe_device(u32 index) override;
+		[[nodiscard]] DeviceID open_device(
+			u32 index,
+			const RenderFeatureSet& required,
+			const RenderFeatureSet& optional
+		) override;
+		void close_device(DeviceID device) override;
+		void set_current_device(DeviceID device) override;
+		DeviceID get_current_device() const override;
+		u32 get_device_index(DeviceID device) const override;
+		const RenderFeatureSet& get_enabled_features() const override;
+		bool has_feature(RenderFeature feature) const override;
 
 		u32 choose_queue_family(QueueType type, SurfaceID surface) override;
 
@@ -44,6 +63,23 @@ namespace Nova {
 		RenderPassID get_swapchain_render_pass(SwapchainID swapchain) const override;
 		void destroy_swapchain(SwapchainID swapchain) override;
 
+		[[nodiscard]] RenderTargetID create_render_target(u32 width, u32 height, DataFormat format) override;
+		RenderPassID get_render_target_render_pass(RenderTargetID render_target) const override;
+		std::span<const u8> get_render_target_data(RenderTargetID render_target) const override;
+		void destroy_render_target(RenderTargetID render_target) override;
+
+		[[nodiscard]] TextureID create_texture(const TextureParams& params) override;
+		u32 get_texture_mip_levels(TextureID texture) const override;
+		void destroy_texture(TextureID texture) override;
+
+		[[nodiscard]] BufferID create_buffer(u64 size, BufferUsage usage, MemoryUsage memory) override;
+		void* map_buffer(BufferID buffer) override;
+		void unmap_buffer(BufferID buffer) override;
+		void destroy_buffer(BufferID buffer) override;
+		u64 get_buffer_device_address(BufferID buffer) const override;
+		void copy_buffer_between_devices(BufferID src, BufferID dst, u64 size, u64 src_offset, u64 dst_offset)
+			override;
+
 		[[nodiscard]] ShaderID create_shader(const std::span<u8> bytes, ShaderStage stage) override;
 		void destroy_shader(ShaderID shader) override;
 
@@ -61,22 +97,156 @@ namespace Nova {
 		void begin_command_buffer(CommandBufferID command_buffer) override;
 		void end_command_buffer(CommandBufferID command_buffer) override;
 
+		void cmd_begin_render_pass(
+			CommandBufferID command_buffer,
+			RenderTargetID render_target,
+			const Vec4<f32>& clear_color
+		) override;
+		void cmd_end_render_pass(CommandBufferID command_buffer) override;
+		void cmd_bind_pipeline(CommandBufferID command_buffer, PipelineID pipeline) override;
+		void cmd_push_constants(
+			CommandBufferID command_buffer,
+			PipelineID pipeline,
+			std::span<const u8> data,
+			u32 offset
+		) override;
+		void cmd_bind_index_buffer(CommandBufferID command_buffer, BufferID buffer, IndexType type, u64 offset) override;
+		void cmd_bind_vertex_buffer(CommandBufferID command_buffer, u32 binding, BufferID buffer, u64 offset) override;
+		void cmd_set_viewport(CommandBufferID command_buffer, f32 x, f32 y, f32 width, f32 height) override;
+		void cmd_set_scissor(CommandBufferID command_buffer, i32 x, i32 y, u32 width, u32 height) override;
+		void cmd_draw(
+			CommandBufferID command_buffer,
+			u32 vertex_count,
+			u32 instance_count,
+			u32 first_vertex,
+			u32 first_instance
+		) override;
+		void cmd_draw_indexed(
+			CommandBufferID command_buffer,
+			u32 index_count,
+			u32 instance_count,
+			u32 first_index,
+			i32 vertex_offset,
+			u32 first_instance
+		) override;
+		void cmd_draw_indexed_indirect(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			u32 draw_count,
+			u32 stride
+		) override;
+		void cmd_draw_indexed_indirect_count(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			BufferID count_buffer,
+			u64 count_offset,
+			u32 max_draw_count,
+			u32 stride
+		) override;
+		void cmd_draw_mesh_tasks(CommandBufferID command_buffer, u32 x, u32 y, u32 z) override;
+		void cmd_draw_mesh_tasks_indirect(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			u32 draw_count,
+			u32 stride
+		) override;
+		void cmd_draw_mesh_tasks_indirect_count(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			u64 offset,
+			BufferID count_buffer,
+			u64 count_offset,
+			u32 max_draw_count,
+			u32 stride
+		) override;
+		void cmd_dispatch(CommandBufferID command_buffer, u32 x, u32 y, u32 z) override;
+		void cmd_dispatch_indirect(CommandBufferID command_buffer, BufferID buffer, u64 offset) override;
+		void cmd_copy_render_target(CommandBufferID command_buffer, RenderTargetID render_target) override;
+		void cmd_fill_buffer(CommandBufferID command_buffer, BufferID buffer, u64 offset, u64 size, u32 value) override;
+		void cmd_buffer_barrier(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			BufferAccess src,
+			BufferAccess dst
+		) override;
+		void cmd_copy_buffer(
+			CommandBufferID command_buffer,
+			BufferID src,
+			BufferID dst,
+			u64 size,
+			u64 src_offset,
+			u64 dst_offset
+		) override;
+		void cmd_texture_barrier(
+			CommandBufferID command_buffer,
+			TextureID texture,
+			TextureAccess src,
+			TextureAccess dst
+		) override;
+		void cmd_copy_buffer_to_texture(
+			CommandBufferID command_buffer,
+			BufferID buffer,
+			TextureID texture,
+			u32 mip_level,
+			u64 buffer_offset
+		) override;
+		void cmd_generate_mipmaps(CommandBufferID command_buffer, TextureID texture, TextureAccess dst) override;
+
+		[[nodiscard]] FenceID create_fence(bool signaled) override;
+		void wait_for_fence(FenceID fence) override;
+		void reset_fence(FenceID fence) override;
+		void destroy_fence(FenceID fence) override;
+
+		void submit(QueueID queue, CommandBufferID command_buffer, FenceID fence) override;
+		void wait_idle() override;
+
 		VkInstance get_instance() const;
-		VkAllocationCallbacks* get_allocator(VkObjectType type) const;
+		const VkAllocationCallbacks* get_allocator(VkObjectType type) const;
 
 	  private:
+		// Every feature struct the engine negotiates, linked through pNext by _link_features()
+		struct FeatureChain {
+			VkPhysicalDeviceFeatures2 core;
+			VkPhysicalDeviceVulkan12Features vulkan12;
+			VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2;
+			VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamic_rendering;
+			VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extended_dynamic_state;
+			VkPhysicalDeviceMeshShaderFeaturesEXT mesh_shader;
+		};
+
+		// Physical device queries are only made on first use and then reused. The const getters filling them can be
+		// called from any thread, so each query runs once under its flag
+		struct DeviceInfo {
+			std::once_flag features_once;
+			FeatureChain features;
+			std::once_flag memory_properties_once;
+			VkPhysicalDeviceMemoryProperties memory_properties;
+			std::once_flag queue_families_once;
+			std::vector<VkQueueFamilyProperties> queue_families;
+			std::once_flag extensions_once;
+			std::vector<VkExtensionProperties> extensions;
+			std::once_flag described_once;
+			std::optional<f64> probe_bandwidth;
+			std::unique_ptr<std::atomic<u32>[]> format_features; // FormatFeature bits, FORMAT_FEATURES_CACHED once set
+		};
+
 		WindowDriver* m_window_driver = nullptr;
 		VkInstance m_instance = VK_NULL_HANDLE;
-		VkPhysicalDevice m_physical_device = VK_NULL_HANDLE;
-		VkDevice m_device = VK_NULL_HANDLE;
-		VkPhysicalDeviceFeatures m_features = {};
 
 		std::vector<const char*> m_extensions;
 		std::vector<const char*> m_layers;
-		std::vector<const char*> m_device_extensions;
-		std::vector<RenderDevice> m_devices;
-		std::vector<Queue> m_queues;
-		std::unordered_map<u32, VkQueueFlags> m_queue_families;
+		mutable std::vector<RenderDevice> m_devices;
+		mutable std::unique_ptr<DeviceInfo[]> m_device_info;
+		std::vector<DeviceID> m_open_devices;
+		DeviceID m_current_device = nullptr;
+
+		// Size of every device memory allocation, to report it as freed. Handles are only unique per device, and
+		// resources of different threads allocate concurrently
+		std::map<std::pair<VkDevice, VkDeviceMemory>, VkDeviceSize> m_memory_sizes;
+		std::mutex m_memory_mutex;
 
 		void _check_version() const;
 		void _check_extensions();
@@ -84,11 +254,50 @@ namespace Nova {
 		void _init_instance();
 		void _init_hardware();
 
-		void _check_device_extensions();
-		void _check_device_features();
-		void _check_device_capabilities();
-		void _init_queues(std::vector<VkDeviceQueueCreateInfo>& queues);
-		void _init_device(const std::vector<VkDeviceQueueCreateInfo>& queues);
+		const FeatureChain& _get_device_features(u32 index) const;
+		const VkPhysicalDeviceMemoryProperties& _get_device_memory_properties(u32 index) const;
+		const std::vector<VkQueueFamilyProperties>& _get_device_queue_families(u32 index) const;
+		const std::vector<VkExtensionProperties>& _get_device_extensions(u32 index) const;
+		bool _has_device_extension(u32 index, std::string_view name) const;
+		void _link_features(FeatureChain& chain, u32 index, const RenderFeatureSet& features) const;
+		void _describe_device(u32 index) const;
+
+		void _check_device_extensions(Device& device);
+		void _check_device_features(
+			Device& device,
+			FeatureChain& chain,
+			const RenderFeatureSet& required,
+			const RenderFeatureSet& optional
+		);
+		void _check_device_capabilities(const Device& device);
+		void _init_queues(Device& device, std::vector<VkDeviceQueueCreateInfo>& queues);
+		void _init_device(
+			Device& device,
+			const FeatureChain& chain,
+			const std::vector<VkDeviceQueueCreateInfo>& queues
+		);
+		void _init_transfer(Device& device);
+
+		u32 _choose_queue_family(const Device& device, QueueType type, SurfaceID surface) const;
+		u32 _find_memory_type(
+			const Device& device,
+			u32 type_bits,
+			VkMemoryPropertyFlags required,
+			VkMemoryPropertyFlags preferred
+		) const;
+		VkMemoryPropertyFlags _create_buffer(
+			const Device& device,
+			VkDeviceSize size,
+			VkBufferUsageFlags usage,
+			VkMemoryPropertyFlags required,
+			VkMemoryPropertyFlags preferred,
+			VkBuffer& buffer,
+			VkDeviceMemory& memory
+		);
+		VkResult _allocate_memory(VkDevice device, const VkMemoryAllocateInfo& alloc, VkDeviceMemory& memory);
+		void _free_memory(VkDevice device, VkDeviceMemory memory);
+		void _copy_buffer_immediate(Device& device, VkBuffer src, VkBuffer dst, const VkBufferCopy& region);
+		void _release_swapchain_images(Swapchain& swapchain);
 	};
 } // namespace Nova
 
@@ -8,6 +8,7 @@
 
 /// NOTE: This header should only be included in implementation files
 
+#include <nova/core/small_vector.h>
 #include <nova/render/render_driver.h>
 #include <nova/render/render_structs.h>
 #include <nova/types.h>
@@ -15,22 +16,29 @@
 #include <vulkan/vulkan.h>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Nova {
+	struct Buffer {
+		VkBuffer handle = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkDeviceSize size = 0;
+		VkDeviceAddress address = 0;
+		void* mapped = nullptr;
+		bool host_visible = false;
+		DeviceID device = nullptr;
+	};
+
 	struct CommandBuffer {
 		VkCommandBuffer handle = VK_NULL_HANDLE;
+		DeviceID device = nullptr;
 	};
 
 	struct CommandPool {
 		VkCommandPool handle = VK_NULL_HANDLE;
-		std::vector<CommandBufferID> allocated_buffers;
-	};
-
-	struct Pipeline {
-		PipelineType type;
-		VkPipeline handle = VK_NULL_HANDLE;
-		VkPipelineLayout layout = VK_NULL_HANDLE;
+		SmallVector<CommandBufferID, 4> allocated_buffers;
+		DeviceID device = nullptr;
 	};
 
 	struct Queue {
@@ -38,16 +46,71 @@ namespace Nova {
 		u32 family_index;
 		u32 queue_index;
 		u32 usage_count = 0;
+		DeviceID device = nullptr;
+	};
+
+	// Queues are referenced by pointer, so the vector must not grow once the device is created
+	struct Device {
+		VkDevice handle = VK_NULL_HANDLE;
+		VkPhysicalDevice physical_device = VK_NULL_HANDLE;
+		u32 index = 0;
+		RenderFeatureSet enabled_features;
+		VkPhysicalDeviceMemoryProperties memory_properties = {};
+		std::vector<const char*> extensions;
+		std::vector<Queue> queues;
+		std::unordered_map<u32, VkQueueFlags> queue_families;
+
+		// Used by copies the driver records itself, created on first use
+		QueueID transfer_queue = nullptr;
+		VkCommandPool transfer_pool = VK_NULL_HANDLE;
+		VkCommandBuffer transfer_command_buffer = VK_NULL_HANDLE;
+		VkFence transfer_fence = VK_NULL_HANDLE;
+
+		// Extension commands are not exported by the loader, they are loaded when their feature is enabled
+		PFN_vkCmdDrawMeshTasksEXT draw_mesh_tasks = nullptr;
+		PFN_vkCmdDrawMeshTasksIndirectEXT draw_mesh_tasks_indirect = nullptr;
+		PFN_vkCmdDrawMeshTasksIndirectCountEXT draw_mesh_tasks_indirect_count = nullptr;
+	};
+
+	struct Fence {
+		VkFence handle = VK_NULL_HANDLE;
+		DeviceID device = nullptr;
+	};
+
+	struct Pipeline {
+		PipelineType type;
+		VkPipeline handle = VK_NULL_HANDLE;
+		VkPipelineLayout layout = VK_NULL_HANDLE;
+		VkShaderStageFlags push_constant_stages = 0;
+		DeviceID device = nullptr;
 	};
 
 	struct RenderPass {
 		VkRenderPass handle = VK_NULL_HANDLE;
+		DeviceID device = nullptr;
+	};
+
+	struct RenderTarget {
+		VkImage image = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkImageView view = VK_NULL_HANDLE;
+		VkFramebuffer framebuffer = VK_NULL_HANDLE;
+		VkBuffer readback_buffer = VK_NULL_HANDLE;
+		VkDeviceMemory readback_memory = VK_NULL_HANDLE;
+		void* readback_data = nullptr;
+		VkDeviceSize readback_size = 0;
+		VkFormat format = VK_FORMAT_UNDEFINED;
+		u32 width = 0;
+		u32 height = 0;
+		RenderPassID render_pass = nullptr;
+		DeviceID device = nullptr;
 	};
 
 	struct Shader {
 		VkShaderModule handle = VK_NULL_HANDLE;
 		ShaderStage stage = ShaderStage::VERTEX;
 		std::string name;
+		DeviceID device = nullptr;
 	};
 
 	struct Surface {
@@ -61,10 +124,24 @@ namespace Nova {
 		VkSwapchainKHR handle = VK_NULL_HANDLE;
 		VkFormat format = VK_FORMAT_UNDEFINED;
 		VkColorSpaceKHR color_space = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
-		std::vector<VkImage> images;
-		std::vector<VkImageView> image_views;
-		std::vector<VkFramebuffer> framebuffers;
+		SmallVector<VkImage, 4> images; // Rarely more than triple buffered
+		SmallVector<VkImageView, 4> image_views;
+		SmallVector<VkFramebuffer, 4> framebuffers;
 		SurfaceID surface = nullptr;
 		RenderPassID render_pass = nullptr;
+		DeviceID device = nullptr;
+	};
+
+	struct Texture {
+		VkImage image = VK_NULL_HANDLE;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkImageView view = VK_NULL_HANDLE;
+		VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+		DataFormat format = DataFormat::UNDEFINED;
+		TextureUsage usage = TextureUsage::NONE;
+		u32 width = 0;
+		u32 height = 0;
+		u32 mip_levels = 1;
+		DeviceID device = nullptr;
 	};
 } // namespace Nova
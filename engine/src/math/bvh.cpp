@@ -0,0 +1,527 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/math/bvh.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace {
+	static constexpr u32 SAH_BINS = 16;
+
+	/// Refitted subtrees are rebuilt once their surface area exceeds the area they were built with by this factor
+	static constexpr f32 REBUILD_AREA_RATIO = 2.0f;
+
+	/// The whole tree is rebuilt once more proxies than this, or an eighth of all proxies, are waiting to be inserted
+	static constexpr u32 MAX_PENDING_PROXIES = 32;
+
+	static constexpr u32 PENDING = ~0u;
+	static constexpr u32 FREE = ~0u - 1;
+	static constexpr u32 NO_PARENT = ~0u;
+	static constexpr u32 ALL_PLANES = (1u << 6) - 1;
+	static constexpr f32 INF = std::numeric_limits<f32>::infinity();
+
+	f32 get_axis(const Nova::Vec3A& p_v, const u32 p_axis) {
+		return p_axis == 0 ? p_v.x : (p_axis == 1 ? p_v.y : p_v.z);
+	}
+
+	Nova::AABB get_node_bounds(const auto& p_node) {
+		return {{p_node.min[0], p_node.min[1], p_node.min[2]}, {p_node.max[0], p_node.max[1], p_node.max[2]}};
+	}
+
+	void set_node_bounds(auto& p_node, const Nova::AABB& p_bounds) {
+		p_node.min[0] = p_bounds.min.x;
+		p_node.min[1] = p_bounds.min.y;
+		p_node.min[2] = p_bounds.min.z;
+		p_node.max[0] = p_bounds.max.x;
+		p_node.max[1] = p_bounds.max.y;
+		p_node.max[2] = p_bounds.max.z;
+	}
+
+	struct RaySlabs {
+		f32 origin[3];
+		f32 inverse_direction[3];
+
+		explicit RaySlabs(const Nova::Ray& p_ray) {
+			const Nova::Vec3A& o = p_ray.origin;
+			const Nova::Vec3A& d = p_ray.direction;
+			origin[0] = o.x;
+			origin[1] = o.y;
+			origin[2] = o.z;
+			inverse_direction[0] = 1.0f / d.x;
+			inverse_direction[1] = 1.0f / d.y;
+			inverse_direction[2] = 1.0f / d.z;
+		}
+
+		/// Returns the entry distance, or infinity when the box is missed, empty or entered beyond p_max_distance
+		f32 intersect(const f32* p_min, const f32* p_max, const f32 p_max_distance) const {
+			f32 entry = 0.0f;
+			f32 exit = p_max_distance;
+			for (u32 axis = 0; axis < 3; axis++) {
+				if (p_min[axis] > p_max[axis]) {
+					return INF;
+				}
+				f32 t_near = (p_min[axis] - origin[axis]) * inverse_direction[axis];
+				f32 t_far = (p_max[axis] - origin[axis]) * inverse_direction[axis];
+				if (t_near > t_far) {
+					std::swap(t_near, t_far);
+				}
+				entry = t_near > entry ? t_near : entry;
+				exit = t_far < exit ? t_far : exit;
+			}
+			return entry <= exit ? entry : INF;
+		}
+
+		f32 intersect(const Nova::AABB& p_box, const f32 p_max_distance) const {
+			const f32 min[3] = {p_box.min.x, p_box.min.y, p_box.min.z};
+			const f32 max[3] = {p_box.max.x, p_box.max.y, p_box.max.z};
+			return intersect(min, max, p_max_distance);
+		}
+	};
+
+	/// Clears the bits of planes that contain the whole box, returns false if any plane rejects it
+	bool classify(const Nova::Frustum& p_frustum, const f32* p_min, const f32* p_max, u32& p_mask) {
+		for (u32 p = 0; p < 6; p++) {
+			if (!(p_mask & (1u << p))) {
+				continue;
+			}
+			const Nova::Vec4<f32>& plane = p_frustum.planes[p];
+			f32 farthest = plane.w;
+			f32 nearest = plane.w;
+			for (u32 axis = 0; axis < 3; axis++) {
+				const bool positive = plane.data[axis] >= 0.0f;
+				farthest += plane.data[axis] * (positive ? p_max[axis] : p_min[axis]);
+				nearest += plane.data[axis] * (positive ? p_min[axis] : p_max[axis]);
+			}
+			if (farthest < 0.0f) {
+				return false;
+			}
+			if (nearest >= 0.0f) {
+				p_mask &= ~(1u << p);
+			}
+		}
+		return true;
+	}
+} // namespace
+
+using namespace Nova;
+
+struct BVH::BuildItem {
+	AABB bounds;
+	Vec3A centroid;
+	ProxyID proxy;
+};
+
+BVH::ProxyID BVH::create_proxy(const AABB& p_bounds, const u32 p_user_data) {
+	ProxyID proxy;
+	if (m_free.empty()) {
+		proxy = static_cast<ProxyID>(m_proxies.size());
+		m_proxies.emplace_back();
+	} else {
+		proxy = m_free.back();
+		m_free.pop_back();
+	}
+
+	m_proxies[proxy] = {p_bounds, p_user_data, PENDING};
+	m_pending.push_back(proxy);
+	m_proxy_count++;
+	return proxy;
+}
+
+void BVH::destroy_proxy(const ProxyID p_proxy) {
+	NOVA_ASSERT(p_proxy < m_proxies.size() && m_proxies[p_proxy].leaf != FREE);
+
+	Proxy& proxy = m_proxies[p_proxy];
+	if (proxy.leaf == PENDING) {
+		const auto it = std::find(m_pending.begin(), m_pending.end(), p_proxy);
+		*it = m_pending.back();
+		m_pending.pop_back();
+	} else {
+		_release_leaf(proxy.leaf);
+	}
+
+	proxy.leaf = FREE;
+	m_free.push_back(p_proxy);
+	m_proxy_count--;
+}
+
+void BVH::move_proxy(const ProxyID p_proxy, const AABB& p_bounds) {
+	NOVA_ASSERT(p_proxy < m_proxies.size() && m_proxies[p_proxy].leaf != FREE);
+
+	Proxy& proxy = m_proxies[p_proxy];
+	if (proxy.leaf != PENDING) {
+		if (p_bounds.overlaps(proxy.bounds)) {
+			m_moved_leaves.push_back(proxy.leaf);
+		} else {
+			// Refitting a jump would stretch every ancestor across the gap, so the proxy is inserted again instead
+			_release_leaf(proxy.leaf);
+			proxy.leaf = PENDING;
+			m_pending.push_back(p_proxy);
+		}
+	}
+	proxy.bounds = p_bounds;
+}
+
+const AABB& BVH::get_bounds(const ProxyID p_proxy) const {
+	NOVA_ASSERT(p_proxy < m_proxies.size() && m_proxies[p_proxy].leaf != FREE);
+	return m_proxies[p_proxy].bounds;
+}
+
+u32 BVH::get_user_data(const ProxyID p_proxy) const {
+	NOVA_ASSERT(p_proxy < m_proxies.size() && m_proxies[p_proxy].leaf != FREE);
+	return m_proxies[p_proxy].user_data;
+}
+
+u32 BVH::get_proxy_count() const {
+	return m_proxy_count;
+}
+
+AABB BVH::get_root_bounds() const {
+	return m_nodes.empty() ? AABB::empty() : get_node_bounds(m_nodes[0]);
+}
+
+void BVH::update() {
+	NOVA_AUTO_TRACE();
+
+	const u32 leaf_count = static_cast<u32>(m_nodes.size() + 1) / 2;
+	const u32 max_pending = std::max(MAX_PENDING_PROXIES, m_proxy_count / 8);
+	if ((m_nodes.empty() && !m_pending.empty()) || m_pending.size() > max_pending
+		|| m_destroyed_leaves > leaf_count / 4) {
+		rebuild();
+		return;
+	}
+	_refit();
+}
+
+void BVH::rebuild() {
+	NOVA_AUTO_TRACE();
+
+	std::vector<BuildItem> items;
+	items.reserve(m_proxy_count);
+	for (ProxyID proxy = 0; proxy < m_proxies.size(); proxy++) {
+		const AABB& bounds = m_proxies[proxy].bounds;
+		if (m_proxies[proxy].leaf != FREE) {
+			items.push_back({bounds, bounds.get_center(), proxy});
+		}
+	}
+
+	m_pending.clear();
+	m_moved_leaves.clear();
+	m_destroyed_leaves = 0;
+
+	// Every leaf holds one proxy, so a full binary tree over n proxies always has 2n - 1 nodes
+	const usize node_count = items.empty() ? 0 : items.size() * 2 - 1;
+	m_nodes.assign(node_count, {});
+	m_parents.assign(node_count, NO_PARENT);
+	m_build_areas.assign(node_count, 0.0f);
+	m_refit_flags.assign(node_count, 0);
+	if (!items.empty()) {
+		_build(0, NO_PARENT, items.data(), static_cast<u32>(items.size()));
+	}
+}
+
+void BVH::query_frustum(const Frustum& p_frustum, std::vector<u32>& p_results) const {
+	NOVA_AUTO_TRACE();
+
+	// Planes are only dropped, never added, on the way down, so at most six masks are ever saved
+	struct Saved {
+		u32 end;
+		u32 mask;
+	};
+	Saved saved[6];
+	u32 depth = 0;
+	u32 mask = ALL_PLANES;
+
+	u32 i = 0;
+	while (i < m_nodes.size()) {
+		while (depth > 0 && i >= saved[depth - 1].end) {
+			mask = saved[--depth].mask;
+		}
+
+		const Node& node = m_nodes[i];
+		u32 node_mask = mask;
+		if (!classify(p_frustum, node.min, node.max, node_mask)) {
+			i = node.escape;
+			continue;
+		}
+
+		if (node_mask == 0) {
+			// Fully inside, every leaf of the subtree is visible
+			for (u32 j = i; j < node.escape; j++) {
+				if (m_nodes[j].proxy != INVALID_PROXY) {
+					p_results.push_back(m_proxies[m_nodes[j].proxy].user_data);
+				}
+			}
+			i = node.escape;
+			continue;
+		}
+
+		if (node.proxy != INVALID_PROXY) {
+			p_results.push_back(m_proxies[node.proxy].user_data);
+		} else if (node_mask != mask && node.escape != i + 1) {
+			saved[depth++] = {node.escape, mask};
+			mask = node_mask;
+		}
+		i++;
+	}
+
+	for (const ProxyID proxy : m_pending) {
+		if (p_frustum.intersects(m_proxies[proxy].bounds)) {
+			p_results.push_back(m_proxies[proxy].user_data);
+		}
+	}
+}
+
+void BVH::query_overlap(const AABB& p_bounds, std::vector<u32>& p_results) const {
+	NOVA_AUTO_TRACE();
+
+	u32 i = 0;
+	while (i < m_nodes.size()) {
+		const Node& node = m_nodes[i];
+		const bool overlaps = node.min[0] <= p_bounds.max.x && node.min[1] <= p_bounds.max.y
+			&& node.min[2] <= p_bounds.max.z && node.max[0] >= p_bounds.min.x && node.max[1] >= p_bounds.min.y
+			&& node.max[2] >= p_bounds.min.z;
+		if (!overlaps) {
+			i = node.escape;
+			continue;
+		}
+		if (node.proxy != INVALID_PROXY) {
+			p_results.push_back(m_proxies[node.proxy].user_data);
+		}
+		i++;
+	}
+
+	for (const ProxyID proxy : m_pending) {
+		if (m_proxies[proxy].bounds.overlaps(p_bounds)) {
+			p_results.push_back(m_proxies[proxy].user_data);
+		}
+	}
+}
+
+void BVH::query_ray(const Ray& p_ray, const f32 p_max_distance, std::vector<u32>& p_results) const {
+	NOVA_AUTO_TRACE();
+
+	const RaySlabs slabs(p_ray);
+	u32 i = 0;
+	while (i < m_nodes.size()) {
+		const Node& node = m_nodes[i];
+		if (slabs.intersect(node.min, node.max, p_max_distance) == INF) {
+			i = node.escape;
+			continue;
+		}
+		if (node.proxy != INVALID_PROXY) {
+			p_results.push_back(m_proxies[node.proxy].user_data);
+		}
+		i++;
+	}
+
+	for (const ProxyID proxy : m_pending) {
+		if (slabs.intersect(m_proxies[proxy].bounds, p_max_distance) != INF) {
+			p_results.push_back(m_proxies[proxy].user_data);
+		}
+	}
+}
+
+std::optional<BVH::RayHit> BVH::raycast(const Ray& p_ray, const f32 p_max_distance, const RayTest& p_test) const {
+	NOVA_AUTO_TRACE();
+
+	const RaySlabs slabs(p_ray);
+	std::optional<RayHit> hit;
+	f32 closest = p_max_distance;
+
+	const auto test_proxy = [&](const Proxy& p_proxy, const f32 p_entry) {
+		const f32 distance = p_test ? p_test(p_proxy.user_data, p_ray) : p_entry;
+		if (distance != INF && distance <= closest) {
+			closest = distance;
+			hit = RayHit {p_proxy.user_data, distance};
+		}
+	};
+
+	// Boxes entered beyond the closest hit so far are skipped along with their subtrees
+	u32 i = 0;
+	while (i < m_nodes.size()) {
+		const Node& node = m_nodes[i];
+		const f32 entry = slabs.intersect(node.min, node.max, closest);
+		if (entry == INF) {
+			i = node.escape;
+			continue;
+		}
+		if (node.proxy != INVALID_PROXY) {
+			test_proxy(m_proxies[node.proxy], entry);
+		}
+		i++;
+	}
+
+	for (const ProxyID proxy : m_pending) {
+		const f32 entry = slabs.intersect(m_proxies[proxy].bounds, closest);
+		if (entry != INF) {
+			test_proxy(m_proxies[proxy], entry);
+		}
+	}
+	return hit;
+}
+
+void BVH::_release_leaf(const u32 p_leaf) {
+	// The leaf stays in place until the next rebuild, its empty bounds shrink its ancestors on refit
+	m_nodes[p_leaf].proxy = INVALID_PROXY;
+	m_moved_leaves.push_back(p_leaf);
+	m_destroyed_leaves++;
+}
+
+void BVH::_refit() {
+	if (m_moved_leaves.empty()) {
+		return;
+	}
+
+	std::vector<u32> refit;
+	for (const u32 leaf : m_moved_leaves) {
+		Node& node = m_nodes[leaf];
+		set_node_bounds(node, node.proxy != INVALID_PROXY ? m_proxies[node.proxy].bounds : AABB::empty());
+		for (u32 parent = m_parents[leaf]; parent != NO_PARENT && !m_refit_flags[parent]; parent = m_parents[parent]) {
+			m_refit_flags[parent] = 1;
+			refit.push_back(parent);
+		}
+	}
+	m_moved_leaves.clear();
+
+	// Children always follow their parent, so walking down the indices refits every child before its parent
+	std::sort(refit.begin(), refit.end(), std::greater<>());
+	for (const u32 index : refit) {
+		const u32 left = index + 1;
+		const u32 right = m_nodes[left].escape;
+		set_node_bounds(m_nodes[index], merge(get_node_bounds(m_nodes[left]), get_node_bounds(m_nodes[right])));
+		m_refit_flags[index] = 0;
+	}
+
+	// Walking up the indices reaches the outermost of any nested degraded subtrees first
+	u32 rebuilt_end = 0;
+	for (auto it = refit.rbegin(); it != refit.rend(); ++it) {
+		const u32 index = *it;
+		if (index < rebuilt_end) {
+			continue;
+		}
+		if (get_node_bounds(m_nodes[index]).get_surface_area() > m_build_areas[index] * REBUILD_AREA_RATIO) {
+			_rebuild_subtree(index);
+			rebuilt_end = m_nodes[index].escape;
+		}
+	}
+}
+
+u32 BVH::_build(const u32 p_node, const u32 p_parent, BuildItem* p_items, const u32 p_count) {
+	m_parents[p_node] = p_parent;
+	Node& node = m_nodes[p_node];
+
+	if (p_count == 1) {
+		set_node_bounds(node, p_items[0].bounds);
+		node.proxy = p_items[0].proxy;
+		node.escape = p_node + 1;
+		m_build_areas[p_node] = p_items[0].bounds.get_surface_area();
+		if (node.proxy != INVALID_PROXY) {
+			m_proxies[node.proxy].leaf = p_node;
+		}
+		return node.escape;
+	}
+
+	AABB bounds = AABB::empty();
+	AABB centroid_bounds = AABB::empty();
+	for (u32 i = 0; i < p_count; i++) {
+		bounds = merge(bounds, p_items[i].bounds);
+		centroid_bounds = merge(centroid_bounds, p_items[i].centroid);
+	}
+
+	// Binned SAH, the cost of a split is each side's surface area times its item count. Pairs can only split one way.
+	f32 best_cost = p_count == 2 ? 0.0f : INF;
+	u32 best_axis = 0;
+	u32 best_bin = 0;
+	for (u32 axis = 0; axis < 3 && p_count > 2; axis++) {
+		const f32 low = get_axis(centroid_bounds.min, axis);
+		const f32 extent = get_axis(centroid_bounds.max, axis) - low;
+		if (!(extent > 0.0f)) {
+			continue;
+		}
+
+		AABB bin_bounds[SAH_BINS];
+		u32 bin_counts[SAH_BINS] = {};
+		std::fill(std::begin(bin_bounds), std::end(bin_bounds), AABB::empty());
+		const f32 scale = SAH_BINS / extent;
+		for (u32 i = 0; i < p_count; i++) {
+			const f32 offset = (get_axis(p_items[i].centroid, axis) - low) * scale;
+			const u32 bin = std::min(static_cast<u32>(offset), SAH_BINS - 1);
+			bin_bounds[bin] = merge(bin_bounds[bin], p_items[i].bounds);
+			bin_counts[bin]++;
+		}
+
+		f32 right_areas[SAH_BINS];
+		u32 right_counts[SAH_BINS];
+		AABB right = AABB::empty();
+		u32 right_count = 0;
+		for (u32 bin = SAH_BINS - 1; bin > 0; bin--) {
+			right = merge(right, bin_bounds[bin]);
+			right_count += bin_counts[bin];
+			right_areas[bin] = right.get_surface_area();
+			right_counts[bin] = right_count;
+		}
+
+		AABB left = AABB::empty();
+		u32 left_count = 0;
+		for (u32 bin = 0; bin < SAH_BINS - 1; bin++) {
+			left = merge(left, bin_bounds[bin]);
+			left_count += bin_counts[bin];
+			const f32 cost = left.get_surface_area() * left_count + right_areas[bin + 1] * right_counts[bin + 1];
+			if (left_count > 0 && right_counts[bin + 1] > 0 && cost < best_cost) {
+				best_cost = cost;
+				best_axis = axis;
+				best_bin = bin;
+			}
+		}
+	}
+
+	u32 middle = p_count / 2;
+	if (p_count > 2 && best_cost != INF) {
+		const f32 low = get_axis(centroid_bounds.min, best_axis);
+		const f32 scale = SAH_BINS / (get_axis(centroid_bounds.max, best_axis) - low);
+		BuildItem* split = std::partition(p_items, p_items + p_count, [&](const BuildItem& p_item) {
+			const f32 offset = (get_axis(p_item.centroid, best_axis) - low) * scale;
+			return std::min(static_cast<u32>(offset), SAH_BINS - 1) <= best_bin;
+		});
+		middle = static_cast<u32>(split - p_items);
+	}
+	// Otherwise the centroids coincide and give SAH nothing to work with, halving still keeps the tree balanced
+
+	const u32 right = _build(p_node + 1, p_node, p_items, middle);
+	const u32 escape = _build(right, p_node, p_items + middle, p_count - middle);
+
+	Node& interior = m_nodes[p_node];
+	set_node_bounds(interior, bounds);
+	interior.proxy = INVALID_PROXY;
+	interior.escape = escape;
+	m_build_areas[p_node] = bounds.get_surface_area();
+	return escape;
+}
+
+void BVH::_rebuild_subtree(const u32 p_node) {
+	NOVA_AUTO_TRACE();
+
+	// Destroyed leaves are rebuilt as empty leaves, so the subtree keeps its node count and stays in place
+	const u32 end = m_nodes[p_node].escape;
+	const Vec3A fallback = get_node_bounds(m_nodes[p_node]).get_center();
+	std::vector<BuildItem> items;
+	for (u32 i = p_node; i < end; i++) {
+		const Node& node = m_nodes[i];
+		if (node.escape != i + 1) {
+			continue;
+		}
+		if (node.proxy != INVALID_PROXY) {
+			const AABB& bounds = m_proxies[node.proxy].bounds;
+			items.push_back({bounds, bounds.get_center(), node.proxy});
+		} else {
+			items.push_back({AABB::empty(), fallback, INVALID_PROXY});
+		}
+	}
+	_build(p_node, m_parents[p_node], items.data(), static_cast<u32>(items.size()));
+}
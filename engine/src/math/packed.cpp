@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/cpu.h>
+#include <nova/core/debug.h>
+#include <nova/math/packed.h>
+
+#ifdef NOVA_ARCH_X86_64
+#include <immintrin.h>
+#endif
+
+namespace {
+	static_assert(sizeof(Nova::Half) == sizeof(u16), "Halves are stored as their bit patterns");
+	static_assert(sizeof(Nova::OctNormal) == sizeof(u32), "Octahedral normals are written as one u32 each");
+
+	static constexpr f32 SNORM16_SCALE = 32767.0f;
+
+#ifdef NOVA_ARCH_X86_64
+	// Each SIMD kernel returns how many values it converted and leaves the remainder to the scalar loop
+
+	NOVA_TARGET("avx,f16c")
+	usize pack_halves_f16c(const f32* p_src, Nova::Half* p_dst, const usize p_count) {
+		usize i = 0;
+		for (; i + 8 <= p_count; i += 8) {
+			const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(p_src + i), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i), halves);
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx,f16c")
+	usize unpack_halves_f16c(const Nova::Half* p_src, f32* p_dst, const usize p_count) {
+		usize i = 0;
+		for (; i + 8 <= p_count; i += 8) {
+			const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i));
+			_mm256_storeu_ps(p_dst + i, _mm256_cvtph_ps(halves));
+		}
+		return i;
+	}
+
+	/// Negates the values where p_negative has all bits set
+	NOVA_TARGET("avx2")
+	inline __m256 negate_where_avx2(const __m256 p_value, const __m256 p_negative) {
+		return _mm256_xor_ps(p_value, _mm256_and_ps(p_negative, _mm256_set1_ps(-0.0f)));
+	}
+
+	/// Same rounding as Nova::pack_norm(), max() returns its second operand for NaN so NaN packs to the lowest value
+	NOVA_TARGET("avx2")
+	inline __m256i pack_snorm16_avx2(const __m256 p_value) {
+		const __m256 clamped = _mm256_min_ps(_mm256_max_ps(p_value, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+		const __m256 scaled = _mm256_mul_ps(clamped, _mm256_set1_ps(SNORM16_SCALE));
+		const __m256 negative = _mm256_cmp_ps(scaled, _mm256_setzero_ps(), _CMP_LT_OQ);
+		const __m256 rounding = negate_where_avx2(_mm256_set1_ps(0.5f), negative);
+		return _mm256_cvttps_epi32(_mm256_add_ps(scaled, rounding));
+	}
+
+	// Same steps as Nova::encode_octahedral() and Nova::pack_norm() on eight normals at a time
+	NOVA_TARGET("avx2")
+	usize pack_normals_avx2(Nova::ConstVec3Stream p_src, Nova::OctNormal* p_dst) {
+		const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256i low_bits = _mm256_set1_epi32(0xFFFF);
+
+		usize i = 0;
+		for (; i + 8 <= p_src.count; i += 8) {
+			const __m256 x = _mm256_loadu_ps(p_src.x + i);
+			const __m256 y = _mm256_loadu_ps(p_src.y + i);
+			const __m256 z = _mm256_loadu_ps(p_src.z + i);
+
+			const __m256 l1 = _mm256_add_ps(
+				_mm256_add_ps(_mm256_andnot_ps(sign_bit, x), _mm256_andnot_ps(sign_bit, y)),
+				_mm256_andnot_ps(sign_bit, z)
+			);
+			const __m256 inv_l1 = _mm256_and_ps(_mm256_div_ps(one, l1), _mm256_cmp_ps(l1, zero, _CMP_GT_OQ));
+			const __m256 px = _mm256_mul_ps(x, inv_l1);
+			const __m256 py = _mm256_mul_ps(y, inv_l1);
+
+			const __m256 fold_x = negate_where_avx2(
+				_mm256_sub_ps(one, _mm256_andnot_ps(sign_bit, py)),
+				_mm256_cmp_ps(px, zero, _CMP_LT_OQ)
+			);
+			const __m256 fold_y = negate_where_avx2(
+				_mm256_sub_ps(one, _mm256_andnot_ps(sign_bit, px)),
+				_mm256_cmp_ps(py, zero, _CMP_LT_OQ)
+			);
+			const __m256 lower = _mm256_cmp_ps(z, zero, _CMP_NGE_UQ);
+
+			const __m256i packed_x = pack_snorm16_avx2(_mm256_blendv_ps(px, fold_x, lower));
+			const __m256i packed_y = pack_snorm16_avx2(_mm256_blendv_ps(py, fold_y, lower));
+			const __m256i packed = _mm256_or_si256(
+				_mm256_and_si256(packed_x, low_bits),
+				_mm256_slli_epi32(packed_y, 16)
+			);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), packed);
+		}
+		return i;
+	}
+
+	// Same steps as Nova::unpack_norm() and Nova::decode_octahedral() on eight normals at a time
+	NOVA_TARGET("avx2")
+	usize unpack_normals_avx2(const Nova::OctNormal* p_src, Nova::Vec3Stream p_dst, const usize p_count) {
+		const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 minus_one = _mm256_set1_ps(-1.0f);
+		const __m256 scale = _mm256_set1_ps(SNORM16_SCALE);
+
+		usize i = 0;
+		for (; i + 8 <= p_count; i += 8) {
+			const __m256i packed = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i));
+			const __m256i packed_x = _mm256_srai_epi32(_mm256_slli_epi32(packed, 16), 16);
+			const __m256i packed_y = _mm256_srai_epi32(packed, 16);
+			const __m256 px = _mm256_max_ps(_mm256_div_ps(_mm256_cvtepi32_ps(packed_x), scale), minus_one);
+			const __m256 py = _mm256_max_ps(_mm256_div_ps(_mm256_cvtepi32_ps(packed_y), scale), minus_one);
+
+			const __m256 z = _mm256_sub_ps(
+				_mm256_sub_ps(one, _mm256_andnot_ps(sign_bit, px)),
+				_mm256_andnot_ps(sign_bit, py)
+			);
+			const __m256 fold = _mm256_max_ps(_mm256_xor_ps(z, sign_bit), zero);
+			const __m256 negative_fold = _mm256_xor_ps(fold, sign_bit);
+			const __m256 x = _mm256_add_ps(
+				px,
+				_mm256_blendv_ps(fold, negative_fold, _mm256_cmp_ps(px, zero, _CMP_GE_OQ))
+			);
+			const __m256 y = _mm256_add_ps(
+				py,
+				_mm256_blendv_ps(fold, negative_fold, _mm256_cmp_ps(py, zero, _CMP_GE_OQ))
+			);
+
+			const __m256 length_squared = _mm256_add_ps(
+				_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+				_mm256_mul_ps(z, z)
+			);
+			const __m256 length = _mm256_sqrt_ps(length_squared);
+			_mm256_storeu_ps(p_dst.x + i, _mm256_div_ps(x, length));
+			_mm256_storeu_ps(p_dst.y + i, _mm256_div_ps(y, length));
+			_mm256_storeu_ps(p_dst.z + i, _mm256_div_ps(z, length));
+		}
+		return i;
+	}
+#endif
+} // namespace
+
+using namespace Nova;
+
+void Nova::pack_halves(std::span<const f32> p_src, std::span<Half> p_dst) {
+	NOVA_ASSERT(p_dst.size() >= p_src.size());
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	if (CpuInfo::get().has(CpuFeature::F16C)) {
+		i = pack_halves_f16c(p_src.data(), p_dst.data(), p_src.size());
+	}
+#endif
+	for (; i < p_src.size(); i++) {
+		p_dst[i] = to_half(p_src[i]);
+	}
+}
+
+void Nova::unpack_halves(std::span<const Half> p_src, std::span<f32> p_dst) {
+	NOVA_ASSERT(p_dst.size() >= p_src.size());
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	if (CpuInfo::get().has(CpuFeature::F16C)) {
+		i = unpack_halves_f16c(p_src.data(), p_dst.data(), p_src.size());
+	}
+#endif
+	for (; i < p_src.size(); i++) {
+		p_dst[i] = to_f32(p_src[i]);
+	}
+}
+
+void Nova::pack_normals(ConstVec3Stream p_src, std::span<OctNormal> p_dst) {
+	NOVA_ASSERT(p_dst.size() >= p_src.count);
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	if (CpuInfo::get().has(CpuFeature::AVX2)) {
+		i = pack_normals_avx2(p_src, p_dst.data());
+	}
+#endif
+	for (; i < p_src.count; i++) {
+		p_dst[i] = pack_normal(Vec3A(p_src.x[i], p_src.y[i], p_src.z[i]));
+	}
+}
+
+void Nova::unpack_normals(std::span<const OctNormal> p_src, Vec3Stream p_dst) {
+	NOVA_ASSERT(p_dst.count >= p_src.size());
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	if (CpuInfo::get().has(CpuFeature::AVX2)) {
+		i = unpack_normals_avx2(p_src.data(), p_dst, p_src.size());
+	}
+#endif
+	for (; i < p_src.size(); i++) {
+		const Vec3A normal = unpack_normal(p_src[i]);
+		p_dst.x[i] = normal.x;
+		p_dst.y[i] = normal.y;
+		p_dst.z[i] = normal.z;
+	}
+}
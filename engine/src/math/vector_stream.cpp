@@ -0,0 +1,570 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/cpu.h>
+#include <nova/core/debug.h>
+#include <nova/math/vector_stream.h>
+
+#include <cmath>
+
+#ifdef NOVA_ARCH_X86_64
+#include <immintrin.h>
+#endif
+
+namespace {
+	static_assert(sizeof(Nova::Vec3<f32>) == sizeof(f32) * 3, "Vec3 arrays are reinterpreted as packed floats");
+
+	// Scalar kernels finish whatever the wide kernels leave, they also cover CPUs and targets without them
+
+	void aos_to_soa3_scalar(const f32* p_src, Nova::Vec3Stream p_dst, const usize p_begin) {
+		for (usize i = p_begin; i < p_dst.count; i++) {
+			p_dst.x[i] = p_src[i * 3 + 0];
+			p_dst.y[i] = p_src[i * 3 + 1];
+			p_dst.z[i] = p_src[i * 3 + 2];
+		}
+	}
+
+	void soa_to_aos3_scalar(Nova::ConstVec3Stream p_src, f32* p_dst, const usize p_begin) {
+		for (usize i = p_begin; i < p_src.count; i++) {
+			p_dst[i * 3 + 0] = p_src.x[i];
+			p_dst[i * 3 + 1] = p_src.y[i];
+			p_dst[i * 3 + 2] = p_src.z[i];
+		}
+	}
+
+	void aos_to_soa4_scalar(const Nova::Vec4<f32>* p_src, Nova::Vec4Stream p_dst, const usize p_begin) {
+		for (usize i = p_begin; i < p_dst.count; i++) {
+			p_dst.x[i] = p_src[i].x;
+			p_dst.y[i] = p_src[i].y;
+			p_dst.z[i] = p_src[i].z;
+			p_dst.w[i] = p_src[i].w;
+		}
+	}
+
+	void soa_to_aos4_scalar(Nova::ConstVec4Stream p_src, Nova::Vec4<f32>* p_dst, const usize p_begin) {
+		for (usize i = p_begin; i < p_src.count; i++) {
+			p_dst[i] = {p_src.x[i], p_src.y[i], p_src.z[i], p_src.w[i]};
+		}
+	}
+
+	/// p_w scales the translation column, one for points and zero for directions
+	template<bool PROJECT>
+	void transform3_scalar(
+		const Nova::Mat4& p_m,
+		const f32 p_w,
+		Nova::ConstVec3Stream p_src,
+		Nova::Vec3Stream p_dst,
+		const usize p_begin
+	) {
+		const Nova::Vec4<f32>(&c)[4] = p_m.columns;
+		for (usize i = p_begin; i < p_src.count; i++) {
+			const f32 x = p_src.x[i];
+			const f32 y = p_src.y[i];
+			const f32 z = p_src.z[i];
+			f32 rx = c[3].x * p_w + c[0].x * x + c[1].x * y + c[2].x * z;
+			f32 ry = c[3].y * p_w + c[0].y * x + c[1].y * y + c[2].y * z;
+			f32 rz = c[3].z * p_w + c[0].z * x + c[1].z * y + c[2].z * z;
+			if constexpr (PROJECT) {
+				const f32 inverse_w = 1.0f / (c[3].w * p_w + c[0].w * x + c[1].w * y + c[2].w * z);
+				rx *= inverse_w;
+				ry *= inverse_w;
+				rz *= inverse_w;
+			}
+			p_dst.x[i] = rx;
+			p_dst.y[i] = ry;
+			p_dst.z[i] = rz;
+		}
+	}
+
+	void transform4_scalar(
+		const Nova::Mat4& p_m,
+		Nova::ConstVec4Stream p_src,
+		Nova::Vec4Stream p_dst,
+		const usize p_begin
+	) {
+		const Nova::Vec4<f32>(&c)[4] = p_m.columns;
+		for (usize i = p_begin; i < p_src.count; i++) {
+			const f32 x = p_src.x[i];
+			const f32 y = p_src.y[i];
+			const f32 z = p_src.z[i];
+			const f32 w = p_src.w[i];
+			p_dst.x[i] = c[3].x * w + c[0].x * x + c[1].x * y + c[2].x * z;
+			p_dst.y[i] = c[3].y * w + c[0].y * x + c[1].y * y + c[2].y * z;
+			p_dst.z[i] = c[3].z * w + c[0].z * x + c[1].z * y + c[2].z * z;
+			p_dst.w[i] = c[3].w * w + c[0].w * x + c[1].w * y + c[2].w * z;
+		}
+	}
+
+	void normalize_scalar(Nova::ConstVec3Stream p_src, Nova::Vec3Stream p_dst, const usize p_begin) {
+		for (usize i = p_begin; i < p_src.count; i++) {
+			const f32 x = p_src.x[i];
+			const f32 y = p_src.y[i];
+			const f32 z = p_src.z[i];
+			const f32 length = std::sqrt(x * x + y * y + z * z);
+			p_dst.x[i] = x / length;
+			p_dst.y[i] = y / length;
+			p_dst.z[i] = z / length;
+		}
+	}
+
+	/// Comparing the new value first keeps the running bound when it is NaN, matching minps and maxps
+	void bounds_scalar(Nova::ConstVec3Stream p_src, Nova::Vec3A& p_min, Nova::Vec3A& p_max, const usize p_begin) {
+		for (usize i = p_begin; i < p_src.count; i++) {
+			p_min.x = p_src.x[i] < p_min.x ? p_src.x[i] : p_min.x;
+			p_min.y = p_src.y[i] < p_min.y ? p_src.y[i] : p_min.y;
+			p_min.z = p_src.z[i] < p_min.z ? p_src.z[i] : p_min.z;
+			p_max.x = p_src.x[i] > p_max.x ? p_src.x[i] : p_max.x;
+			p_max.y = p_src.y[i] > p_max.y ? p_src.y[i] : p_max.y;
+			p_max.z = p_src.z[i] > p_max.z ? p_src.z[i] : p_max.z;
+		}
+	}
+
+#ifdef NOVA_ARCH_X86_64
+	usize aos_to_soa3_sse2(const f32* p_src, Nova::Vec3Stream p_dst) {
+		usize i = 0;
+		for (; i + 4 <= p_dst.count; i += 4) {
+			// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+			const __m128 a = _mm_loadu_ps(p_src + i * 3 + 0);
+			const __m128 b = _mm_loadu_ps(p_src + i * 3 + 4);
+			const __m128 c = _mm_loadu_ps(p_src + i * 3 + 8);
+
+			const __m128 x2x3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+			const __m128 y0y1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+			const __m128 y2y3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+			const __m128 z0z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+
+			_mm_storeu_ps(p_dst.x + i, _mm_shuffle_ps(a, x2x3, _MM_SHUFFLE(2, 0, 3, 0)));
+			_mm_storeu_ps(p_dst.y + i, _mm_shuffle_ps(y0y1, y2y3, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(p_dst.z + i, _mm_shuffle_ps(z0z1, c, _MM_SHUFFLE(3, 0, 2, 0)));
+		}
+		return i;
+	}
+
+	usize soa_to_aos3_sse2(Nova::ConstVec3Stream p_src, f32* p_dst) {
+		usize i = 0;
+		for (; i + 4 <= p_src.count; i += 4) {
+			const __m128 x = _mm_loadu_ps(p_src.x + i);
+			const __m128 y = _mm_loadu_ps(p_src.y + i);
+			const __m128 z = _mm_loadu_ps(p_src.z + i);
+
+			const __m128 x0y0x1y1 = _mm_unpacklo_ps(x, y);
+			const __m128 x2y2x3y3 = _mm_unpackhi_ps(x, y);
+			const __m128 z0x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+			const __m128 y1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m128 z2x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+			const __m128 y3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+
+			_mm_storeu_ps(p_dst + i * 3 + 0, _mm_shuffle_ps(x0y0x1y1, z0x1, _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(p_dst + i * 3 + 4, _mm_shuffle_ps(y1z1, x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0)));
+			_mm_storeu_ps(p_dst + i * 3 + 8, _mm_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+		return i;
+	}
+
+	usize aos_to_soa4_sse2(const Nova::Vec4<f32>* p_src, Nova::Vec4Stream p_dst) {
+		usize i = 0;
+		for (; i + 4 <= p_dst.count; i += 4) {
+			__m128 x = _mm_load_ps(p_src[i + 0].data);
+			__m128 y = _mm_load_ps(p_src[i + 1].data);
+			__m128 z = _mm_load_ps(p_src[i + 2].data);
+			__m128 w = _mm_load_ps(p_src[i + 3].data);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(p_dst.x + i, x);
+			_mm_storeu_ps(p_dst.y + i, y);
+			_mm_storeu_ps(p_dst.z + i, z);
+			_mm_storeu_ps(p_dst.w + i, w);
+		}
+		return i;
+	}
+
+	usize soa_to_aos4_sse2(Nova::ConstVec4Stream p_src, Nova::Vec4<f32>* p_dst) {
+		usize i = 0;
+		for (; i + 4 <= p_src.count; i += 4) {
+			__m128 v0 = _mm_loadu_ps(p_src.x + i);
+			__m128 v1 = _mm_loadu_ps(p_src.y + i);
+			__m128 v2 = _mm_loadu_ps(p_src.z + i);
+			__m128 v3 = _mm_loadu_ps(p_src.w + i);
+			_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+			_mm_store_ps(p_dst[i + 0].data, v0);
+			_mm_store_ps(p_dst[i + 1].data, v1);
+			_mm_store_ps(p_dst[i + 2].data, v2);
+			_mm_store_ps(p_dst[i + 3].data, v3);
+		}
+		return i;
+	}
+
+	template<bool PROJECT>
+	NOVA_TARGET("avx2,fma")
+	usize transform3_avx2(const Nova::Mat4& p_m, const f32 p_w, Nova::ConstVec3Stream p_src, Nova::Vec3Stream p_dst) {
+		static constexpr u32 ROWS = PROJECT ? 4 : 3;
+
+		__m256 coefficients[ROWS][4];
+		for (u32 r = 0; r < ROWS; r++) {
+			for (u32 c = 0; c < 3; c++) {
+				coefficients[r][c] = _mm256_set1_ps(p_m.columns[c].data[r]);
+			}
+			coefficients[r][3] = _mm256_set1_ps(p_m.columns[3].data[r] * p_w);
+		}
+
+		usize i = 0;
+		for (; i + 8 <= p_src.count; i += 8) {
+			const __m256 x = _mm256_loadu_ps(p_src.x + i);
+			const __m256 y = _mm256_loadu_ps(p_src.y + i);
+			const __m256 z = _mm256_loadu_ps(p_src.z + i);
+
+			__m256 result[ROWS];
+			for (u32 r = 0; r < ROWS; r++) {
+				result[r] = _mm256_fmadd_ps(coefficients[r][0], x, coefficients[r][3]);
+				result[r] = _mm256_fmadd_ps(coefficients[r][1], y, result[r]);
+				result[r] = _mm256_fmadd_ps(coefficients[r][2], z, result[r]);
+			}
+			if constexpr (PROJECT) {
+				const __m256 inverse_w = _mm256_div_ps(_mm256_set1_ps(1.0f), result[3]);
+				for (u32 r = 0; r < 3; r++) {
+					result[r] = _mm256_mul_ps(result[r], inverse_w);
+				}
+			}
+
+			_mm256_storeu_ps(p_dst.x + i, result[0]);
+			_mm256_storeu_ps(p_dst.y + i, result[1]);
+			_mm256_storeu_ps(p_dst.z + i, result[2]);
+		}
+		return i;
+	}
+
+	/// Masked loads and stores cover the tail, so this always handles the whole stream
+	template<bool PROJECT>
+	NOVA_TARGET("avx512f")
+	usize transform3_avx512(const Nova::Mat4& p_m, const f32 p_w, Nova::ConstVec3Stream p_src, Nova::Vec3Stream p_dst) {
+		static constexpr u32 ROWS = PROJECT ? 4 : 3;
+
+		__m512 coefficients[ROWS][4];
+		for (u32 r = 0; r < ROWS; r++) {
+			for (u32 c = 0; c < 3; c++) {
+				coefficients[r][c] = _mm512_set1_ps(p_m.columns[c].data[r]);
+			}
+			coefficients[r][3] = _mm512_set1_ps(p_m.columns[3].data[r] * p_w);
+		}
+
+		for (usize i = 0; i < p_src.count; i += 16) {
+			const usize remaining = p_src.count - i;
+			const __mmask16 mask = remaining >= 16 ? 0xFFFF : static_cast<__mmask16>((1u << remaining) - 1);
+			const __m512 x = _mm512_maskz_loadu_ps(mask, p_src.x + i);
+			const __m512 y = _mm512_maskz_loadu_ps(mask, p_src.y + i);
+			const __m512 z = _mm512_maskz_loadu_ps(mask, p_src.z + i);
+
+			__m512 result[ROWS];
+			for (u32 r = 0; r < ROWS; r++) {
+				result[r] = _mm512_fmadd_ps(coefficients[r][0], x, coefficients[r][3]);
+				result[r] = _mm512_fmadd_ps(coefficients[r][1], y, result[r]);
+				result[r] = _mm512_fmadd_ps(coefficients[r][2], z, result[r]);
+			}
+			if constexpr (PROJECT) {
+				const __m512 inverse_w = _mm512_div_ps(_mm512_set1_ps(1.0f), result[3]);
+				for (u32 r = 0; r < 3; r++) {
+					result[r] = _mm512_mul_ps(result[r], inverse_w);
+				}
+			}
+
+			_mm512_mask_storeu_ps(p_dst.x + i, mask, result[0]);
+			_mm512_mask_storeu_ps(p_dst.y + i, mask, result[1]);
+			_mm512_mask_storeu_ps(p_dst.z + i, mask, result[2]);
+		}
+		return p_src.count;
+	}
+
+	NOVA_TARGET("avx2,fma")
+	usize transform4_avx2(const Nova::Mat4& p_m, Nova::ConstVec4Stream p_src, Nova::Vec4Stream p_dst) {
+		__m256 coefficients[4][4];
+		for (u32 r = 0; r < 4; r++) {
+			for (u32 c = 0; c < 4; c++) {
+				coefficients[r][c] = _mm256_set1_ps(p_m.columns[c].data[r]);
+			}
+		}
+
+		usize i = 0;
+		for (; i + 8 <= p_src.count; i += 8) {
+			const __m256 x = _mm256_loadu_ps(p_src.x + i);
+			const __m256 y = _mm256_loadu_ps(p_src.y + i);
+			const __m256 z = _mm256_loadu_ps(p_src.z + i);
+			const __m256 w = _mm256_loadu_ps(p_src.w + i);
+
+			__m256 result[4];
+			for (u32 r = 0; r < 4; r++) {
+				result[r] = _mm256_fmadd_ps(coefficients[r][0], x, _mm256_mul_ps(coefficients[r][3], w));
+				result[r] = _mm256_fmadd_ps(coefficients[r][1], y, result[r]);
+				result[r] = _mm256_fmadd_ps(coefficients[r][2], z, result[r]);
+			}
+
+			_mm256_storeu_ps(p_dst.x + i, result[0]);
+			_mm256_storeu_ps(p_dst.y + i, result[1]);
+			_mm256_storeu_ps(p_dst.z + i, result[2]);
+			_mm256_storeu_ps(p_dst.w + i, result[3]);
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx512f")
+	usize transform4_avx512(const Nova::Mat4& p_m, Nova::ConstVec4Stream p_src, Nova::Vec4Stream p_dst) {
+		__m512 coefficients[4][4];
+		for (u32 r = 0; r < 4; r++) {
+			for (u32 c = 0; c < 4; c++) {
+				coefficients[r][c] = _mm512_set1_ps(p_m.columns[c].data[r]);
+			}
+		}
+
+		for (usize i = 0; i < p_src.count; i += 16) {
+			const usize remaining = p_src.count - i;
+			const __mmask16 mask = remaining >= 16 ? 0xFFFF : static_cast<__mmask16>((1u << remaining) - 1);
+			const __m512 x = _mm512_maskz_loadu_ps(mask, p_src.x + i);
+			const __m512 y = _mm512_maskz_loadu_ps(mask, p_src.y + i);
+			const __m512 z = _mm512_maskz_loadu_ps(mask, p_src.z + i);
+			const __m512 w = _mm512_maskz_loadu_ps(mask, p_src.w + i);
+
+			__m512 result[4];
+			for (u32 r = 0; r < 4; r++) {
+				result[r] = _mm512_fmadd_ps(coefficients[r][0], x, _mm512_mul_ps(coefficients[r][3], w));
+				result[r] = _mm512_fmadd_ps(coefficients[r][1], y, result[r]);
+				result[r] = _mm512_fmadd_ps(coefficients[r][2], z, result[r]);
+			}
+
+			_mm512_mask_storeu_ps(p_dst.x + i, mask, result[0]);
+			_mm512_mask_storeu_ps(p_dst.y + i, mask, result[1]);
+			_mm512_mask_storeu_ps(p_dst.z + i, mask, result[2]);
+			_mm512_mask_storeu_ps(p_dst.w + i, mask, result[3]);
+		}
+		return p_src.count;
+	}
+
+	NOVA_TARGET("avx2,fma")
+	usize normalize_avx2(Nova::ConstVec3Stream p_src, Nova::Vec3Stream p_dst) {
+		usize i = 0;
+		for (; i + 8 <= p_src.count; i += 8) {
+			const __m256 x = _mm256_loadu_ps(p_src.x + i);
+			const __m256 y = _mm256_loadu_ps(p_src.y + i);
+			const __m256 z = _mm256_loadu_ps(p_src.z + i);
+			const __m256 length_squared = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+			const __m256 length = _mm256_sqrt_ps(length_squared);
+			_mm256_storeu_ps(p_dst.x + i, _mm256_div_ps(x, length));
+			_mm256_storeu_ps(p_dst.y + i, _mm256_div_ps(y, length));
+			_mm256_storeu_ps(p_dst.z + i, _mm256_div_ps(z, length));
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx512f")
+	usize normalize_avx512(Nova::ConstVec3Stream p_src, Nova::Vec3Stream p_dst) {
+		for (usize i = 0; i < p_src.count; i += 16) {
+			const usize remaining = p_src.count - i;
+			const __mmask16 mask = remaining >= 16 ? 0xFFFF : static_cast<__mmask16>((1u << remaining) - 1);
+			const __m512 x = _mm512_maskz_loadu_ps(mask, p_src.x + i);
+			const __m512 y = _mm512_maskz_loadu_ps(mask, p_src.y + i);
+			const __m512 z = _mm512_maskz_loadu_ps(mask, p_src.z + i);
+			const __m512 length_squared = _mm512_fmadd_ps(z, z, _mm512_fmadd_ps(y, y, _mm512_mul_ps(x, x)));
+			// The unmasked sqrt leaves GCC's undefined passthrough in, which warns under -Wuninitialized
+			const __m512 length = _mm512_maskz_sqrt_ps(0xFFFF, length_squared);
+			_mm512_mask_storeu_ps(p_dst.x + i, mask, _mm512_div_ps(x, length));
+			_mm512_mask_storeu_ps(p_dst.y + i, mask, _mm512_div_ps(y, length));
+			_mm512_mask_storeu_ps(p_dst.z + i, mask, _mm512_div_ps(z, length));
+		}
+		return p_src.count;
+	}
+
+	NOVA_TARGET("avx2")
+	usize bounds_avx2(Nova::ConstVec3Stream p_src, Nova::Vec3A& p_min, Nova::Vec3A& p_max) {
+		const f32* components[3] = {p_src.x, p_src.y, p_src.z};
+		f32* mins[3] = {&p_min.x, &p_min.y, &p_min.z};
+		f32* maxs[3] = {&p_max.x, &p_max.y, &p_max.z};
+
+		// One component at a time keeps a single array streaming through each pass
+		const usize end = p_src.count & ~usize(7);
+		for (u32 c = 0; c < 3; c++) {
+			__m256 low = _mm256_set1_ps(*mins[c]);
+			__m256 high = _mm256_set1_ps(*maxs[c]);
+			for (usize i = 0; i < end; i += 8) {
+				const __m256 values = _mm256_loadu_ps(components[c] + i);
+				low = _mm256_min_ps(values, low);
+				high = _mm256_max_ps(values, high);
+			}
+
+			alignas(32) f32 lows[8];
+			alignas(32) f32 highs[8];
+			_mm256_store_ps(lows, low);
+			_mm256_store_ps(highs, high);
+			for (u32 lane = 0; lane < 8; lane++) {
+				*mins[c] = lows[lane] < *mins[c] ? lows[lane] : *mins[c];
+				*maxs[c] = highs[lane] > *maxs[c] ? highs[lane] : *maxs[c];
+			}
+		}
+		return end;
+	}
+
+	/// Minimum of all lanes, like _mm512_reduce_min_ps() but every passthrough operand is defined so GCC doesn't warn
+	NOVA_TARGET("avx512f")
+	f32 reduce_min_avx512(const __m512 p_value) {
+		const __mmask16 all = 0xFFFF;
+		__m512 v = p_value;
+		v = _mm512_mask_min_ps(v, all, v, _mm512_maskz_shuffle_f32x4(all, v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+		v = _mm512_mask_min_ps(v, all, v, _mm512_maskz_shuffle_f32x4(all, v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+		v = _mm512_mask_min_ps(v, all, v, _mm512_maskz_permute_ps(all, v, _MM_SHUFFLE(1, 0, 3, 2)));
+		v = _mm512_mask_min_ps(v, all, v, _mm512_maskz_permute_ps(all, v, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm512_cvtss_f32(v);
+	}
+
+	NOVA_TARGET("avx512f")
+	f32 reduce_max_avx512(const __m512 p_value) {
+		const __mmask16 all = 0xFFFF;
+		__m512 v = p_value;
+		v = _mm512_mask_max_ps(v, all, v, _mm512_maskz_shuffle_f32x4(all, v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+		v = _mm512_mask_max_ps(v, all, v, _mm512_maskz_shuffle_f32x4(all, v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+		v = _mm512_mask_max_ps(v, all, v, _mm512_maskz_permute_ps(all, v, _MM_SHUFFLE(1, 0, 3, 2)));
+		v = _mm512_mask_max_ps(v, all, v, _mm512_maskz_permute_ps(all, v, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm512_cvtss_f32(v);
+	}
+
+	NOVA_TARGET("avx512f")
+	usize bounds_avx512(Nova::ConstVec3Stream p_src, Nova::Vec3A& p_min, Nova::Vec3A& p_max) {
+		const f32* components[3] = {p_src.x, p_src.y, p_src.z};
+		f32* mins[3] = {&p_min.x, &p_min.y, &p_min.z};
+		f32* maxs[3] = {&p_max.x, &p_max.y, &p_max.z};
+
+		for (u32 c = 0; c < 3; c++) {
+			__m512 low = _mm512_set1_ps(*mins[c]);
+			__m512 high = _mm512_set1_ps(*maxs[c]);
+			for (usize i = 0; i < p_src.count; i += 16) {
+				const usize remaining = p_src.count - i;
+				const __mmask16 mask = remaining >= 16 ? 0xFFFF : static_cast<__mmask16>((1u << remaining) - 1);
+				const __m512 values = _mm512_maskz_loadu_ps(mask, components[c] + i);
+				low = _mm512_mask_min_ps(low, mask, values, low);
+				high = _mm512_mask_max_ps(high, mask, values, high);
+			}
+			*mins[c] = reduce_min_avx512(low);
+			*maxs[c] = reduce_max_avx512(high);
+		}
+		return p_src.count;
+	}
+#endif
+
+	template<bool PROJECT>
+	void transform3(const Nova::Mat4& p_m, const f32 p_w, Nova::ConstVec3Stream p_src, Nova::Vec3Stream p_dst) {
+		NOVA_ASSERT(p_dst.count >= p_src.count);
+
+		usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+		const Nova::CpuInfo& cpu = Nova::CpuInfo::get();
+		if (cpu.has(Nova::CpuFeature::AVX512F)) {
+			i = transform3_avx512<PROJECT>(p_m, p_w, p_src, p_dst);
+		} else if (cpu.has(Nova::CpuFeature::AVX2) && cpu.has(Nova::CpuFeature::FMA)) {
+			i = transform3_avx2<PROJECT>(p_m, p_w, p_src, p_dst);
+		}
+#endif
+		transform3_scalar<PROJECT>(p_m, p_w, p_src, p_dst, i);
+	}
+} // namespace
+
+using namespace Nova;
+
+void Nova::aos_to_soa(std::span<const Vec3<f32>> p_src, Vec3Stream p_dst) {
+	NOVA_ASSERT(p_dst.count >= p_src.size());
+
+	const f32* src = reinterpret_cast<const f32*>(p_src.data());
+	p_dst.count = p_src.size();
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	i = aos_to_soa3_sse2(src, p_dst);
+#endif
+	aos_to_soa3_scalar(src, p_dst, i);
+}
+
+void Nova::aos_to_soa(std::span<const Vec4<f32>> p_src, Vec4Stream p_dst) {
+	NOVA_ASSERT(p_dst.count >= p_src.size());
+
+	p_dst.count = p_src.size();
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	i = aos_to_soa4_sse2(p_src.data(), p_dst);
+#endif
+	aos_to_soa4_scalar(p_src.data(), p_dst, i);
+}
+
+void Nova::soa_to_aos(ConstVec3Stream p_src, std::span<Vec3<f32>> p_dst) {
+	NOVA_ASSERT(p_dst.size() >= p_src.count);
+
+	f32* dst = reinterpret_cast<f32*>(p_dst.data());
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	i = soa_to_aos3_sse2(p_src, dst);
+#endif
+	soa_to_aos3_scalar(p_src, dst, i);
+}
+
+void Nova::soa_to_aos(ConstVec4Stream p_src, std::span<Vec4<f32>> p_dst) {
+	NOVA_ASSERT(p_dst.size() >= p_src.count);
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	i = soa_to_aos4_sse2(p_src, p_dst.data());
+#endif
+	soa_to_aos4_scalar(p_src, p_dst.data(), i);
+}
+
+void Nova::transform_points(const Mat4& p_matrix, ConstVec3Stream p_src, Vec3Stream p_dst) {
+	transform3<false>(p_matrix, 1.0f, p_src, p_dst);
+}
+
+void Nova::transform_vectors(const Mat4& p_matrix, ConstVec3Stream p_src, Vec3Stream p_dst) {
+	transform3<false>(p_matrix, 0.0f, p_src, p_dst);
+}
+
+void Nova::transform(const Mat4& p_matrix, ConstVec4Stream p_src, Vec4Stream p_dst) {
+	NOVA_ASSERT(p_dst.count >= p_src.count);
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	const CpuInfo& cpu = CpuInfo::get();
+	if (cpu.has(CpuFeature::AVX512F)) {
+		i = transform4_avx512(p_matrix, p_src, p_dst);
+	} else if (cpu.has(CpuFeature::AVX2) && cpu.has(CpuFeature::FMA)) {
+		i = transform4_avx2(p_matrix, p_src, p_dst);
+	}
+#endif
+	transform4_scalar(p_matrix, p_src, p_dst, i);
+}
+
+void Nova::project_points(const Mat4& p_matrix, ConstVec3Stream p_src, Vec3Stream p_dst) {
+	transform3<true>(p_matrix, 1.0f, p_src, p_dst);
+}
+
+void Nova::normalize(ConstVec3Stream p_src, Vec3Stream p_dst) {
+	NOVA_ASSERT(p_dst.count >= p_src.count);
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	const CpuInfo& cpu = CpuInfo::get();
+	if (cpu.has(CpuFeature::AVX512F)) {
+		i = normalize_avx512(p_src, p_dst);
+	} else if (cpu.has(CpuFeature::AVX2) && cpu.has(CpuFeature::FMA)) {
+		i = normalize_avx2(p_src, p_dst);
+	}
+#endif
+	normalize_scalar(p_src, p_dst, i);
+}
+
+AABB Nova::compute_bounds(ConstVec3Stream p_src) {
+	AABB bounds = AABB::empty();
+
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	const CpuInfo& cpu = CpuInfo::get();
+	if (cpu.has(CpuFeature::AVX512F)) {
+		i = bounds_avx512(p_src, bounds.min, bounds.max);
+	} else if (cpu.has(CpuFeature::AVX2)) {
+		i = bounds_avx2(p_src, bounds.min, bounds.max);
+	}
+#endif
+	bounds_scalar(p_src, bounds.min, bounds.max, i);
+	return bounds;
+}
@@ -20,6 +20,7 @@
 #endif
 
 #include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
 #include <nova/render/render_driver.h>
 
 #include <ranges>
@@ -59,6 +60,7 @@ std::string X11WindowDriver::get_api_name() const {
 }
 
 void X11WindowDriver::poll_events() {
+	NOVA_MEMORY_SCOPE(MemoryTag::PLATFORM);
 	while (XPending(m_display)) {
 		XEvent event;
 		XNextEvent(m_display, &event);
@@ -110,6 +112,7 @@ u32 X11WindowDriver::get_window_count() const {
 
 WindowID X11WindowDriver::create_window(const std::string& p_title, const u32 p_width, const u32 p_height) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::PLATFORM);
 
 	X11::Window handle = XCreateSimpleWindow(m_display, DefaultRootWindow(m_display), 0, 0, p_width, p_height, 0, 0, 0);
 
@@ -163,6 +166,7 @@ const char* X11WindowDriver::get_surface_extension() const {
 
 SurfaceID X11WindowDriver::create_surface(WindowID p_window, RenderDriver* p_driver) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::PLATFORM);
 	NOVA_ASSERT(p_window);
 	NOVA_ASSERT(p_driver);
 	NOVA_ASSERT(p_driver->get_api() == RenderAPI::VULKAN);
@@ -9,12 +9,14 @@
 #include "platform/windows/window_driver.h" // IWYU pragma: keep
 
 #include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
 #include <nova/platform/window_driver.h>
 
 using namespace Nova;
 
 WindowDriver* WindowDriver::create() {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::PLATFORM);
 #ifdef NOVA_WINDOWS
 	return new Win32WindowDriver();
 #elif NOVA_LINUX
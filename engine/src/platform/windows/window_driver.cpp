@@ -19,6 +19,7 @@
 #endif
 
 #include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
 #include <nova/render/render_driver.h>
 
 namespace {
@@ -56,6 +57,7 @@ std::string Win32WindowDriver::get_api_name() const {
 }
 
 void Win32WindowDriver::poll_events() {
+	NOVA_MEMORY_SCOPE(MemoryTag::PLATFORM);
 	MSG msg;
 	while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
 		TranslateMessage(&msg);
@@ -73,6 +75,7 @@ u32 Win32WindowDriver::get_window_count() const {
 
 WindowID Win32WindowDriver::create_window(const std::string& p_title, u32 p_width, u32 p_height) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::PLATFORM);
 
 	RECT rect = {0, 0, static_cast<LONG>(p_width), static_cast<LONG>(p_height)};
 	AdjustWindowRect(&rect, WS_OVERLAPPEDWINDOW, FALSE);
@@ -141,6 +144,7 @@ const char* Win32WindowDriver::get_surface_extension() const {
 
 SurfaceID Win32WindowDriver::create_surface(WindowID p_window, RenderDriver* p_driver) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::PLATFORM);
 	NOVA_ASSERT(p_window);
 	NOVA_ASSERT(p_driver);
 	NOVA_ASSERT(p_driver->get_api() == RenderAPI::VULKAN);
@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/cpu.h>
+#include <nova/core/debug.h>
+#include <nova/render/cpu_culling.h>
+
+#include <array>
+#include <bit>
+
+#ifdef NOVA_ARCH_X86_64
+#include <immintrin.h>
+#endif
+
+namespace {
+	static constexpr u32 PLANE_COUNT = 6;
+
+	/**
+	 * Box planes split into positive and negative normal components. Dotting them with the max and min corners gives
+	 * the distance of the corner furthest along the normal without a per-plane select.
+	 */
+	struct BoxPlane {
+		f32 positive[3];
+		f32 negative[3];
+		f32 w;
+	};
+
+	using BoxPlanes = std::array<BoxPlane, Nova::MAX_CULL_FRUSTA * PLANE_COUNT>;
+
+	struct CullOutput {
+		u32* visible;
+		u32* masks;
+		u32 count = 0;
+
+		void push(const u32 p_index, const u32 p_mask) {
+			if (p_mask != 0) {
+				visible[count] = p_index;
+				if (masks) {
+					masks[count] = p_mask;
+				}
+				count++;
+			}
+		}
+	};
+
+	BoxPlanes split_box_planes(std::span<const Nova::Frustum> p_frusta) {
+		BoxPlanes planes;
+		for (usize f = 0; f < p_frusta.size(); f++) {
+			for (u32 p = 0; p < PLANE_COUNT; p++) {
+				const Nova::Vec4<f32>& plane = p_frusta[f].planes[p];
+				BoxPlane& split = planes[f * PLANE_COUNT + p];
+				for (u32 i = 0; i < 3; i++) {
+					split.positive[i] = plane.data[i] > 0.0f ? plane.data[i] : 0.0f;
+					split.negative[i] = plane.data[i] < 0.0f ? plane.data[i] : 0.0f;
+				}
+				split.w = plane.w;
+			}
+		}
+		return planes;
+	}
+
+	void cull_spheres_scalar(
+		std::span<const Nova::Frustum> p_frusta,
+		Nova::ConstVec4Stream p_spheres,
+		const u32 p_begin,
+		const u32 p_end,
+		CullOutput& p_output
+	) {
+		for (u32 i = p_begin; i < p_end; i++) {
+			u32 mask = 0;
+			for (usize f = 0; f < p_frusta.size(); f++) {
+				bool inside = true;
+				for (const Nova::Vec4<f32>& plane : p_frusta[f].planes) {
+					const f32 distance = plane.x * p_spheres.x[i] + plane.y * p_spheres.y[i] + plane.z * p_spheres.z[i]
+						+ plane.w;
+					inside &= distance >= -p_spheres.w[i];
+				}
+				mask |= static_cast<u32>(inside) << f;
+			}
+			p_output.push(i, mask);
+		}
+	}
+
+	void cull_aabbs_scalar(
+		const BoxPlanes& p_planes,
+		const usize p_frustum_count,
+		Nova::ConstVec3Stream p_min,
+		Nova::ConstVec3Stream p_max,
+		const u32 p_begin,
+		const u32 p_end,
+		CullOutput& p_output
+	) {
+		for (u32 i = p_begin; i < p_end; i++) {
+			u32 mask = 0;
+			for (usize f = 0; f < p_frustum_count; f++) {
+				bool inside = true;
+				for (u32 p = 0; p < PLANE_COUNT; p++) {
+					const BoxPlane& plane = p_planes[f * PLANE_COUNT + p];
+					const f32 distance = plane.w + plane.positive[0] * p_max.x[i] + plane.negative[0] * p_min.x[i]
+						+ plane.positive[1] * p_max.y[i] + plane.negative[1] * p_min.y[i]
+						+ plane.positive[2] * p_max.z[i] + plane.negative[2] * p_min.z[i];
+					inside &= distance >= 0.0f;
+				}
+				mask |= static_cast<u32>(inside) << f;
+			}
+			p_output.push(i, mask);
+		}
+	}
+
+#ifdef NOVA_ARCH_X86_64
+	// Lane indices of the set bits of every 8-bit mask, packed four bits each from the lowest
+	static constexpr std::array<u32, 256> COMPRESS_TABLE = [] {
+		std::array<u32, 256> table {};
+		for (u32 mask = 0; mask < 256; mask++) {
+			u32 slot = 0;
+			for (u32 lane = 0; lane < 8; lane++) {
+				if (mask & (1u << lane)) {
+					table[mask] |= lane << (slot++ * 4);
+				}
+			}
+		}
+		return table;
+	}();
+
+	/// Moves the visible lanes to the front and stores all eight, the next store overwrites the rest
+	NOVA_TARGET("avx2")
+	inline void compact_avx2(const __m256i p_masks, const u32 p_index, CullOutput& p_output) {
+		const __m256i hidden = _mm256_cmpeq_epi32(p_masks, _mm256_setzero_si256());
+		const u32 visible = ~static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(hidden))) & 0xFF;
+
+		const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+		const __m256i lanes = _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<i32>(COMPRESS_TABLE[visible])), shifts);
+		const __m256i permutation = _mm256_and_si256(lanes, _mm256_set1_epi32(7));
+
+		const __m256i indices = _mm256_add_epi32(
+			_mm256_set1_epi32(static_cast<i32>(p_index)),
+			_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)
+		);
+		_mm256_storeu_si256(
+			reinterpret_cast<__m256i*>(p_output.visible + p_output.count),
+			_mm256_permutevar8x32_epi32(indices, permutation)
+		);
+		if (p_output.masks) {
+			_mm256_storeu_si256(
+				reinterpret_cast<__m256i*>(p_output.masks + p_output.count),
+				_mm256_permutevar8x32_epi32(p_masks, permutation)
+			);
+		}
+		p_output.count += static_cast<u32>(std::popcount(visible));
+	}
+
+	NOVA_TARGET("avx2,fma")
+	u32 cull_spheres_avx2(
+		std::span<const Nova::Frustum> p_frusta,
+		Nova::ConstVec4Stream p_spheres,
+		const u32 p_begin,
+		const u32 p_end,
+		CullOutput& p_output
+	) {
+		u32 i = p_begin;
+		for (; i + 8 <= p_end; i += 8) {
+			const __m256 x = _mm256_loadu_ps(p_spheres.x + i);
+			const __m256 y = _mm256_loadu_ps(p_spheres.y + i);
+			const __m256 z = _mm256_loadu_ps(p_spheres.z + i);
+			const __m256 negative_radius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(p_spheres.w + i));
+
+			__m256i masks = _mm256_setzero_si256();
+			for (usize f = 0; f < p_frusta.size(); f++) {
+				__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (const Nova::Vec4<f32>& plane : p_frusta[f].planes) {
+					__m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.x), x, _mm256_set1_ps(plane.w));
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.y), y, distance);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.z), z, distance);
+					inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negative_radius, _CMP_GE_OQ));
+				}
+				const __m256i bit = _mm256_set1_epi32(static_cast<i32>(1u << f));
+				masks = _mm256_or_si256(masks, _mm256_and_si256(_mm256_castps_si256(inside), bit));
+			}
+			compact_avx2(masks, i, p_output);
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx2,fma")
+	u32 cull_aabbs_avx2(
+		const BoxPlanes& p_planes,
+		const usize p_frustum_count,
+		Nova::ConstVec3Stream p_min,
+		Nova::ConstVec3Stream p_max,
+		const u32 p_begin,
+		const u32 p_end,
+		CullOutput& p_output
+	) {
+		u32 i = p_begin;
+		for (; i + 8 <= p_end; i += 8) {
+			const __m256 min_x = _mm256_loadu_ps(p_min.x + i);
+			const __m256 min_y = _mm256_loadu_ps(p_min.y + i);
+			const __m256 min_z = _mm256_loadu_ps(p_min.z + i);
+			const __m256 max_x = _mm256_loadu_ps(p_max.x + i);
+			const __m256 max_y = _mm256_loadu_ps(p_max.y + i);
+			const __m256 max_z = _mm256_loadu_ps(p_max.z + i);
+
+			__m256i masks = _mm256_setzero_si256();
+			for (usize f = 0; f < p_frustum_count; f++) {
+				__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (u32 p = 0; p < PLANE_COUNT; p++) {
+					const BoxPlane& plane = p_planes[f * PLANE_COUNT + p];
+					__m256 distance = _mm256_set1_ps(plane.w);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.positive[0]), max_x, distance);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.negative[0]), min_x, distance);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.positive[1]), max_y, distance);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.negative[1]), min_y, distance);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.positive[2]), max_z, distance);
+					distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.negative[2]), min_z, distance);
+					inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+				}
+				const __m256i bit = _mm256_set1_epi32(static_cast<i32>(1u << f));
+				masks = _mm256_or_si256(masks, _mm256_and_si256(_mm256_castps_si256(inside), bit));
+			}
+			compact_avx2(masks, i, p_output);
+		}
+		return i;
+	}
+#endif
+
+	bool has_avx2_fma() {
+#ifdef NOVA_ARCH_X86_64
+		const Nova::CpuInfo& cpu = Nova::CpuInfo::get();
+		return cpu.has(Nova::CpuFeature::AVX2) && cpu.has(Nova::CpuFeature::FMA);
+#else
+		return false;
+#endif
+	}
+} // namespace
+
+using namespace Nova;
+
+u32 Nova::cull_spheres(
+	std::span<const Frustum> p_frusta,
+	ConstVec4Stream p_spheres,
+	const u32 p_first,
+	const u32 p_count,
+	std::span<u32> p_visible,
+	std::span<u32> p_masks
+) {
+	NOVA_ASSERT(p_frusta.size() <= MAX_CULL_FRUSTA);
+	NOVA_ASSERT(usize(p_first) + p_count <= p_spheres.count);
+	NOVA_ASSERT(p_visible.size() >= p_count);
+	NOVA_ASSERT(p_masks.empty() || p_masks.size() >= p_count);
+
+	CullOutput output = {p_visible.data(), p_masks.empty() ? nullptr : p_masks.data()};
+	const u32 end = p_first + p_count;
+	u32 i = p_first;
+#ifdef NOVA_ARCH_X86_64
+	if (has_avx2_fma()) {
+		i = cull_spheres_avx2(p_frusta, p_spheres, p_first, end, output);
+	}
+#endif
+	cull_spheres_scalar(p_frusta, p_spheres, i, end, output);
+	return output.count;
+}
+
+u32 Nova::cull_aabbs(
+	std::span<const Frustum> p_frusta,
+	ConstVec3Stream p_min,
+	ConstVec3Stream p_max,
+	const u32 p_first,
+	const u32 p_count,
+	std::span<u32> p_visible,
+	std::span<u32> p_masks
+) {
+	NOVA_ASSERT(p_frusta.size() <= MAX_CULL_FRUSTA);
+	NOVA_ASSERT(usize(p_first) + p_count <= p_min.count && usize(p_first) + p_count <= p_max.count);
+	NOVA_ASSERT(p_visible.size() >= p_count);
+	NOVA_ASSERT(p_masks.empty() || p_masks.size() >= p_count);
+
+	const BoxPlanes planes = split_box_planes(p_frusta);
+	CullOutput output = {p_visible.data(), p_masks.empty() ? nullptr : p_masks.data()};
+	const u32 end = p_first + p_count;
+	u32 i = p_first;
+#ifdef NOVA_ARCH_X86_64
+	if (has_avx2_fma()) {
+		i = cull_aabbs_avx2(planes, p_frusta.size(), p_min, p_max, p_first, end, output);
+	}
+#endif
+	cull_aabbs_scalar(planes, p_frusta.size(), p_min, p_max, i, end, output);
+	return output.count;
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/render/draw_batcher.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+	// Sort key layout, most expensive state change in the highest bits
+	static constexpr u32 MESH_BITS = 20;
+	static constexpr u32 MATERIAL_BITS = 28;
+	static constexpr u32 PIPELINE_BITS = 16;
+	static_assert(MESH_BITS + MATERIAL_BITS + PIPELINE_BITS == 64);
+
+	static constexpr u64 MESH_MASK = (u64(1) << MESH_BITS) - 1;
+	static constexpr u64 MATERIAL_MASK = (u64(1) << MATERIAL_BITS) - 1;
+	static constexpr u64 PIPELINE_MASK = (u64(1) << PIPELINE_BITS) - 1;
+} // namespace
+
+using namespace Nova;
+
+DrawBatcher::DrawBatcher(RenderDriver* p_driver, const Params& p_params) : m_driver(p_driver), m_params(p_params) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_driver);
+	NOVA_ASSERT(p_params.instance_stride > 0);
+	NOVA_ASSERT(p_params.max_instances > 0);
+	NOVA_ASSERT(p_params.frames_in_flight > 0);
+
+	const u64 size = u64(p_params.instance_stride) * p_params.max_instances * p_params.frames_in_flight;
+	m_instance_buffer = m_driver->create_buffer(size, BufferUsage::VERTEX, MemoryUsage::CPU_TO_GPU);
+	m_instance_data = static_cast<u8*>(m_driver->map_buffer(m_instance_buffer));
+}
+
+DrawBatcher::~DrawBatcher() {
+	NOVA_AUTO_TRACE();
+	m_driver->unmap_buffer(m_instance_buffer);
+	m_driver->destroy_buffer(m_instance_buffer);
+}
+
+u32 DrawBatcher::add_mesh(const BatchMesh& p_mesh) {
+	NOVA_ASSERT(p_mesh.vertex_buffer);
+	NOVA_ASSERT(p_mesh.index_buffer);
+	NOVA_ASSERT(m_meshes.size() <= MESH_MASK);
+	m_meshes.push_back(p_mesh);
+	return static_cast<u32>(m_meshes.size() - 1);
+}
+
+void DrawBatcher::begin_frame(const u32 p_frame_index) {
+	m_frame_index = p_frame_index % m_params.frames_in_flight;
+	m_frame_used = 0;
+	m_requests.clear();
+	m_staged.clear();
+	m_stats = {};
+}
+
+void DrawBatcher::submit(PipelineID p_pipeline, const u32 p_mesh, const u32 p_material, std::span<const u8> p_data) {
+	NOVA_ASSERT(p_pipeline);
+	NOVA_ASSERT(p_mesh < m_meshes.size());
+	NOVA_ASSERT(p_material <= MATERIAL_MASK);
+	NOVA_ASSERT(p_data.size() == m_params.instance_stride);
+
+	m_stats.submitted++;
+	if (m_frame_used + m_requests.size() == m_params.max_instances) {
+		m_stats.dropped++;
+		return;
+	}
+
+	const u64 key = (u64(_get_pipeline_index(p_pipeline)) << (MATERIAL_BITS + MESH_BITS))
+		| (u64(p_material) << MESH_BITS) | p_mesh;
+	m_requests.push_back({key, static_cast<u32>(m_staged.size())});
+	m_staged.insert(m_staged.end(), p_data.begin(), p_data.end());
+}
+
+void DrawBatcher::cmd_flush(CommandBufferID p_command_buffer) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_command_buffer);
+
+	if (m_stats.dropped) {
+		NOVA_WARN("Draw batcher dropped {} instances over its limit of {}", m_stats.dropped, m_params.max_instances);
+	}
+	if (m_requests.empty()) {
+		return;
+	}
+
+	// Stable so instances of one batch keep their submission order
+	std::stable_sort(m_requests.begin(), m_requests.end(), [](const Request& p_a, const Request& p_b) {
+		return p_a.key < p_b.key;
+	});
+
+	const u32 stride = m_params.instance_stride;
+	const u64 frame_offset = u64(m_frame_index) * m_params.max_instances * stride;
+	u8* out = m_instance_data + frame_offset + u64(m_frame_used) * stride;
+	for (const Request& request : m_requests) {
+		std::memcpy(out, m_staged.data() + request.data_offset, stride);
+		out += stride;
+	}
+
+	m_driver->cmd_bind_vertex_buffer(p_command_buffer, m_params.instance_binding, m_instance_buffer, frame_offset);
+
+	u64 bound_pipeline = ~u64(0);
+	u64 bound_material = ~u64(0);
+	const BatchMesh* bound_mesh = nullptr;
+
+	for (usize begin = 0; begin < m_requests.size();) {
+		const u64 key = m_requests[begin].key;
+		usize end = begin + 1;
+		while (end < m_requests.size() && m_requests[end].key == key) {
+			end++;
+		}
+
+		const u64 pipeline_index = (key >> (MATERIAL_BITS + MESH_BITS)) & PIPELINE_MASK;
+		const u64 material = (key >> MESH_BITS) & MATERIAL_MASK;
+		const BatchMesh& mesh = m_meshes[key & MESH_MASK];
+		PipelineID pipeline = m_pipelines[pipeline_index];
+
+		if (pipeline_index != bound_pipeline) {
+			m_driver->cmd_bind_pipeline(p_command_buffer, pipeline);
+			m_stats.pipeline_binds++;
+			bound_pipeline = pipeline_index;
+			bound_material = ~u64(0);
+		}
+		if (material != bound_material) {
+			if (m_params.bind_material) {
+				m_params.bind_material(p_command_buffer, pipeline, static_cast<u32>(material));
+			}
+			m_stats.material_binds++;
+			bound_material = material;
+		}
+		if (!bound_mesh || mesh.vertex_buffer != bound_mesh->vertex_buffer) {
+			m_driver->cmd_bind_vertex_buffer(p_command_buffer, 0, mesh.vertex_buffer);
+		}
+		if (!bound_mesh || mesh.index_buffer != bound_mesh->index_buffer || mesh.index_type != bound_mesh->index_type) {
+			m_driver->cmd_bind_index_buffer(p_command_buffer, mesh.index_buffer, mesh.index_type);
+		}
+		bound_mesh = &mesh;
+
+		m_driver->cmd_draw_indexed(
+			p_command_buffer,
+			mesh.index_count,
+			static_cast<u32>(end - begin),
+			mesh.first_index,
+			mesh.vertex_offset,
+			m_frame_used + static_cast<u32>(begin)
+		);
+		m_stats.draws++;
+		begin = end;
+	}
+
+	m_frame_used += static_cast<u32>(m_requests.size());
+	m_requests.clear();
+	m_staged.clear();
+}
+
+const BatchStats& DrawBatcher::get_stats() const {
+	return m_stats;
+}
+
+u32 DrawBatcher::_get_pipeline_index(PipelineID p_pipeline) {
+	// A frame uses a handful of pipelines, a linear scan beats hashing
+	for (u32 i = 0; i < m_pipelines.size(); i++) {
+		if (m_pipelines[i] == p_pipeline) {
+			return i;
+		}
+	}
+	NOVA_ASSERT(m_pipelines.size() <= PIPELINE_MASK);
+	m_pipelines.push_back(p_pipeline);
+	return static_cast<u32>(m_pipelines.size() - 1);
+}
@@ -0,0 +1,295 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/cpu.h>
+#include <nova/core/debug.h>
+#include <nova/math/packed.h>
+#include <nova/render/format_conversion.h>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#ifdef NOVA_ARCH_X86_64
+#include <immintrin.h>
+#endif
+
+namespace {
+	static constexpr u32 OPAQUE_ALPHA = 0xFF000000;
+
+	// Decoded sRGB values followed by linear values for alpha, so both can be gathered with one table
+	const std::array<f32, 512>& get_srgb_table() {
+		static const std::array<f32, 512> table = [] {
+			std::array<f32, 512> values;
+			for (u32 i = 0; i < 256; i++) {
+				const f32 c = static_cast<f32>(i) / 255.0f;
+				values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+				values[256 + i] = c;
+			}
+			return values;
+		}();
+		return table;
+	}
+
+	void swizzle_scalar(const u8* p_src, u8* p_dst, usize p_index, const usize p_count) {
+		for (; p_index < p_count; p_index++) {
+			u32 texel;
+			std::memcpy(&texel, p_src + p_index * 4, sizeof(texel));
+			texel = (texel & 0xFF00FF00) | ((texel >> 16) & 0xFF) | ((texel & 0xFF) << 16);
+			std::memcpy(p_dst + p_index * 4, &texel, sizeof(texel));
+		}
+	}
+
+	void expand_r8_scalar(const u8* p_src, u8* p_dst, usize p_index, const usize p_count) {
+		for (; p_index < p_count; p_index++) {
+			const u32 texel = p_src[p_index] * 0x010101u | OPAQUE_ALPHA;
+			std::memcpy(p_dst + p_index * 4, &texel, sizeof(texel));
+		}
+	}
+
+	void expand_rgb8_scalar(const u8* p_src, u8* p_dst, usize p_index, const usize p_count) {
+		for (; p_index < p_count; p_index++) {
+			p_dst[p_index * 4 + 0] = p_src[p_index * 3 + 0];
+			p_dst[p_index * 4 + 1] = p_src[p_index * 3 + 1];
+			p_dst[p_index * 4 + 2] = p_src[p_index * 3 + 2];
+			p_dst[p_index * 4 + 3] = 0xFF;
+		}
+	}
+
+	void srgb_scalar(const u8* p_src, f32* p_dst, usize p_index, const usize p_count) {
+		const f32* table = get_srgb_table().data();
+		for (; p_index < p_count; p_index++) {
+			p_dst[p_index * 4 + 0] = table[p_src[p_index * 4 + 0]];
+			p_dst[p_index * 4 + 1] = table[p_src[p_index * 4 + 1]];
+			p_dst[p_index * 4 + 2] = table[p_src[p_index * 4 + 2]];
+			p_dst[p_index * 4 + 3] = table[256 + p_src[p_index * 4 + 3]];
+		}
+	}
+
+#ifdef NOVA_ARCH_X86_64
+	// Each SIMD kernel returns how many texels it converted and leaves the remainder to the scalar loop
+
+	usize swizzle_sse2(const u8* p_src, u8* p_dst, const usize p_count) {
+		const __m128i keep = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+		const __m128i low = _mm_set1_epi32(0xFF);
+		usize i = 0;
+		for (; i + 4 <= p_count; i += 4) {
+			const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i * 4));
+			const __m128i red = _mm_slli_epi32(_mm_and_si128(texels, low), 16);
+			const __m128i blue = _mm_and_si128(_mm_srli_epi32(texels, 16), low);
+			const __m128i result = _mm_or_si128(_mm_and_si128(texels, keep), _mm_or_si128(red, blue));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i * 4), result);
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx2")
+	usize swizzle_avx2(const u8* p_src, u8* p_dst, const usize p_count) {
+		const __m256i mask = _mm256_setr_epi8(
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15
+		);
+		usize i = 0;
+		for (; i + 8 <= p_count; i += 8) {
+			const __m256i texels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i * 4));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i * 4), _mm256_shuffle_epi8(texels, mask));
+		}
+		return i;
+	}
+
+	usize expand_r8_sse2(const u8* p_src, u8* p_dst, const usize p_count) {
+		const __m128i ones = _mm_set1_epi8(static_cast<char>(0xFF));
+		usize i = 0;
+		for (; i + 16 <= p_count; i += 16) {
+			const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i));
+
+			// Pair every value with itself and with opaque alpha, then interleave the pairs into RRRA texels
+			const __m128i rr_lo = _mm_unpacklo_epi8(values, values);
+			const __m128i rr_hi = _mm_unpackhi_epi8(values, values);
+			const __m128i ra_lo = _mm_unpacklo_epi8(values, ones);
+			const __m128i ra_hi = _mm_unpackhi_epi8(values, ones);
+
+			__m128i* dst = reinterpret_cast<__m128i*>(p_dst + i * 4);
+			_mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(rr_lo, ra_lo));
+			_mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(rr_lo, ra_lo));
+			_mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(rr_hi, ra_hi));
+			_mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(rr_hi, ra_hi));
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx2")
+	usize expand_r8_avx2(const u8* p_src, u8* p_dst, const usize p_count) {
+		const __m256i replicate = _mm256_set1_epi32(0x010101);
+		const __m256i alpha = _mm256_set1_epi32(static_cast<int>(OPAQUE_ALPHA));
+		usize i = 0;
+		for (; i + 8 <= p_count; i += 8) {
+			const __m256i values = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p_src + i)));
+			const __m256i texels = _mm256_or_si256(_mm256_mullo_epi32(values, replicate), alpha);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i * 4), texels);
+		}
+		return i;
+	}
+
+	NOVA_TARGET("ssse3")
+	usize expand_rgb8_ssse3(const u8* p_src, u8* p_dst, const usize p_count) {
+		const __m128i mask = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+		const __m128i alpha = _mm_set1_epi32(static_cast<int>(OPAQUE_ALPHA));
+		usize i = 0;
+
+		// Each load reads 16 bytes for 12 bytes of texels, so stop while that stays inside the source
+		for (; i + 6 <= p_count; i += 4) {
+			const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i * 3));
+			const __m128i result = _mm_or_si128(_mm_shuffle_epi8(texels, mask), alpha);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i * 4), result);
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx2")
+	usize expand_rgb8_avx2(const u8* p_src, u8* p_dst, const usize p_count) {
+		const __m256i mask = _mm256_setr_epi8(
+			0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+			0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+		);
+		const __m256i alpha = _mm256_set1_epi32(static_cast<int>(OPAQUE_ALPHA));
+		usize i = 0;
+		for (; i + 10 <= p_count; i += 8) {
+			const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i * 3));
+			const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i * 3 + 12));
+			const __m256i texels = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+			const __m256i result = _mm256_or_si256(_mm256_shuffle_epi8(texels, mask), alpha);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i * 4), result);
+		}
+		return i;
+	}
+
+	NOVA_TARGET("avx2")
+	usize srgb_avx2(const u8* p_src, f32* p_dst, const usize p_count) {
+		const f32* table = get_srgb_table().data();
+		const __m256i alpha_offset = _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256);
+		usize i = 0;
+		for (; i + 2 <= p_count; i += 2) {
+			const __m128i texels = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p_src + i * 4));
+			const __m256i values = _mm256_cvtepu8_epi32(texels);
+			const __m256 result = _mm256_i32gather_ps(table, _mm256_add_epi32(values, alpha_offset), 4);
+			_mm256_storeu_ps(p_dst + i * 4, result);
+		}
+		return i;
+	}
+#endif
+
+	bool is_rgba8_order(const Nova::DataFormatInfo& p_info) {
+		return p_info.block_size == 4 && !p_info.has(Nova::FormatFlags::PACKED)
+			&& (p_info.channels == "RGBA" || p_info.channels == "BGRA");
+	}
+} // namespace
+
+using namespace Nova;
+
+bool Nova::convert_texels(
+	const DataFormat p_src_format,
+	std::span<const u8> p_src,
+	const DataFormat p_dst_format,
+	std::span<u8> p_dst
+) {
+	NOVA_AUTO_TRACE();
+
+	const DataFormatInfo& from = get_format_info(p_src_format);
+	const DataFormatInfo& to = get_format_info(p_dst_format);
+	if (from.block_width != 1 || from.block_height != 1 || from.block_size == 0 || to.block_size == 0) {
+		return false;
+	}
+
+	const usize count = p_src.size() / from.block_size;
+	NOVA_ASSERT(p_src.size() % from.block_size == 0);
+	NOVA_ASSERT(p_dst.size() >= count * to.block_size);
+
+	const bool same_type = from.type == to.type && from.is_srgb() == to.is_srgb();
+	const bool to_rgba8 = to.block_size == 4 && to.channels == "RGBA" && !to.has(FormatFlags::PACKED);
+
+	if (p_src_format == p_dst_format) {
+		std::memcpy(p_dst.data(), p_src.data(), p_src.size());
+	} else if (same_type && is_rgba8_order(from) && is_rgba8_order(to)) {
+		swizzle_rgba8_bgra8(p_src, p_dst);
+	} else if (same_type && to_rgba8 && from.block_size == 1 && from.channels == "R") {
+		expand_r8_rgba8(p_src, p_dst);
+	} else if (same_type && to_rgba8 && from.block_size == 3 && from.channels == "RGB") {
+		expand_rgb8_rgba8(p_src, p_dst);
+	} else if (p_src_format == DataFormat::R8G8B8A8_SRGB && p_dst_format == DataFormat::R32G32B32A32_SFLOAT) {
+		convert_srgba8_to_linear(p_src, {reinterpret_cast<f32*>(p_dst.data()), count * 4});
+	} else if (from.type == FormatType::SFLOAT && to.type == FormatType::SFLOAT && from.channels == to.channels
+			   && from.block_size == from.channel_count * 4 && to.block_size == to.channel_count * 2) {
+		const usize values = count * from.channel_count;
+		convert_f32_to_f16(
+			{reinterpret_cast<const f32*>(p_src.data()), values},
+			{reinterpret_cast<u16*>(p_dst.data()), values}
+		);
+	} else {
+		return false;
+	}
+	return true;
+}
+
+void Nova::swizzle_rgba8_bgra8(std::span<const u8> p_src, std::span<u8> p_dst) {
+	NOVA_ASSERT(p_src.size() % 4 == 0);
+	NOVA_ASSERT(p_dst.size() >= p_src.size());
+
+	const usize count = p_src.size() / 4;
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	i = CpuInfo::get().has(CpuFeature::AVX2) ? swizzle_avx2(p_src.data(), p_dst.data(), count)
+											 : swizzle_sse2(p_src.data(), p_dst.data(), count);
+#endif
+	swizzle_scalar(p_src.data(), p_dst.data(), i, count);
+}
+
+void Nova::expand_r8_rgba8(std::span<const u8> p_src, std::span<u8> p_dst) {
+	NOVA_ASSERT(p_dst.size() >= p_src.size() * 4);
+
+	const usize count = p_src.size();
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	i = CpuInfo::get().has(CpuFeature::AVX2) ? expand_r8_avx2(p_src.data(), p_dst.data(), count)
+											 : expand_r8_sse2(p_src.data(), p_dst.data(), count);
+#endif
+	expand_r8_scalar(p_src.data(), p_dst.data(), i, count);
+}
+
+void Nova::expand_rgb8_rgba8(std::span<const u8> p_src, std::span<u8> p_dst) {
+	NOVA_ASSERT(p_src.size() % 3 == 0);
+	NOVA_ASSERT(p_dst.size() >= p_src.size() / 3 * 4);
+
+	const usize count = p_src.size() / 3;
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	const CpuInfo& cpu = CpuInfo::get();
+	if (cpu.has(CpuFeature::AVX2)) {
+		i = expand_rgb8_avx2(p_src.data(), p_dst.data(), count);
+	} else if (cpu.has(CpuFeature::SSSE3)) {
+		i = expand_rgb8_ssse3(p_src.data(), p_dst.data(), count);
+	}
+#endif
+	expand_rgb8_scalar(p_src.data(), p_dst.data(), i, count);
+}
+
+void Nova::convert_srgba8_to_linear(std::span<const u8> p_src, std::span<f32> p_dst) {
+	NOVA_ASSERT(p_src.size() % 4 == 0);
+	NOVA_ASSERT(p_dst.size() >= p_src.size());
+
+	const usize count = p_src.size() / 4;
+	usize i = 0;
+#ifdef NOVA_ARCH_X86_64
+	if (CpuInfo::get().has(CpuFeature::AVX2)) {
+		i = srgb_avx2(p_src.data(), p_dst.data(), count);
+	}
+#endif
+	srgb_scalar(p_src.data(), p_dst.data(), i, count);
+}
+
+void Nova::convert_f32_to_f16(std::span<const f32> p_src, std::span<u16> p_dst) {
+	pack_halves(p_src, {reinterpret_cast<Half*>(p_dst.data()), p_dst.size()});
+}
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/render/gpu_culling.h>
+#include <nova/render/render_driver.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+	/// Must match local_size_x in gpu_cull.comp
+	static constexpr u32 CULL_GROUP_SIZE = 64;
+
+	static constexpr Nova::RenderFeatureSet REQUIRED_FEATURES = {
+		Nova::RenderFeature::BUFFER_DEVICE_ADDRESS,
+		Nova::RenderFeature::DRAW_INDIRECT_COUNT,
+		Nova::RenderFeature::DRAW_INDIRECT_FIRST_INSTANCE,
+	};
+} // namespace
+
+using namespace Nova;
+
+GpuCuller::GpuCuller(RenderDriver* p_driver, ShaderID p_cull_shader, const u32 p_max_objects) :
+	m_driver(p_driver),
+	m_max_objects(p_max_objects) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_driver);
+	NOVA_ASSERT(p_cull_shader);
+	NOVA_ASSERT(p_max_objects > 0);
+
+	if (!m_driver->get_enabled_features().has_all(REQUIRED_FEATURES)) {
+		throw std::runtime_error("GPU culling requires buffer device address and indirect count draws");
+	}
+
+	ComputePipelineParams params;
+	params.shader = p_cull_shader;
+	params.push_constant_size = sizeof(CullPushConstants);
+	m_pipeline = m_driver->create_pipeline(params);
+
+	const u64 object_size = u64(p_max_objects) * sizeof(GpuObject);
+	m_objects = m_driver->create_buffer(
+		object_size,
+		BufferUsage::STORAGE | BufferUsage::TRANSFER_DST | BufferUsage::SHADER_DEVICE_ADDRESS
+	);
+	m_staging = m_driver->create_buffer(object_size, BufferUsage::TRANSFER_SRC, MemoryUsage::CPU_TO_GPU);
+	m_draws = m_driver->create_buffer(
+		u64(p_max_objects) * sizeof(DrawIndexedIndirectCommand),
+		BufferUsage::STORAGE | BufferUsage::INDIRECT | BufferUsage::SHADER_DEVICE_ADDRESS
+	);
+	m_count = m_driver->create_buffer(
+		sizeof(u32),
+		BufferUsage::STORAGE | BufferUsage::INDIRECT | BufferUsage::TRANSFER_DST | BufferUsage::SHADER_DEVICE_ADDRESS
+	);
+
+	m_staging_data = static_cast<GpuObject*>(m_driver->map_buffer(m_staging));
+}
+
+GpuCuller::~GpuCuller() {
+	NOVA_AUTO_TRACE();
+	m_driver->unmap_buffer(m_staging);
+	m_driver->destroy_buffer(m_count);
+	m_driver->destroy_buffer(m_draws);
+	m_driver->destroy_buffer(m_staging);
+	m_driver->destroy_buffer(m_objects);
+	m_driver->destroy_pipeline(m_pipeline);
+}
+
+void GpuCuller::set_objects(const std::span<const GpuObject> p_objects, const u32 p_first) {
+	NOVA_ASSERT(p_first + p_objects.size() <= m_max_objects);
+	if (p_objects.empty()) {
+		return;
+	}
+
+	std::memcpy(m_staging_data + p_first, p_objects.data(), p_objects.size_bytes());
+
+	const u32 end = p_first + static_cast<u32>(p_objects.size());
+	if (m_dirty_begin == m_dirty_end) {
+		m_dirty_begin = p_first;
+		m_dirty_end = end;
+	} else {
+		m_dirty_begin = std::min(m_dirty_begin, p_first);
+		m_dirty_end = std::max(m_dirty_end, end);
+	}
+}
+
+void GpuCuller::cmd_cull(
+	CommandBufferID p_command_buffer,
+	const u32 p_object_count,
+	const std::span<const Vec4<f32>, 6> p_planes
+) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_object_count <= m_max_objects);
+
+	// Only the objects touched since the last cull are uploaded
+	if (m_dirty_begin != m_dirty_end) {
+		const u64 offset = u64(m_dirty_begin) * sizeof(GpuObject);
+		const u64 size = u64(m_dirty_end - m_dirty_begin) * sizeof(GpuObject);
+		m_driver->cmd_buffer_barrier(
+			p_command_buffer,
+			m_objects,
+			BufferAccess::COMPUTE_READ,
+			BufferAccess::TRANSFER_WRITE
+		);
+		m_driver->cmd_copy_buffer(p_command_buffer, m_staging, m_objects, size, offset, offset);
+		m_driver->cmd_buffer_barrier(
+			p_command_buffer,
+			m_objects,
+			BufferAccess::TRANSFER_WRITE,
+			BufferAccess::COMPUTE_READ
+		);
+		m_dirty_begin = m_dirty_end = 0;
+	}
+
+	// The previous frame's indirect draw must finish reading before the count and commands are rewritten
+	m_driver->cmd_buffer_barrier(p_command_buffer, m_count, BufferAccess::INDIRECT_READ, BufferAccess::TRANSFER_WRITE);
+	m_driver->cmd_fill_buffer(p_command_buffer, m_count, 0, sizeof(u32), 0);
+	m_driver->cmd_buffer_barrier(p_command_buffer, m_count, BufferAccess::TRANSFER_WRITE, BufferAccess::COMPUTE_WRITE);
+	m_driver->cmd_buffer_barrier(p_command_buffer, m_draws, BufferAccess::INDIRECT_READ, BufferAccess::COMPUTE_WRITE);
+
+	CullPushConstants constants {};
+	constants.objects = m_driver->get_buffer_device_address(m_objects);
+	constants.draws = m_driver->get_buffer_device_address(m_draws);
+	constants.draw_count = m_driver->get_buffer_device_address(m_count);
+	constants.object_count = p_object_count;
+	std::copy(p_planes.begin(), p_planes.end(), constants.planes);
+
+	m_driver->cmd_bind_pipeline(p_command_buffer, m_pipeline);
+	m_driver->cmd_push_constants(
+		p_command_buffer,
+		m_pipeline,
+		{reinterpret_cast<const u8*>(&constants), sizeof(constants)}
+	);
+	m_driver->cmd_dispatch(p_command_buffer, (p_object_count + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE);
+
+	m_driver->cmd_buffer_barrier(p_command_buffer, m_draws, BufferAccess::COMPUTE_WRITE, BufferAccess::INDIRECT_READ);
+	m_driver->cmd_buffer_barrier(p_command_buffer, m_count, BufferAccess::COMPUTE_WRITE, BufferAccess::INDIRECT_READ);
+
+	m_object_count = p_object_count;
+}
+
+void GpuCuller::cmd_draw(CommandBufferID p_command_buffer) {
+	NOVA_ASSERT(p_command_buffer);
+	if (m_object_count == 0) {
+		return;
+	}
+	m_driver->cmd_draw_indexed_indirect_count(
+		p_command_buffer,
+		m_draws,
+		0,
+		m_count,
+		0,
+		m_object_count,
+		sizeof(DrawIndexedIndirectCommand)
+	);
+}
+
+u32 GpuCuller::get_max_objects() const {
+	return m_max_objects;
+}
+
+BufferID GpuCuller::get_object_buffer() const {
+	return m_objects;
+}
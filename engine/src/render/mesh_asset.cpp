@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
+#include <nova/render/mesh_asset.h>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace {
+	static constexpr u32 MESH_MAGIC = 0x48534d4e; // "NMSH"
+	static constexpr u32 MESH_VERSION = 1;
+
+	// Plain structs only, the file is native endian
+	struct MeshHeader {
+		u32 magic;
+		u32 version;
+		u32 binding_count;
+		u32 attribute_count;
+		u32 vertex_count;
+		u32 vertex_size;
+		u32 index_count;
+		u32 lod_count;
+		u32 meshlet_count;
+		u32 meshlet_vertex_count;
+		u32 meshlet_triangle_size;
+		u32 padding;
+	};
+
+	template<typename T>
+	void write(std::vector<u8>& p_out, const std::span<const T> p_values) {
+		if (p_values.empty()) {
+			return;
+		}
+		const usize offset = p_out.size();
+		p_out.resize(offset + p_values.size_bytes());
+		std::memcpy(p_out.data() + offset, p_values.data(), p_values.size_bytes());
+	}
+
+	class Reader {
+	  public:
+		explicit Reader(const std::span<const u8> p_bytes) : m_bytes(p_bytes) {}
+
+		template<typename T>
+		void read(std::vector<T>& p_values, const usize p_count) {
+			const usize size = p_count * sizeof(T);
+			if (size > m_bytes.size() - m_offset) {
+				throw std::runtime_error("Mesh asset is truncated");
+			}
+			p_values.resize(p_count);
+			std::memcpy(p_values.data(), m_bytes.data() + m_offset, size);
+			m_offset += size;
+		}
+
+		template<typename T>
+		T read() {
+			std::vector<T> value;
+			read(value, 1);
+			return value.front();
+		}
+
+	  private:
+		std::span<const u8> m_bytes;
+		usize m_offset = 0;
+	};
+} // namespace
+
+using namespace Nova;
+
+MeshAsset MeshAsset::load(const std::filesystem::path& p_path) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::ASSETS);
+
+	std::ifstream file(p_path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Failed to open mesh asset: " + p_path.string());
+	}
+	const std::vector<u8> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return load(bytes);
+}
+
+MeshAsset MeshAsset::load(const std::span<const u8> p_bytes) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::ASSETS);
+
+	Reader reader(p_bytes);
+	const MeshHeader header = reader.read<MeshHeader>();
+	if (header.magic != MESH_MAGIC) {
+		throw std::runtime_error("Not a mesh asset");
+	}
+	if (header.version != MESH_VERSION) {
+		throw std::runtime_error("Unsupported mesh asset version " + std::to_string(header.version));
+	}
+
+	MeshAsset asset;
+	asset.vertex_count = header.vertex_count;
+	reader.read(asset.bindings, header.binding_count);
+	reader.read(asset.attributes, header.attribute_count);
+	reader.read(asset.vertices, header.vertex_size);
+	reader.read(asset.indices, header.index_count);
+	reader.read(asset.lods, header.lod_count);
+	reader.read(asset.meshlets.meshlets, header.meshlet_count);
+	reader.read(asset.meshlets.bounds, header.meshlet_count);
+	reader.read(asset.meshlets.vertices, header.meshlet_vertex_count);
+	reader.read(asset.meshlets.triangles, header.meshlet_triangle_size);
+	return asset;
+}
+
+void MeshAsset::save(const std::filesystem::path& p_path) const {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::ASSETS);
+
+	const std::vector<u8> bytes = serialize();
+	std::ofstream file(p_path, std::ios::binary);
+	if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+		throw std::runtime_error("Failed to write mesh asset: " + p_path.string());
+	}
+}
+
+std::vector<u8> MeshAsset::serialize() const {
+	MeshHeader header {};
+	header.magic = MESH_MAGIC;
+	header.version = MESH_VERSION;
+	header.binding_count = static_cast<u32>(bindings.size());
+	header.attribute_count = static_cast<u32>(attributes.size());
+	header.vertex_count = vertex_count;
+	header.vertex_size = static_cast<u32>(vertices.size());
+	header.index_count = static_cast<u32>(indices.size());
+	header.lod_count = static_cast<u32>(lods.size());
+	header.meshlet_count = static_cast<u32>(meshlets.meshlets.size());
+	header.meshlet_vertex_count = static_cast<u32>(meshlets.vertices.size());
+	header.meshlet_triangle_size = static_cast<u32>(meshlets.triangles.size());
+
+	std::vector<u8> out;
+	write(out, std::span<const MeshHeader>(&header, 1));
+	write(out, std::span(bindings));
+	write(out, std::span(attributes));
+	write(out, std::span(vertices));
+	write(out, std::span(indices));
+	write(out, std::span(lods));
+	write(out, std::span(meshlets.meshlets));
+	write(out, std::span(meshlets.bounds));
+	write(out, std::span(meshlets.vertices));
+	write(out, std::span(meshlets.triangles));
+	return out;
+}
@@ -0,0 +1,307 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/render/meshlet.h>
+#include <nova/render/render_driver.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+	static constexpr u32 INVALID_INDEX = std::numeric_limits<u32>::max();
+
+	/// Normals spread wider than this can never be back facing as a whole, so the cone is left disabled
+	static constexpr f32 MIN_CONE_DOT = 0.1f;
+
+	/// Must match local_size_x in meshlet.task
+	static constexpr u32 TASK_GROUP_SIZE = 32;
+
+	static constexpr u64 STAGING_ALIGNMENT = 16;
+
+	using Vec3f = Nova::Vec3<f32>;
+
+	Nova::MeshletBounds compute_bounds(
+		const Nova::MeshletData& p_data,
+		const Nova::Meshlet& p_meshlet,
+		std::span<const Vec3f> p_positions
+	) {
+		const auto position = [&](const u32 p_triangle, const u32 p_corner) -> const Vec3f& {
+			const u8 local = p_data.triangles[p_meshlet.triangle_offset + p_triangle * 3 + p_corner];
+			return p_positions[p_data.vertices[p_meshlet.vertex_offset + local]];
+		};
+
+		Nova::MeshletBounds bounds {};
+
+		Vec3f min = p_positions[p_data.vertices[p_meshlet.vertex_offset]];
+		Vec3f max = min;
+		for (u32 i = 1; i < p_meshlet.vertex_count; i++) {
+			const Vec3f& p = p_positions[p_data.vertices[p_meshlet.vertex_offset + i]];
+			min = Nova::min(min, p);
+			max = Nova::max(max, p);
+		}
+
+		const Vec3f center = (min + max) * 0.5f;
+		f32 radius = 0.0f;
+		for (u32 i = 0; i < p_meshlet.vertex_count; i++) {
+			const Vec3f& p = p_positions[p_data.vertices[p_meshlet.vertex_offset + i]];
+			radius = std::max(radius, length_squared(p - center));
+		}
+		bounds.sphere = {center.x, center.y, center.z, std::sqrt(radius)};
+
+		// A cutoff of one with a zero axis never culls
+		bounds.cone_axis = {0.0f, 0.0f, 0.0f, 1.0f};
+
+		Vec3f normals[Nova::MESHLET_MAX_TRIANGLES * 2];
+		Vec3f axis = {0.0f, 0.0f, 0.0f};
+		u32 normal_count = 0;
+		for (u32 t = 0; t < p_meshlet.triangle_count; t++) {
+			const Vec3f& p0 = position(t, 0);
+			const Vec3f n = cross(position(t, 1) - p0, position(t, 2) - p0);
+			const f32 n_length = length(n);
+			if (n_length == 0.0f || normal_count == std::size(normals)) {
+				continue;
+			}
+			normals[normal_count] = n / n_length;
+			axis += normals[normal_count++];
+		}
+
+		const f32 axis_length = length(axis);
+		if (normal_count == 0 || axis_length == 0.0f) {
+			return bounds;
+		}
+		axis /= axis_length;
+
+		f32 min_dot = 1.0f;
+		for (u32 i = 0; i < normal_count; i++) {
+			min_dot = std::min(min_dot, dot(normals[i], axis));
+		}
+		if (min_dot <= MIN_CONE_DOT) {
+			return bounds;
+		}
+
+		// Move the apex back along the axis until every triangle plane lies in front of it
+		f32 max_t = 0.0f;
+		u32 n = 0;
+		for (u32 t = 0; t < p_meshlet.triangle_count && n < normal_count; t++) {
+			const Vec3f& p0 = position(t, 0);
+			const Vec3f e = cross(position(t, 1) - p0, position(t, 2) - p0);
+			if (length_squared(e) == 0.0f) {
+				continue;
+			}
+			const Vec3f& normal = normals[n++];
+			max_t = std::max(max_t, dot(center - p0, normal) / dot(axis, normal));
+		}
+
+		const Vec3f apex = center - axis * max_t;
+		bounds.cone_apex = {apex.x, apex.y, apex.z, 0.0f};
+		bounds.cone_axis = {axis.x, axis.y, axis.z, std::sqrt(1.0f - min_dot * min_dot)};
+		return bounds;
+	}
+
+	template<typename T>
+	std::span<const u8> as_bytes(const std::vector<T>& p_vector) {
+		return {reinterpret_cast<const u8*>(p_vector.data()), p_vector.size() * sizeof(T)};
+	}
+} // namespace
+
+using namespace Nova;
+
+MeshletData MeshletData::build(
+	const std::span<const u32> p_indices,
+	const std::span<const Vec3<f32>> p_positions,
+	const u32 p_max_vertices,
+	const u32 p_max_triangles
+) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_indices.size() % 3 == 0);
+	NOVA_ASSERT(p_max_vertices >= 3 && p_max_vertices <= 256);
+	NOVA_ASSERT(p_max_triangles >= 1 && p_max_triangles <= MESHLET_MAX_TRIANGLES * 2);
+
+	MeshletData data;
+	std::vector<u32> local(p_positions.size(), INVALID_INDEX);
+	Meshlet current {};
+
+	const auto flush = [&]() {
+		if (current.triangle_count == 0) {
+			return;
+		}
+		for (u32 i = 0; i < current.vertex_count; i++) {
+			local[data.vertices[current.vertex_offset + i]] = INVALID_INDEX;
+		}
+		data.triangles.resize((data.triangles.size() + 3) & ~usize(3));
+		data.meshlets.push_back(current);
+		current = {};
+		current.vertex_offset = static_cast<u32>(data.vertices.size());
+		current.triangle_offset = static_cast<u32>(data.triangles.size());
+	};
+
+	for (usize i = 0; i < p_indices.size(); i += 3) {
+		const u32 a = p_indices[i + 0];
+		const u32 b = p_indices[i + 1];
+		const u32 c = p_indices[i + 2];
+		NOVA_ASSERT(a < p_positions.size() && b < p_positions.size() && c < p_positions.size());
+
+		u32 new_vertices = local[a] == INVALID_INDEX;
+		new_vertices += local[b] == INVALID_INDEX && b != a;
+		new_vertices += local[c] == INVALID_INDEX && c != a && c != b;
+
+		if (current.vertex_count + new_vertices > p_max_vertices || current.triangle_count == p_max_triangles) {
+			flush();
+		}
+
+		for (const u32 vertex : {a, b, c}) {
+			if (local[vertex] == INVALID_INDEX) {
+				local[vertex] = current.vertex_count++;
+				data.vertices.push_back(vertex);
+			}
+			data.triangles.push_back(static_cast<u8>(local[vertex]));
+		}
+		current.triangle_count++;
+	}
+	flush();
+
+	data.bounds.reserve(data.meshlets.size());
+	for (const Meshlet& meshlet : data.meshlets) {
+		data.bounds.push_back(compute_bounds(data, meshlet, p_positions));
+	}
+
+	return data;
+}
+
+std::vector<u32> MeshletData::get_indices() const {
+	std::vector<u32> indices;
+	for (const Meshlet& meshlet : meshlets) {
+		for (u32 i = 0; i < meshlet.triangle_count * 3; i++) {
+			indices.push_back(vertices[meshlet.vertex_offset + triangles[meshlet.triangle_offset + i]]);
+		}
+	}
+	return indices;
+}
+
+MeshletMesh::MeshletMesh(RenderDriver* p_driver, const MeshletData& p_data) : m_driver(p_driver) {
+	NOVA_AUTO_TRACE();
+	NOVA_ASSERT(p_driver);
+	NOVA_ASSERT(!p_data.meshlets.empty());
+
+	m_mesh_shaders = m_driver->has_feature(RenderFeature::MESH_SHADER)
+		&& m_driver->has_feature(RenderFeature::BUFFER_DEVICE_ADDRESS);
+	m_meshlet_count = static_cast<u32>(p_data.meshlets.size());
+	m_index_count = 0;
+
+	std::vector<u32> indices;
+	u64 staging_size = 0;
+	if (m_mesh_shaders) {
+		for (const usize size : {
+				 p_data.meshlets.size() * sizeof(Meshlet),
+				 p_data.bounds.size() * sizeof(MeshletBounds),
+				 p_data.vertices.size() * sizeof(u32),
+				 p_data.triangles.size(),
+			 }) {
+			staging_size += (size + STAGING_ALIGNMENT - 1) & ~(STAGING_ALIGNMENT - 1);
+		}
+	} else {
+		indices = p_data.get_indices();
+		m_index_count = static_cast<u32>(indices.size());
+		staging_size = indices.size() * sizeof(u32);
+	}
+
+	m_staging = m_driver->create_buffer(staging_size, BufferUsage::TRANSFER_SRC, MemoryUsage::CPU_TO_GPU);
+	u8* staging = static_cast<u8*>(m_driver->map_buffer(m_staging));
+	u64 offset = 0;
+
+	if (m_mesh_shaders) {
+		const BufferUsage usage = BufferUsage::STORAGE | BufferUsage::SHADER_DEVICE_ADDRESS;
+		m_meshlets = _create_buffer(as_bytes(p_data.meshlets), usage, staging, offset);
+		m_bounds = _create_buffer(as_bytes(p_data.bounds), usage, staging, offset);
+		m_vertices = _create_buffer(as_bytes(p_data.vertices), usage, staging, offset);
+		m_triangles = _create_buffer(as_bytes(p_data.triangles), usage, staging, offset);
+	} else {
+		m_indices = _create_buffer(as_bytes(indices), BufferUsage::INDEX, staging, offset);
+	}
+
+	m_driver->unmap_buffer(m_staging);
+}
+
+MeshletMesh::~MeshletMesh() {
+	NOVA_AUTO_TRACE();
+	release_staging();
+	for (BufferID buffer : {m_meshlets, m_bounds, m_vertices, m_triangles, m_indices}) {
+		if (buffer) {
+			m_driver->destroy_buffer(buffer);
+		}
+	}
+}
+
+bool MeshletMesh::uses_mesh_shaders() const {
+	return m_mesh_shaders;
+}
+
+void MeshletMesh::cmd_upload(CommandBufferID p_command_buffer) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(m_staging);
+
+	const BufferAccess access = m_mesh_shaders ? BufferAccess::MESH_READ : BufferAccess::INDEX_READ;
+	for (const Upload& upload : m_uploads) {
+		m_driver->cmd_copy_buffer(p_command_buffer, m_staging, upload.buffer, upload.size, upload.staging_offset, 0);
+		m_driver->cmd_buffer_barrier(p_command_buffer, upload.buffer, BufferAccess::TRANSFER_WRITE, access);
+	}
+}
+
+void MeshletMesh::release_staging() {
+	if (m_staging) {
+		m_driver->destroy_buffer(m_staging);
+		m_staging = nullptr;
+	}
+}
+
+void MeshletMesh::cmd_draw(CommandBufferID p_command_buffer, PipelineID p_pipeline, const DrawParams& p_params) {
+	NOVA_ASSERT(p_command_buffer);
+	NOVA_ASSERT(p_pipeline);
+
+	m_driver->cmd_bind_pipeline(p_command_buffer, p_pipeline);
+
+	if (!m_mesh_shaders) {
+		m_driver->cmd_bind_index_buffer(p_command_buffer, m_indices, IndexType::UINT32);
+		m_driver->cmd_draw_indexed(p_command_buffer, m_index_count);
+		return;
+	}
+
+	NOVA_ASSERT(p_params.positions);
+	NOVA_ASSERT(p_params.view);
+
+	MeshletPushConstants constants {};
+	constants.meshlets = m_driver->get_buffer_device_address(m_meshlets);
+	constants.bounds = m_driver->get_buffer_device_address(m_bounds);
+	constants.vertices = m_driver->get_buffer_device_address(m_vertices);
+	constants.triangles = m_driver->get_buffer_device_address(m_triangles);
+	constants.positions = m_driver->get_buffer_device_address(p_params.positions);
+	constants.view = m_driver->get_buffer_device_address(p_params.view);
+	constants.meshlet_count = m_meshlet_count;
+	constants.position_stride = p_params.position_stride;
+
+	m_driver->cmd_push_constants(
+		p_command_buffer,
+		p_pipeline,
+		{reinterpret_cast<const u8*>(&constants), sizeof(constants)}
+	);
+	m_driver->cmd_draw_mesh_tasks(p_command_buffer, (m_meshlet_count + TASK_GROUP_SIZE - 1) / TASK_GROUP_SIZE);
+}
+
+BufferID MeshletMesh::_create_buffer(
+	const std::span<const u8> p_data,
+	const BufferUsage p_usage,
+	u8* p_staging,
+	u64& p_staging_offset
+) {
+	BufferID buffer = m_driver->create_buffer(p_data.size(), p_usage | BufferUsage::TRANSFER_DST);
+	std::memcpy(p_staging + p_staging_offset, p_data.data(), p_data.size());
+	m_uploads.push_back({buffer, p_staging_offset, p_data.size()});
+	p_staging_offset += (p_data.size() + STAGING_ALIGNMENT - 1) & ~(STAGING_ALIGNMENT - 1);
+	return buffer;
+}
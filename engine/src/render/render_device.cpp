@@ -9,54 +9,188 @@
 #include <nova/render/render_driver.h>
 
 #include <algorithm>
+#include <bit>
 #include <limits>
 
-using namespace Nova;
-
-u32 RenderDevice::choose_device(RenderDriver* p_driver, std::span<const SurfaceID> p_surfaces) {
-	NOVA_AUTO_TRACE();
+namespace {
+	static constexpr f32 MEMORY_WEIGHT = 2.0f;
+	static constexpr f32 COMPUTE_WEIGHT = 1.0f;
+	static constexpr f32 FEATURE_WEIGHT = 1.0f;
+	static constexpr f32 QUEUE_WEIGHT = 0.5f;
+} // namespace
 
-	u32 best_index = std::numeric_limits<u32>::max();
-	u32 best_score = 0;
-
-	const bool prefer_discrete = true; // TODO: Get from config
+using namespace Nova;
 
-	for (u32 i = 0; i < p_driver->get_device_count(); i++) {
-		auto& device = p_driver->get_device(i);
-		u32 score = 1;
+u32 RenderFeatureSet::count() const {
+	return static_cast<u32>(std::popcount(bits));
+}
 
-		if (!std::all_of(p_surfaces.begin(), p_surfaces.end(), [&](SurfaceID surface) {
-				return p_driver->get_device_supports_surface(i, surface);
-			})) {
-			continue;
+u64 RenderDevice::get_device_local_memory() const {
+	u64 total = 0;
+	for (const auto& heap : memory_heaps) {
+		if (heap.device_local) {
+			total += heap.size;
 		}
+	}
+	return total;
+}
+
+DeviceScoring DeviceScoring::get_default(const bool p_prefer_discrete) {
+	DeviceScoring scoring;
 
-		switch (device.type) {
+	// A device of a better type always wins, no matter how the rest of it scores
+	scoring.tier = [p_prefer_discrete](const RenderDevice& p_device) -> u32 {
+		switch (p_device.type) {
 			case DeviceType::DISCRETE:
-				score += prefer_discrete ? 4 : 3;
-				break;
+				return p_prefer_discrete ? 4 : 3;
 			case DeviceType::INTEGRATED:
-				score += prefer_discrete ? 3 : 4;
-				break;
+				return p_prefer_discrete ? 3 : 4;
 			case DeviceType::VIRTUAL:
-				score += 2;
-				break;
+				return 2;
 			case DeviceType::CPU:
-				score += 1;
-				break;
+				return 1;
 			default:
-				break;
+				return 0;
 		}
+	};
 
-		if (score > best_score) {
-			best_index = i;
-			best_score = score;
+	scoring.scorers.push_back({
+		.name = "memory",
+		.weight = MEMORY_WEIGHT,
+		.score = [](const RenderDevice& p_device) -> f64 {
+			// Device local heaps of these are carved out of system memory, which says nothing about the device
+			if (p_device.type == DeviceType::INTEGRATED || p_device.type == DeviceType::CPU) {
+				return 0.0;
+			}
+			return static_cast<f64>(p_device.get_device_local_memory());
+		},
+	});
+
+	scoring.scorers.push_back({
+		.name = "compute",
+		.weight = COMPUTE_WEIGHT,
+		.score = [](const RenderDevice& p_device) -> f64 {
+			return static_cast<f64>(p_device.limits.max_compute_shared_memory_size)
+				+ static_cast<f64>(p_device.limits.max_compute_work_group_invocations) * p_device.subgroup_size;
+		},
+	});
+
+	scoring.scorers.push_back({
+		.name = "features",
+		.weight = FEATURE_WEIGHT,
+		.score = [](const RenderDevice& p_device) -> f64 { return p_device.features.count(); },
+	});
+
+	// Dedicated compute and transfer families allow async work alongside graphics
+	scoring.scorers.push_back({
+		.name = "queues",
+		.weight = QUEUE_WEIGHT,
+		.score = [](const RenderDevice& p_device) -> f64 {
+			f64 score = 1.0;
+			for (const auto& family : p_device.queue_families) {
+				if (!family.graphics && family.compute) {
+					score += 1.0;
+				} else if (!family.graphics && !family.compute && family.transfer) {
+					score += 0.5;
+				}
+			}
+			return score;
+		},
+	});
+
+	return scoring;
+}
+
+u32 RenderDevice::choose_device(
+	RenderDriver* p_driver,
+	std::span<const SurfaceID> p_surfaces,
+	const bool p_prefer_discrete
+) {
+	return choose_device(p_driver, DeviceScoring::get_default(p_prefer_discrete), p_surfaces);
+}
+
+u32 RenderDevice::choose_device(
+	RenderDriver* p_driver,
+	const DeviceScoring& p_scoring,
+	std::span<const SurfaceID> p_surfaces
+) {
+	NOVA_AUTO_TRACE();
+
+	std::vector<u32> candidates;
+	for (u32 i = 0; i < p_driver->get_device_count(); i++) {
+		if (!p_driver->get_device(i).features.has_all(p_scoring.required_features)) {
+			continue;
+		}
+		if (std::all_of(p_surfaces.begin(), p_surfaces.end(), [&](SurfaceID surface) {
+				return p_driver->get_device_supports_surface(i, surface);
+			})) {
+			candidates.push_back(i);
 		}
 	}
 
-	if (best_index == std::numeric_limits<u32>::max()) {
+	if (candidates.empty()) {
 		throw std::runtime_error("No suitable render device found");
 	}
 
+	if (p_scoring.tier) {
+		std::vector<u32> tiers(candidates.size());
+		for (usize c = 0; c < candidates.size(); c++) {
+			tiers[c] = p_scoring.tier(p_driver->get_device(candidates[c]));
+		}
+
+		// Drop lower tiers before scoring, so they neither win nor skew the normalization
+		const u32 top = *std::max_element(tiers.begin(), tiers.end());
+		usize kept = 0;
+		for (usize c = 0; c < candidates.size(); c++) {
+			if (tiers[c] == top) {
+				candidates[kept++] = candidates[c];
+			}
+		}
+		candidates.resize(kept);
+	}
+
+	if (candidates.size() == 1) {
+		return candidates.front();
+	}
+
+	const bool use_probe = p_scoring.probe_weight > 0.0f;
+	const usize criteria = p_scoring.scorers.size() + (use_probe ? 1 : 0);
+
+	// raw[criterion * candidates + candidate]
+	std::vector<f64> raw(criteria * candidates.size(), 0.0);
+	std::vector<f64> best(criteria, 0.0);
+
+	for (usize c = 0; c < candidates.size(); c++) {
+		const RenderDevice& device = p_driver->get_device(candidates[c]);
+		for (usize s = 0; s < criteria; s++) {
+			f64 value = s < p_scoring.scorers.size() ? p_scoring.scorers[s].score(device)
+													 : p_driver->probe_device(candidates[c]);
+			value = std::max(value, 0.0);
+			raw[s * candidates.size() + c] = value;
+			best[s] = std::max(best[s], value);
+		}
+	}
+
+	u32 best_index = std::numeric_limits<u32>::max();
+	f64 best_score = -1.0;
+
+	for (usize c = 0; c < candidates.size(); c++) {
+		f64 score = 0.0;
+		for (usize s = 0; s < criteria; s++) {
+			if (best[s] <= 0.0) {
+				continue;
+			}
+			const f32 weight = s < p_scoring.scorers.size() ? p_scoring.scorers[s].weight : p_scoring.probe_weight;
+			score += weight * (raw[s * candidates.size() + c] / best[s]);
+		}
+
+		NOVA_DEBUG("Device score: {} = {:.3f}", p_driver->get_device(candidates[c]).name, score);
+
+		if (score > best_score) {
+			best_index = candidates[c];
+			best_score = score;
+		}
+	}
+
 	return best_index;
 }
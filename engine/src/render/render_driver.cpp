@@ -8,12 +8,16 @@
 #include "drivers/vulkan/render_driver.h" // IWYU pragma: keep
 
 #include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
+#include <nova/core/timer.h>
 #include <nova/render/render_driver.h>
 
 using namespace Nova;
 
 RenderDriver* RenderDriver::create(const RenderAPI p_api, WindowDriver* p_driver) {
 	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::RENDER);
+	NOVA_SCOPED_TIMER("RenderDriver::create");
 	switch (p_api) {
 #ifdef NOVA_DX12
 		case RenderAPI::DX12:
@@ -27,3 +31,22 @@ RenderDriver* RenderDriver::create(const RenderAPI p_api, WindowDriver* p_driver
 			throw std::runtime_error("Unsupported render API");
 	}
 }
+
+std::future<RenderDriver*> RenderDriver::create_async(const RenderAPI p_api, WindowDriver* p_driver) {
+	NOVA_AUTO_TRACE();
+	return std::async(std::launch::async, [p_api, p_driver] { return create(p_api, p_driver); });
+}
+
+void RenderDriver::select_device(
+	const u32 p_index,
+	const RenderFeatureSet& p_required,
+	const RenderFeatureSet& p_optional
+) {
+	NOVA_AUTO_TRACE();
+	set_current_device(open_device(p_index, p_required, p_optional));
+}
+
+bool RenderDriver::has_format_features(const DataFormat p_format, const FormatFeature p_features) const {
+	const FormatFeature supported = get_format_features(get_device_index(get_current_device()), p_format);
+	return (supported & p_features) == p_features;
+}
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2025, Jayden Grubb <contact@jaydengrubb.com>
+ * 
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <nova/core/debug.h>
+#include <nova/core/memory_tracker.h>
+#include <nova/render/texture_asset.h>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace {
+	static constexpr u32 TEXTURE_MAGIC = 0x5845544e; // "NTEX"
+	static constexpr u32 TEXTURE_VERSION = 1;
+
+	// Plain structs only, the file is native endian
+	struct TextureHeader {
+		u32 magic;
+		u32 version;
+		u32 format;
+		u32 width;
+		u32 height;
+		u32 mip_count;
+		u64 data_size;
+	};
+
+	template<typename T>
+	void write(std::vector<u8>& p_out, const std::span<const T> p_values) {
+		if (p_values.empty()) {
+			return;
+		}
+		const usize offset = p_out.size();
+		p_out.resize(offset + p_values.size_bytes());
+		std::memcpy(p_out.data() + offset, p_values.data(), p_values.size_bytes());
+	}
+
+	class Reader {
+	  public:
+		explicit Reader(const std::span<const u8> p_bytes) : m_bytes(p_bytes) {}
+
+		template<typename T>
+		void read(std::vector<T>& p_values, const usize p_count) {
+			if (p_count > (m_bytes.size() - m_offset) / sizeof(T)) {
+				throw std::runtime_error("Texture asset is truncated");
+			}
+			const usize size = p_count * sizeof(T);
+			p_values.resize(p_count);
+			std::memcpy(p_values.data(), m_bytes.data() + m_offset, size);
+			m_offset += size;
+		}
+
+		template<typename T>
+		T read() {
+			std::vector<T> value;
+			read(value, 1);
+			return value.front();
+		}
+
+	  private:
+		std::span<const u8> m_bytes;
+		usize m_offset = 0;
+	};
+} // namespace
+
+using namespace Nova;
+
+std::span<const u8> TextureAsset::get_mip_data(const u32 p_level) const {
+	NOVA_ASSERT(p_level < mips.size());
+	return std::span(data).subspan(mips[p_level].offset, mips[p_level].size);
+}
+
+TextureAsset TextureAsset::load(const std::filesystem::path& p_path) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::ASSETS);
+
+	std::ifstream file(p_path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Failed to open texture asset: " + p_path.string());
+	}
+	const std::vector<u8> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return load(bytes);
+}
+
+TextureAsset TextureAsset::load(const std::span<const u8> p_bytes) {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::ASSETS);
+
+	Reader reader(p_bytes);
+	const TextureHeader header = reader.read<TextureHeader>();
+	if (header.magic != TEXTURE_MAGIC) {
+		throw std::runtime_error("Not a texture asset");
+	}
+	if (header.version != TEXTURE_VERSION) {
+		throw std::runtime_error("Unsupported texture asset version " + std::to_string(header.version));
+	}
+	if (header.format >= static_cast<u32>(DataFormat::MAX)) {
+		throw std::runtime_error("Texture asset has an unknown format");
+	}
+
+	TextureAsset asset;
+	asset.format = static_cast<DataFormat>(header.format);
+	asset.width = header.width;
+	asset.height = header.height;
+	reader.read(asset.mips, header.mip_count);
+	reader.read(asset.data, header.data_size);
+
+	for (const TextureMip& mip : asset.mips) {
+		if (mip.offset > asset.data.size() || mip.size > asset.data.size() - mip.offset) {
+			throw std::runtime_error("Texture asset mip is out of range");
+		}
+	}
+	return asset;
+}
+
+void TextureAsset::save(const std::filesystem::path& p_path) const {
+	NOVA_AUTO_TRACE();
+	NOVA_MEMORY_SCOPE(MemoryTag::ASSETS);
+
+	const std::vector<u8> bytes = serialize();
+	std::ofstream file(p_path, std::ios::binary);
+	if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+		throw std::runtime_error("Failed to write texture asset: " + p_path.string());
+	}
+}
+
+std::vector<u8> TextureAsset::serialize() const {
+	TextureHeader header {};
+	header.magic = TEXTURE_MAGIC;
+	header.version = TEXTURE_VERSION;
+	header.format = static_cast<u32>(format);
+	header.width = width;
+	header.height = height;
+	header.mip_count = static_cast<u32>(mips.size());
+	header.data_size = data.size();
+
+	std::vector<u8> out;
+	write(out, std::span<const TextureHeader>(&header, 1));
+	write(out, std::span(mips));
+	write(out, std::span(data));
+	return out;
+}